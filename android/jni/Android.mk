@@ -43,10 +43,18 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := FlatBufferTest
 LOCAL_SRC_FILES := android/jni/main.cpp \
                    tests/test.cpp \
+                   src/idl_parser.cpp \
+                   src/idl_gen_text.cpp \
                    src/idl_gen_fbs.cpp \
-                   src/idl_gen_general.cpp
+                   src/idl_gen_general.cpp \
+                   src/reflection.cpp \
+                   src/util.cpp
+# Built here rather than taken from flatbuffers_extra, so reflection.cpp sees
+# the same Verifier settings as the tests.
+LOCAL_CPPFLAGS := -DFLATBUFFERS_DEBUG_VERIFICATION_FAILURE=1 \
+                  -DFLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
 LOCAL_LDLIBS := -llog -landroid
-LOCAL_STATIC_LIBRARIES := android_native_app_glue flatbuffers_extra
+LOCAL_STATIC_LIBRARIES := android_native_app_glue flatbuffers
 LOCAL_ARM_MODE := arm
 include $(BUILD_SHARED_LIBRARY)
 
@@ -17,6 +17,7 @@
 #include <thread>
 
 #include <grpc++/grpc++.h>
+#include <grpc/support/alloc.h>
 
 #include "monster_test_generated.h"
 #include "monster_test.grpc.fb.h"
@@ -80,7 +81,93 @@ void RunServer() {
   server_instance->Wait();
 }
 
+// Counts the memory GRPC allocates, to check messages are not copied.
+size_t grpc_bytes_allocated = 0;
+gpr_allocation_functions default_allocation_functions;
+
+void *CountingMalloc(size_t size) {
+  grpc_bytes_allocated += size;
+  return default_allocation_functions.malloc_fn(size);
+}
+
+// Serializing an owning BufferRef, and deserializing a single slice, must
+// not copy the FlatBuffer.
+int ZeroCopyTest() {
+  typedef grpc::SerializationTraits<flatbuffers::BufferRef<Monster>> Traits;
+  int failures = 0;
+
+  // A message large enough that a copy stands out from GRPC's bookkeeping.
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint8_t> inventory(64 * 1024, 1);
+  fbb.Finish(CreateMonster(fbb, 0, 0, 0, fbb.CreateString("Fred"),
+                           fbb.CreateVector(inventory)));
+  auto len = fbb.GetSize();
+  flatbuffers::BufferRef<Monster> request(fbb.ReleaseBufferPointer(), len);
+
+  default_allocation_functions = gpr_get_allocation_functions();
+  auto counting_functions = default_allocation_functions;
+  counting_functions.malloc_fn = CountingMalloc;
+  gpr_set_allocation_functions(counting_functions);
+
+  grpc_bytes_allocated = 0;
+  grpc_byte_buffer *buffer = nullptr;
+  bool own_buffer = false;
+  Traits::Serialize(request, &buffer, &own_buffer);
+  if (grpc_bytes_allocated >= len) {
+    std::cout << "Serialize copied the message" << std::endl;
+    failures++;
+  }
+
+  grpc_bytes_allocated = 0;
+  flatbuffers::BufferRef<Monster> response;
+  Traits::Deserialize(buffer, &response, 0);
+  if (grpc_bytes_allocated >= len || response.must_free ||
+      response.buf != request.buf || response.len != len) {
+    std::cout << "Deserialize copied the message" << std::endl;
+    failures++;
+  }
+  if (!response.Verify() ||
+      response.GetRoot()->inventory()->size() != inventory.size()) {
+    std::cout << "Deserialized message is corrupt" << std::endl;
+    failures++;
+  }
+
+  gpr_set_allocation_functions(default_allocation_functions);
+
+  // A message small enough for GRPC to hold it inline in the slice itself
+  // must stay valid after Deserialize() returns.
+  flatbuffers::FlatBufferBuilder small_fbb;
+  small_fbb.Finish(CreateStat(small_fbb));
+  std::vector<uint8_t> small(small_fbb.GetBufferPointer(),
+                             small_fbb.GetBufferPointer() +
+                               small_fbb.GetSize());
+  auto small_slice = gpr_slice_from_copied_buffer(
+                       reinterpret_cast<const char *>(small.data()),
+                       small.size());
+  if (small_slice.refcount) {
+    std::cout << "Small message was not inlined" << std::endl;
+    failures++;
+  }
+  auto small_buffer = grpc_raw_byte_buffer_create(&small_slice, 1);
+  gpr_slice_unref(small_slice);
+  flatbuffers::BufferRef<Stat> small_response;
+  grpc::SerializationTraits<flatbuffers::BufferRef<Stat>>::Deserialize(
+    small_buffer, &small_response, 0);
+  // Reuse the stack Deserialize() ran on.
+  volatile char scribble[256];
+  memset(const_cast<char *>(scribble), 0xAB, sizeof(scribble));
+  if (small_response.len != small.size() ||
+      memcmp(small_response.buf, small.data(), small.size()) ||
+      !small_response.Verify()) {
+    std::cout << "Inlined message did not survive Deserialize" << std::endl;
+    failures++;
+  }
+  return failures;
+}
+
 int main(int /*argc*/, const char * /*argv*/[]) {
+  if (ZeroCopyTest()) return 1;
+
   // Launch server.
   std::thread server_thread(RunServer);
 
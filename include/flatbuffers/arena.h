@@ -0,0 +1,232 @@
+/*
+ * Copyright 2017 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_ARENA_H_
+#define FLATBUFFERS_ARENA_H_
+
+#include <string>
+
+#include "flatbuffers/flatbuffers.h"
+
+// Arena allocation for the object API. Code generated with
+// `flatc --gen-object-api --object-api-arena` allocates all of its strings,
+// vectors, tables and structs through an arena_allocator, which takes memory
+// from the calling thread's current Arena, if any:
+//
+//   flatbuffers::Arena arena;
+//   {
+//     flatbuffers::ArenaScope scope(&arena);
+//     auto monster = new MonsterT(GetMonster(buf));  // A few large blocks.
+//     ...
+//   }
+//   arena.Reset();  // Frees all of it at once, without running destructors.
+//
+// Outside of an ArenaScope these types simply use the heap. Objects may also
+// be destroyed as usual before the arena is reset, which frees nothing.
+
+namespace flatbuffers {
+
+// A monotonic ("bump pointer") allocator: allocations are carved from large
+// blocks, and never freed one by one. Reset() or destroying the arena frees
+// them all at once, after which anything allocated from it must no longer be
+// used, nor destroyed.
+class Arena {
+ public:
+  // Blocks start at `block_size` bytes, and double in size as the arena
+  // grows. `allocator` must outlive the arena.
+  explicit Arena(size_t block_size = 64 * 1024,
+                 const simple_allocator *allocator = nullptr)
+      : allocator_(allocator ? *allocator : default_allocator()),
+        blocks_(nullptr), cur_(nullptr), end_(nullptr),
+        block_size_(block_size), used_(0) {}
+
+  ~Arena() { FreeBlocks(nullptr); }
+
+  // `alignment` must be a power of 2.
+  void *Allocate(size_t size, size_t alignment) {
+    auto pad = PaddingBytes(reinterpret_cast<size_t>(cur_), alignment);
+    if (static_cast<size_t>(end_ - cur_) < pad + size) {
+      NewBlock(size + alignment);
+      pad = PaddingBytes(reinterpret_cast<size_t>(cur_), alignment);
+    }
+    auto p = cur_ + pad;
+    cur_ = p + size;
+    used_ += size;
+    return p;
+  }
+
+  // Frees everything allocated so far. The largest block is kept for reuse,
+  // so an arena that is reset between similar workloads soon stops
+  // allocating altogether.
+  void Reset() {
+    if (!blocks_) return;
+    FreeBlocks(blocks_);
+    blocks_->prev = nullptr;
+    cur_ = reinterpret_cast<uint8_t *>(blocks_ + 1);
+    used_ = 0;
+  }
+
+  // Bytes handed out since the last Reset().
+  size_t BytesUsed() const { return used_; }
+
+  // The arena ArenaScope made current on the calling thread, if any.
+  static Arena *Current() { return CurrentRef(); }
+
+ private:
+  friend class ArenaScope;
+
+  // You shouldn't copy an arena.
+  Arena(const Arena &);
+  Arena &operator=(const Arena &);
+
+  union Block {
+    Block *prev;
+    largest_scalar_t align;
+  };
+
+  static const simple_allocator &default_allocator() {
+    static simple_allocator allocator;
+    return allocator;
+  }
+
+  static Arena *&CurrentRef() {
+    static thread_local Arena *current = nullptr;
+    return current;
+  }
+
+  void NewBlock(size_t min_size) {
+    auto size = (std::max)(block_size_, min_size + sizeof(Block));
+    auto block = reinterpret_cast<Block *>(allocator_.allocate(size));
+    block->prev = blocks_;
+    blocks_ = block;
+    cur_ = reinterpret_cast<uint8_t *>(block + 1);
+    end_ = reinterpret_cast<uint8_t *>(block) + size;
+    block_size_ *= 2;
+  }
+
+  // Frees all blocks older than `keep`, or all of them.
+  void FreeBlocks(Block *keep) {
+    auto block = keep ? keep->prev : blocks_;
+    while (block) {
+      auto prev = block->prev;
+      allocator_.deallocate(reinterpret_cast<uint8_t *>(block));
+      block = prev;
+    }
+    if (!keep) blocks_ = nullptr;
+  }
+
+  const simple_allocator &allocator_;
+  Block *blocks_;  // The most recent (and largest) block.
+  uint8_t *cur_;
+  uint8_t *end_;
+  size_t block_size_;  // Of the next block.
+  size_t used_;
+};
+
+// Makes `arena` the calling thread's current arena while in scope. Scopes
+// may be nested.
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena *arena) : prev_(Arena::CurrentRef()) {
+    Arena::CurrentRef() = arena;
+  }
+  ~ArenaScope() { Arena::CurrentRef() = prev_; }
+
+ private:
+  ArenaScope(const ArenaScope &);
+  ArenaScope &operator=(const ArenaScope &);
+
+  Arena *prev_;
+};
+
+// Allocates `size` bytes from the current arena, or else the heap. Every
+// allocation is prefixed with the arena it came from (null for the heap), so
+// that it can be freed correctly from anywhere: freeing arena memory does
+// nothing. `alignment` must be a power of 2.
+struct ArenaHeader {
+  void *block;   // Where a heap allocation starts, to free it.
+  Arena *arena;
+};
+
+// The header must be aligned too, whatever the caller's `alignment`.
+inline size_t ArenaAlignment(size_t alignment) {
+  return (std::max)(alignment, AlignOf<ArenaHeader>());
+}
+
+inline size_t ArenaHeaderSize(size_t alignment) {
+  auto align = ArenaAlignment(alignment);
+  return (sizeof(ArenaHeader) + align - 1) & ~(align - 1);
+}
+
+inline void *ArenaAllocate(size_t size, size_t alignment) {
+  auto align = ArenaAlignment(alignment);
+  auto header = ArenaHeaderSize(alignment);
+  auto arena = Arena::Current();
+  void *block = nullptr;
+  uint8_t *p;
+  if (arena) {
+    p = static_cast<uint8_t *>(arena->Allocate(header + size, align)) +
+        header;
+  } else {
+    // operator new only guarantees the alignment of fundamental types.
+    block = ::operator new(header + size + align - 1);
+    auto start = reinterpret_cast<size_t>(block) + header;
+    p = reinterpret_cast<uint8_t *>(start + PaddingBytes(start, align));
+  }
+  auto h = reinterpret_cast<ArenaHeader *>(p) - 1;
+  h->block = block;
+  h->arena = arena;
+  return p;
+}
+
+inline void ArenaDeallocate(void *p, size_t /*alignment*/) {
+  if (!p) return;
+  auto h = reinterpret_cast<ArenaHeader *>(p) - 1;
+  if (!h->arena) ::operator delete(h->block);
+}
+
+// A stateless STL allocator on top of ArenaAllocate().
+template<typename T> class arena_allocator {
+ public:
+  typedef T value_type;
+  typedef T *pointer;
+  typedef const T *const_pointer;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+  template<typename U> struct rebind { typedef arena_allocator<U> other; };
+
+  arena_allocator() {}
+  template<typename U> arena_allocator(const arena_allocator<U> &) {}
+
+  T *allocate(size_t n, const void * /*hint*/ = nullptr) {
+    return static_cast<T *>(ArenaAllocate(n * sizeof(T), AlignOf<T>()));
+  }
+  void deallocate(T *p, size_t /*n*/) { ArenaDeallocate(p, AlignOf<T>()); }
+
+  size_t max_size() const { return ~static_cast<size_t>(0) / sizeof(T); }
+
+  bool operator==(const arena_allocator &) const { return true; }
+  bool operator!=(const arena_allocator &) const { return false; }
+};
+
+typedef std::basic_string<char, std::char_traits<char>, arena_allocator<char>>
+  arena_string;
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_ARENA_H_
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2016 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_CONTAINER_ALLOCATOR_H_
+#define FLATBUFFERS_CONTAINER_ALLOCATOR_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+#ifdef FLATBUFFERS_USE_QT
+# include <QByteArray>
+#endif
+
+// An allocator for FlatBufferBuilder that builds in a container the caller
+// owns, such as a std::vector<uint8_t>, std::string or QByteArray, so that
+// the finished buffer can be passed on in it without being copied out.
+
+namespace flatbuffers {
+
+// How container_allocator accesses a container: any with a contiguous
+// operator[] and resize() will do.
+template <typename Container>
+struct container_traits {
+  static uint8_t *data(Container &c) {
+    return reinterpret_cast<uint8_t *>(&c[0]);
+  }
+  static void resize(Container &c, size_t size) {
+    c.resize(static_cast<typename Container::size_type>(size));
+  }
+};
+
+#ifdef FLATBUFFERS_USE_QT
+template <>
+struct container_traits<QByteArray> {
+  static uint8_t *data(QByteArray &c) {
+    return reinterpret_cast<uint8_t *>(c.data());
+  }
+  static void resize(QByteArray &c, size_t size) { c.resize(int(size)); }
+};
+#endif
+
+// Keeps the builder's buffer in `container`, which it resizes as the buffer
+// grows (for a QByteArray, that may grow it in place). Only one buffer fits
+// in the container: any other the builder needs at the same time (e.g. with
+// chunked storage) comes from the heap. Whatever the container held before
+// is overwritten, but its capacity is reused.
+// Like any allocator passed to FlatBufferBuilder, it must outlive the
+// builder, and the container must not be touched while the builder uses it.
+template <typename Container>
+class container_allocator : public simple_allocator {
+ public:
+  typedef container_traits<Container> traits;
+
+  explicit container_allocator(Container &container)
+    : container_(container), block_(nullptr) {}
+
+  virtual uint8_t *allocate(size_t size) const {
+    if (block_) return simple_allocator::allocate(size);
+    traits::resize(container_, size);
+    block_ = traits::data(container_);
+    return block_;
+  }
+
+  virtual void deallocate(uint8_t *p) const {
+    if (p && p == block_) {
+      block_ = nullptr;  // The container keeps the memory.
+      return;
+    }
+    simple_allocator::deallocate(p);
+  }
+
+  virtual uint8_t *reallocate_downward(uint8_t *p, size_t old_size,
+                                       size_t new_size, size_t in_use) const {
+    if (!p || p != block_)
+      return simple_allocator::reallocate_downward(p, old_size, new_size,
+                                                   in_use);
+    traits::resize(container_, new_size);
+    block_ = traits::data(container_);
+    memmove(block_ + new_size - in_use, block_ + old_size - in_use, in_use);
+    return block_;
+  }
+
+  #ifndef FLATBUFFERS_CPP98_STL
+  // Leaves the finished buffer of `fbb`, which must use this allocator,
+  // exactly filling the container: it is moved down to the start of the
+  // container, in place, which is then shrunk to fit.
+  // @warning Do NOT attempt to use `fbb` afterwards, as with
+  // FlatBufferBuilder::ReleaseBufferPointer().
+  void release(FlatBufferBuilder &fbb) const {
+    auto size = fbb.GetSize();
+    auto buf = fbb.ReleaseBufferPointer();
+    if (block_ && buf.get() >= block_ &&
+        buf.get() < block_ + container_.size()) {
+      memmove(block_, buf.get(), size);
+      buf.reset();  // Only lets go of the container.
+      traits::resize(container_, size);
+    } else {
+      // The buffer is on the heap, e.g. flattened from chunks.
+      traits::resize(container_, size);
+      memcpy(traits::data(container_), buf.get(), size);
+    }
+  }
+  #endif
+
+ private:
+  Container &container_;
+  mutable uint8_t *block_;  // The container's data, while the builder has it.
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_CONTAINER_ALLOCATOR_H_
@@ -28,6 +28,7 @@
 #include <type_traits>
 #include <vector>
 #include <set>
+#include <unordered_map>
 #include <algorithm>
 #include <memory>
 
@@ -103,8 +104,25 @@
 #if (!defined(_MSC_VER) || _MSC_VER >= 1900) && \
     (!defined(__GNUC__) || (__GNUC__ * 100 + __GNUC_MINOR__ >= 406))
   #define FLATBUFFERS_CONSTEXPR constexpr
+  #define FLATBUFFERS_NOEXCEPT noexcept
 #else
   #define FLATBUFFERS_CONSTEXPR
+  #define FLATBUFFERS_NOEXCEPT
+#endif
+
+// The Verifier checks large vectors and strings with SIMD instructions where
+// the target supports them. Define FLATBUFFERS_NO_SIMD to always use the
+// scalar code instead.
+#if !defined(FLATBUFFERS_NO_SIMD) && FLATBUFFERS_LITTLEENDIAN
+  #if defined(__SSE2__) || defined(_M_X64) || \
+      (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define FLATBUFFERS_SSE2
+    #include <emmintrin.h>
+  #endif
+  #if defined(__AVX2__)
+    #define FLATBUFFERS_AVX2
+    #include <immintrin.h>
+  #endif
 #endif
 
 /// @endcond
@@ -122,6 +140,10 @@ namespace flatbuffers {
 // offset values between 32bit and 64bit systems.
 typedef uint32_t uoffset_t;
 
+// Offsets to (and lengths of) vectors in fields with the `offset64`
+// attribute, which may lie anywhere in a buffer larger than 4GB.
+typedef uint64_t uoffset64_t;
+
 // Signed offsets for references that can go in both directions.
 typedef int32_t soffset_t;
 
@@ -134,12 +156,69 @@ typedef uintmax_t largest_scalar_t;
 // In 32bits, this evaluates to 2GB - 1
 #define FLATBUFFERS_MAX_BUFFER_SIZE ((1ULL << (sizeof(soffset_t) * 8 - 1)) - 1)
 
+// The limit for buffers holding vectors with 64-bit offsets, of which
+// everything else must still fit in FLATBUFFERS_MAX_BUFFER_SIZE.
+#define FLATBUFFERS_MAX_64_BUFFER_SIZE (~static_cast<size_t>(0) >> 1)
+
 #ifndef FLATBUFFERS_CPP98_STL
 // Pointer to relinquished memory.
 typedef std::unique_ptr<uint8_t, std::function<void(uint8_t * /* unused */)>>
           unique_ptr_t;
 #endif
 
+/// @endcond
+
+/// @brief What the builder, `Verifier` and `Parser` did on a thread, for
+/// profiling. Only counted when `FLATBUFFERS_PERF_COUNTERS` is defined (for
+/// every file of the program), otherwise all counters stay 0 at no cost.
+/// See `GetPerfCounters()` and `ResetPerfCounters()`.
+struct PerfCounters {
+  PerfCounters()
+    : reallocations(0), bytes_copied(0), padding_bytes(0), vtables_emitted(0),
+      vtables_deduplicated(0), shared_string_hits(0), tables_verified(0),
+      bytes_verified(0), tokens_parsed(0), parser_allocations(0) {}
+  size_t reallocations;         // Builder buffers grown (or chunks added).
+  size_t bytes_copied;          // Data moved along when they did.
+  size_t padding_bytes;         // Written by the builder to align data.
+  size_t vtables_emitted;       // New vtables written by the builder.
+  size_t vtables_deduplicated;  // Tables that reused an existing vtable.
+  size_t shared_string_hits;    // CreateSharedString() calls that reused.
+  size_t tables_verified;       // Tables checked by a Verifier.
+  size_t bytes_verified;        // Sum of the ranges it bounds checked.
+  size_t tokens_parsed;         // Schema and JSON tokens read by a Parser.
+  size_t parser_allocations;    // Definitions and attributes it allocated.
+};
+
+/// @cond FLATBUFFERS_INTERNAL
+#ifdef FLATBUFFERS_PERF_COUNTERS
+  inline PerfCounters &ThreadPerfCounters() {
+    static thread_local PerfCounters counters;
+    return counters;
+  }
+  #define FLATBUFFERS_PERF_COUNT(counter, n) \
+    (flatbuffers::ThreadPerfCounters().counter += (n))
+#else
+  #define FLATBUFFERS_PERF_COUNT(counter, n) ((void)0)
+#endif
+/// @endcond
+
+/// @brief A snapshot of the counters of the calling thread.
+inline PerfCounters GetPerfCounters() {
+  #ifdef FLATBUFFERS_PERF_COUNTERS
+    return ThreadPerfCounters();
+  #else
+    return PerfCounters();
+  #endif
+}
+
+/// @brief Zero the counters of the calling thread.
+inline void ResetPerfCounters() {
+  #ifdef FLATBUFFERS_PERF_COUNTERS
+    ThreadPerfCounters() = PerfCounters();
+  #endif
+}
+
+/// @cond FLATBUFFERS_INTERNAL
 // Wrapper for uoffset_t to allow safe template specialization.
 template<typename T> struct Offset {
   uoffset_t o;
@@ -148,6 +227,13 @@ template<typename T> struct Offset {
   Offset<void> Union() const { return Offset<void>(o); }
 };
 
+// Like Offset, for vectors with 64-bit offsets (see Vector64).
+template<typename T> struct Offset64 {
+  uoffset64_t o;
+  Offset64() : o(0) {}
+  Offset64(uoffset64_t _o) : o(_o) {}
+};
+
 inline void EndianCheck() {
   int endiantest = 1;
   // If this fails, see FLATBUFFERS_LITTLEENDIAN above.
@@ -310,6 +396,72 @@ private:
   const uint8_t *data_;
 };
 
+/// @cond FLATBUFFERS_INTERNAL
+// Index of the lowest set bit, x must not be 0.
+inline int CountTrailingZeros(uint32_t x) {
+  #if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(x);
+  #else
+    int n = 0;
+    while (!(x & 1)) { x >>= 1; n++; }
+    return n;
+  #endif
+}
+
+// Index of the highest set bit, x must not be 0.
+inline int FloorLog2(uint64_t x) {
+  #if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(x);
+  #else
+    int n = 0;
+    while (x >>= 1) n++;
+    return n;
+  #endif
+}
+
+// Key indices (see FlatBufferBuilder::CreateKeyIndex) hold the keys of a
+// sorted vector of tables in Eytzinger order: a binary tree stored breadth
+// first, where node k (1-based) is at index k - 1 and has children 2k and
+// 2k + 1. A search walks down from the root, so the first few levels stay
+// cached, and it needs no indirections to reach the keys.
+
+// Fills the tree of n nodes with sorted_key(0) .. sorted_key(n - 1), by an
+// in-order walk of the subtree at node k, starting from sorted index i.
+// Returns the next sorted index.
+template<typename K, typename F> size_t EytzingerFill(F sorted_key, K *tree,
+                                                      size_t n, size_t i = 0,
+                                                      size_t k = 1) {
+  if (k <= n) {
+    i = EytzingerFill(sorted_key, tree, n, i, 2 * k);
+    tree[k - 1] = sorted_key(i++);
+    i = EytzingerFill(sorted_key, tree, n, i, 2 * k + 1);
+  }
+  return i;
+}
+
+// The number of nodes in the subtree at node k of a tree of n nodes.
+inline size_t EytzingerSubtreeSize(size_t k, size_t n) {
+  if (k > n) return 0;
+  // All levels from k's down to the last but one are full, the last level
+  // (of the whole tree) holds whatever part of k's span is <= n.
+  auto height = FloorLog2(n) - FloorLog2(k);
+  auto span = static_cast<size_t>(1) << height;
+  auto first = k << height;
+  return span - 1 + (first > n ? 0 : std::min(n - first + 1, span));
+}
+
+// The sorted index of node k of a tree of n nodes: the number of nodes that
+// come before it in an in-order walk.
+inline size_t EytzingerRank(size_t k, size_t n) {
+  auto rank = EytzingerSubtreeSize(2 * k, n);
+  for (; k > 1; k >>= 1) {
+    // A right child comes after its parent and its left sibling's subtree.
+    if (k & 1) rank += EytzingerSubtreeSize(k - 1, n) + 1;
+  }
+  return rank;
+}
+/// @endcond
+
 // This is used as a helper type for accessing vectors.
 // Vector::data() assumes the vector elements start after the length field.
 template<typename T> class Vector {
@@ -387,17 +539,59 @@ public:
   const T *data() const { return reinterpret_cast<const T *>(Data()); }
   T *data() { return reinterpret_cast<T *>(Data()); }
 
+  // Binary search in a vector of tables sorted by their key (see
+  // FlatBufferBuilder::CreateVectorOfSortedTables), returns nullptr if not
+  // found.
   template<typename K> return_type LookupByKey(K key) const {
-    void *search_result = std::bsearch(&key, Data(), size(),
-        IndirectHelper<T>::element_stride, KeyCompare<K>);
-
-    if (!search_result) {
-      return nullptr;  // Key not found.
+    auto n = size();
+    if (!n) return nullptr;
+    uoffset_t base = 0;
+    // Each step halves the range without branching on the comparison, which
+    // would mispredict half the time. To not wait on every load in turn,
+    // both tables the next step may look at are prefetched.
+    while (n > 1) {
+      auto half = n / 2;
+      #if defined(__GNUC__) || defined(__clang__)
+      // Load both tables the next step may look at while comparing.
+      __builtin_prefetch(Get(base + half / 2));
+      __builtin_prefetch(Get(base + half + half / 2));
+      #endif
+      base = Get(base + half)->KeyCompareWithValue(key) < 0 ? base + half
+                                                             : base;
+      n -= half;
     }
-
-    const uint8_t *element = reinterpret_cast<const uint8_t *>(search_result);
-
-    return IndirectHelper<T>::Read(element, 0);
+    auto table = Get(base);
+    auto cmp = table->KeyCompareWithValue(key);
+    if (cmp < 0) {
+      if (base + 1 == size()) return nullptr;
+      table = Get(base + 1);
+      cmp = table->KeyCompareWithValue(key);
+    }
+    return cmp ? nullptr : table;
+  }
+
+  // As LookupByKey, but searches `index`, which must have been created for
+  // this vector by FlatBufferBuilder::CreateKeyIndex. Only the table that is
+  // found gets accessed.
+  // (The key type is deduced from the index only, so e.g. literals work.)
+  template<typename K> return_type LookupByKeyIndex(
+      const Vector<K> *index, typename std::remove_cv<K>::type key) const {
+    size_t n = index->size();
+    assert(n == size());
+    size_t k = 1;
+    while (k <= n) {
+      #if defined(__GNUC__) || defined(__clang__)
+      // The 16 descendants 4 levels down are next to each other, so this
+      // loads the keys of the next few steps before they're needed.
+      __builtin_prefetch(index->data() + 16 * k);
+      #endif
+      k = 2 * k + (index->Get(static_cast<uoffset_t>(k - 1)) < key);
+    }
+    // The first key not less than `key` is where the walk last went left:
+    // drop the trailing right turns (1 bits) and that left turn.
+    k >>= CountTrailingZeros(static_cast<uint32_t>(~k)) + 1;
+    if (!k || index->Get(static_cast<uoffset_t>(k - 1)) != key) return nullptr;
+    return Get(static_cast<uoffset_t>(EytzingerRank(k, n)));
   }
 
 protected:
@@ -406,17 +600,68 @@ protected:
   Vector();
 
   uoffset_t length_;
+};
 
-private:
-  template<typename K> static int KeyCompare(const void *ap, const void *bp) {
-    const K *key = reinterpret_cast<const K *>(ap);
-    const uint8_t *data = reinterpret_cast<const uint8_t *>(bp);
-    auto table = IndirectHelper<T>::Read(data, 0);
+// A vector of scalars or structs with a 64-bit length, referred to by a
+// 64-bit offset from a field with the `offset64` attribute, such that it may
+// lie beyond the first 4GB of a buffer (see
+// FlatBufferBuilder::CreateVector64). Accessed much like Vector above.
+template<typename T> class Vector64 {
+public:
+  typedef VectorIterator<T, typename IndirectHelper<T>::mutable_return_type>
+    iterator;
+  typedef VectorIterator<T, typename IndirectHelper<T>::return_type>
+    const_iterator;
+
+  uoffset64_t size() const { return EndianScalar(length_); }
+
+  typedef typename IndirectHelper<T>::return_type return_type;
+
+  return_type Get(uoffset64_t i) const {
+    assert(i < size());
+    return IndirectHelper<T>::Read(Data() + i * kStride, 0);
+  }
+
+  return_type operator[](uoffset64_t i) const { return Get(i); }
 
-    // std::bsearch compares with the operands transposed, so we negate the
-    // result here.
-    return -table->KeyCompareWithValue(*key);
+  const void *GetStructFromOffset(size_t o) const {
+    return reinterpret_cast<const void *>(Data() + o);
+  }
+
+  iterator begin() { return iterator(Data(), 0); }
+  const_iterator begin() const { return const_iterator(Data(), 0); }
+
+  iterator end() { return iterator(Data() + size() * kStride, 0); }
+  const_iterator end() const {
+    return const_iterator(Data() + size() * kStride, 0);
+  }
+
+  // Change elements if you have a non-const pointer to this object.
+  // Scalars only.
+  void Mutate(uoffset64_t i, const T& val) {
+    assert(i < size());
+    WriteScalar(data() + i, val);
+  }
+
+  // The raw data in little endian format. Use with care.
+  const uint8_t *Data() const {
+    return reinterpret_cast<const uint8_t *>(&length_ + 1);
+  }
+
+  uint8_t *Data() {
+    return reinterpret_cast<uint8_t *>(&length_ + 1);
   }
+
+  const T *data() const { return reinterpret_cast<const T *>(Data()); }
+  T *data() { return reinterpret_cast<T *>(Data()); }
+
+protected:
+  // Like Vector, only used to access pre-existing data.
+  Vector64();
+
+  static const size_t kStride = IndirectHelper<T>::element_stride;
+
+  uoffset64_t length_;
 };
 
 // Represent a vector much like the template above, but in this case we
@@ -459,40 +704,130 @@ class simple_allocator {
   virtual ~simple_allocator() {}
   virtual uint8_t *allocate(size_t size) const { return new uint8_t[size]; }
   virtual void deallocate(uint8_t *p) const { delete[] p; }
+
+  // Grows `p`, of `old_size` bytes, to `new_size`, keeping the `in_use` bytes
+  // at its end at the end (where vector_downward keeps its data).
+  virtual uint8_t *reallocate_downward(uint8_t *p, size_t old_size,
+                                       size_t new_size, size_t in_use) const {
+    auto new_p = allocate(new_size);
+    memcpy(new_p + new_size - in_use, p + old_size - in_use, in_use);
+    deallocate(p);
+    return new_p;
+  }
+};
+
+// A contiguous piece of a (finished) buffer, see
+// FlatBufferBuilder::GetBufferSlices().
+struct BufferSlice {
+  const uint8_t *data;
+  size_t size;
 };
 
 // This is a minimal replication of std::vector<uint8_t> functionality,
 // except growing from higher to lower addresses. i.e push_back() inserts data
 // in the lowest address in the vector.
+// Optionally (see set_chunk_size()), the storage can instead be a chain of
+// chunks, such that growing never copies the data written so far. Only the
+// object currently being written (see begin_object()) is moved to the new
+// chunk, so every string, vector and table stays contiguous in memory.
 class vector_downward {
  public:
+  // The size of the storage is kept a multiple of the largest alignment
+  // force_align allows, so that a finished buffer is as aligned in memory as
+  // its contents require (given an allocator that aligns that much).
+  static const size_t kBufferAlign = 16;
+
   explicit vector_downward(size_t initial_size,
-                           const simple_allocator &allocator)
-    : reserved_(initial_size),
+                           const simple_allocator &allocator,
+                           size_t max_size = FLATBUFFERS_MAX_BUFFER_SIZE)
+    : reserved_((initial_size + kBufferAlign - 1) & ~(kBufferAlign - 1)),
       buf_(allocator.allocate(reserved_)),
       cur_(buf_ + reserved_),
-      allocator_(allocator) {
+      top_(cur_),
+      allocator_(allocator),
+      chunk_size_(0),
+      sealed_size_(0),
+      object_start_(0),
+      in_object_(false),
+      max_size_(max_size) {
     assert((initial_size & (sizeof(largest_scalar_t) - 1)) == 0);
   }
 
   ~vector_downward() {
     if (buf_)
       allocator_.deallocate(buf_);
+    free_chunks();
   }
 
   void clear() {
+    free_chunks();
     if (buf_ == nullptr)
       buf_ = allocator_.allocate(reserved_);
 
-    cur_ = buf_ + reserved_;
+    top_ = buf_ + reserved_;
+    cur_ = top_;
+    in_object_ = false;
+  }
+
+  // Switch to chunked storage, allocating chunks of (at least) `chunk_size`
+  // bytes whenever the current one is full. 0 selects contiguous storage.
+  void set_chunk_size(size_t chunk_size) {
+    chunk_size_ = (chunk_size + (sizeof(largest_scalar_t) - 1)) &
+                  ~(sizeof(largest_scalar_t) - 1);
+  }
+
+  size_t chunk_size() const { return chunk_size_; }
+
+  // Chunked storage only: mark the start of an object that must remain
+  // contiguous, until end_object() is called.
+  void begin_object() { object_start_ = size(); in_object_ = true; }
+  void end_object() { in_object_ = false; }
+
+  // The number of chunks the data is spread over.
+  size_t num_chunks() const { return chunks_.size() + 1; }
+
+  // The data, in memory order, as a list of contiguous pieces.
+  std::vector<BufferSlice> slices() const {
+    std::vector<BufferSlice> s;
+    BufferSlice cur = { cur_, static_cast<size_t>(top_ - cur_) };
+    s.push_back(cur);
+    for (auto it = chunks_.rbegin(); it != chunks_.rend(); ++it) {
+      BufferSlice chunk = { it->data, it->size };
+      s.push_back(chunk);
+    }
+    return s;
+  }
+
+  // Copy the data out of all chunks into a single contiguous allocation.
+  void flatten() {
+    if (chunks_.empty()) return;
+    auto old_size = size();
+    auto new_reserved = (old_size + (kBufferAlign - 1)) & ~(kBufferAlign - 1);
+    auto new_buf = allocator_.allocate(new_reserved);
+    auto dest = new_buf + new_reserved - old_size;
+    auto s = slices();
+    for (auto it = s.begin(); it != s.end(); ++it) {
+      memcpy(dest, it->data, it->size);
+      dest += it->size;
+    }
+    FLATBUFFERS_PERF_COUNT(reallocations, 1);
+    FLATBUFFERS_PERF_COUNT(bytes_copied, old_size);
+    allocator_.deallocate(buf_);
+    free_chunks();
+    reserved_ = new_reserved;
+    buf_ = new_buf;
+    top_ = buf_ + reserved_;
+    cur_ = top_ - old_size;
   }
 
   #ifndef FLATBUFFERS_CPP98_STL
   // Relinquish the pointer to the caller.
   unique_ptr_t release() {
-    // Actually deallocate from the start of the allocated memory.
+    flatten();
+    // Actually deallocate from the start of the allocated memory, through
+    // the allocator itself (not a copy of it), so overrides get called.
     std::function<void(uint8_t *)> deleter(
-      std::bind(&simple_allocator::deallocate, allocator_, buf_));
+      std::bind(&simple_allocator::deallocate, &allocator_, buf_));
 
     // Point to the desired offset.
     unique_ptr_t retval(data(), deleter);
@@ -511,28 +846,43 @@ class vector_downward {
 
   uint8_t *make_space(size_t len) {
     if (len > static_cast<size_t>(cur_ - buf_)) {
-      auto old_size = size();
-      auto largest_align = AlignOf<largest_scalar_t>();
-      reserved_ += (std::max)(len, growth_policy(reserved_));
-      // Round up to avoid undefined behavior from unaligned loads and stores.
-      reserved_ = (reserved_ + (largest_align - 1)) & ~(largest_align - 1);
-      auto new_buf = allocator_.allocate(reserved_);
-      auto new_cur = new_buf + reserved_ - old_size;
-      memcpy(new_cur, cur_, old_size);
-      cur_ = new_cur;
-      allocator_.deallocate(buf_);
-      buf_ = new_buf;
+      if (chunk_size_) {
+        new_chunk(len);
+      } else {
+        auto old_size = size();
+        auto old_reserved = reserved_;
+        reserved_ += (std::max)(len, growth_policy(reserved_));
+        // Round up to avoid undefined behavior from unaligned loads and stores.
+        reserved_ = (reserved_ + (kBufferAlign - 1)) & ~(kBufferAlign - 1);
+        grow(old_reserved, old_size);
+      }
     }
     cur_ -= len;
     // Beyond this, signed offsets may not have enough range:
-    // (FlatBuffers > 2GB not supported).
-    assert(size() < FLATBUFFERS_MAX_BUFFER_SIZE);
+    // (FlatBuffers > 2GB not supported, other than through 64-bit offsets).
+    assert(size() < max_size_);
     return cur_;
   }
 
-  uoffset_t size() const {
+  // Make sure the next `len` bytes fit without growing the buffer (or, with
+  // chunked storage, without starting another chunk).
+  void reserve(size_t len) {
+    auto free = static_cast<size_t>(cur_ - buf_);
+    if (len <= free) return;
+    if (chunk_size_) {
+      new_chunk(len);
+      return;
+    }
+    auto old_size = size();
+    auto old_reserved = reserved_;
+    reserved_ = (reserved_ + len - free + (kBufferAlign - 1)) &
+                ~(kBufferAlign - 1);
+    grow(old_reserved, old_size);
+  }
+
+  size_t size() const {
     assert(cur_ != nullptr && buf_ != nullptr);
-    return static_cast<uoffset_t>(reserved_ - (cur_ - buf_));
+    return sealed_size_ + static_cast<size_t>(top_ - cur_);
   }
 
   uint8_t *data() const {
@@ -540,7 +890,17 @@ class vector_downward {
     return cur_;
   }
 
-  uint8_t *data_at(size_t offset) const { return buf_ + reserved_ - offset; }
+  uint8_t *data_at(size_t offset) const {
+    if (offset > sealed_size_) return top_ - (offset - sealed_size_);
+    // Find the chunk holding this offset.
+    size_t lo = 0, hi = chunks_.size();
+    while (hi - lo > 1) {
+      auto mid = (lo + hi) / 2;
+      if (chunks_[mid].start < offset) lo = mid; else hi = mid;
+    }
+    auto &chunk = chunks_[lo];
+    return chunk.data + chunk.size - (offset - chunk.start);
+  }
 
   // push() & fill() are most frequently called with small byte counts (<= 4),
   // which is why we're using loops rather than calling memcpy/memset.
@@ -554,17 +914,99 @@ class vector_downward {
     for (size_t i = 0; i < zero_pad_bytes; i++) dest[i] = 0;
   }
 
-  void pop(size_t bytes_to_remove) { cur_ += bytes_to_remove; }
+  void pop(size_t bytes_to_remove) {
+    // Only data in the current chunk can be removed.
+    assert(bytes_to_remove <= static_cast<size_t>(top_ - cur_));
+    cur_ += bytes_to_remove;
+  }
+
+  // Exchange the data (but not the settings) with `other`, which must use
+  // the same allocator.
+  void swap(vector_downward &other) {
+    assert(&allocator_ == &other.allocator_);
+    std::swap(reserved_, other.reserved_);
+    std::swap(buf_, other.buf_);
+    std::swap(cur_, other.cur_);
+    std::swap(top_, other.top_);
+    chunks_.swap(other.chunks_);
+    std::swap(sealed_size_, other.sealed_size_);
+    std::swap(object_start_, other.object_start_);
+    std::swap(in_object_, other.in_object_);
+  }
+
+  const simple_allocator &allocator() const { return allocator_; }
 
  private:
   // You shouldn't really be copying instances of this class.
   vector_downward(const vector_downward &);
   vector_downward &operator=(const vector_downward &);
 
+  // A full chunk, holding the offsets (start, start + size].
+  struct Chunk {
+    uint8_t *buf;
+    uint8_t *data;
+    size_t size;
+    size_t start;
+  };
+
+  // Move the contiguous buffer, of `old_reserved` bytes holding `old_size`,
+  // to one of reserved_ bytes.
+  void grow(size_t old_reserved, size_t old_size) {
+    buf_ = allocator_.reallocate_downward(buf_, old_reserved, reserved_,
+                                          old_size);
+    FLATBUFFERS_PERF_COUNT(reallocations, 1);
+    FLATBUFFERS_PERF_COUNT(bytes_copied, old_size);
+    top_ = buf_ + reserved_;
+    cur_ = top_ - old_size;
+  }
+
+  // Seal the current chunk and continue in a new one that has room for `len`
+  // bytes plus the unfinished object, which is moved along.
+  void new_chunk(size_t len) {
+    auto moved = in_object_ ? size() - object_start_ : 0;
+    assert(moved <= static_cast<size_t>(top_ - cur_));
+    Chunk chunk = { buf_, cur_ + moved,
+                    static_cast<size_t>(top_ - cur_) - moved, sealed_size_ };
+    // Leave a gap at the top of the new chunk such that data keeps the same
+    // alignment it would have in a contiguous buffer.
+    auto gap = (chunk.start + chunk.size) & (kBufferAlign - 1);
+    auto needed = len + moved + gap;
+    reserved_ = (std::max)(chunk_size_, needed);
+    reserved_ = (reserved_ + (kBufferAlign - 1)) & ~(kBufferAlign - 1);
+    auto new_buf = allocator_.allocate(reserved_);
+    auto new_top = new_buf + reserved_ - gap;
+    memcpy(new_top - moved, cur_, moved);
+    FLATBUFFERS_PERF_COUNT(reallocations, 1);
+    FLATBUFFERS_PERF_COUNT(bytes_copied, moved);
+    if (chunk.size) {
+      chunks_.push_back(chunk);
+      sealed_size_ += chunk.size;
+    } else {
+      allocator_.deallocate(buf_);
+    }
+    buf_ = new_buf;
+    top_ = new_top;
+    cur_ = new_top - moved;
+  }
+
+  void free_chunks() {
+    for (auto it = chunks_.begin(); it != chunks_.end(); ++it)
+      allocator_.deallocate(it->buf);
+    chunks_.clear();
+    sealed_size_ = 0;
+  }
+
   size_t reserved_;
   uint8_t *buf_;
   uint8_t *cur_;  // Points at location between empty (below) and used (above).
+  uint8_t *top_;  // End of the used data in the current chunk.
   const simple_allocator &allocator_;
+  size_t chunk_size_;  // 0 for a contiguous buffer.
+  std::vector<Chunk> chunks_;  // Full chunks, oldest first.
+  size_t sealed_size_;  // Total size of all chunks_.
+  size_t object_start_;  // Offset the unfinished object starts at.
+  bool in_object_;
+  size_t max_size_;
 };
 
 // Converts a Field ID to a virtual table offset.
@@ -581,9 +1023,175 @@ inline size_t PaddingBytes(size_t buf_size, size_t scalar_size) {
   return ((~buf_size) + 1) & (scalar_size - 1);
 }
 
-template <typename T> const T* data(const std::vector<T> &v) {
+template <typename T, typename Alloc> const T* data(
+    const std::vector<T, Alloc> &v) {
   return v.empty() ? nullptr : &v.front();
 }
+
+// 32bit FNV-1a over a range of bytes, used to index data that was already
+// serialized into the buffer (see hash.h for the general purpose versions).
+inline uint32_t HashBytes(const uint8_t *bytes, size_t len) {
+  uint32_t hash = 0x811C9DC5;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+/// @endcond
+
+// Interface to a thread pool that the Verifier and FlatBufferBuilder can hand
+// work to, so that large vectors get verified or sorted in parallel. See
+// work_stealing_pool.h for an implementation.
+class TaskRunner {
+ public:
+  virtual ~TaskRunner() {}
+
+  // How many tasks can usefully run at the same time.
+  virtual size_t Concurrency() const = 0;
+
+  // Calls fn(ctx, i) for every i in [0, num_tasks), possibly concurrently,
+  // and returns once all calls have returned. May be called from within fn.
+  virtual void ForEach(size_t num_tasks, void (*fn)(void *ctx, size_t i),
+                       void *ctx) = 0;
+};
+
+/// @cond FLATBUFFERS_INTERNAL
+// CreateVectorOfSortedTables reads the key of every table once, and sorts
+// these keys along with the table offsets, rather than comparing tables.
+
+// Map scalar keys to unsigned integers in the same order, for radix sorting.
+inline uint8_t RadixKey(bool k) { return k; }
+inline uint8_t RadixKey(uint8_t k) { return k; }
+inline uint8_t RadixKey(int8_t k) { return static_cast<uint8_t>(k) ^ 0x80; }
+inline uint16_t RadixKey(uint16_t k) { return k; }
+inline uint16_t RadixKey(int16_t k) {
+  return static_cast<uint16_t>(k) ^ 0x8000;
+}
+inline uint32_t RadixKey(uint32_t k) { return k; }
+inline uint32_t RadixKey(int32_t k) {
+  return static_cast<uint32_t>(k) ^ 0x80000000;
+}
+inline uint64_t RadixKey(uint64_t k) { return k; }
+inline uint64_t RadixKey(int64_t k) {
+  return static_cast<uint64_t>(k) ^ 0x8000000000000000ULL;
+}
+// Negative floats have the sign bit set and sort in reverse, so flip all of
+// their bits. Adding 0 turns -0 into 0, which compares equal to it.
+inline uint32_t RadixKey(float k) {
+  k += 0.0f;
+  uint32_t u;
+  memcpy(&u, &k, sizeof(u));
+  return u & 0x80000000 ? ~u : u | 0x80000000;
+}
+inline uint64_t RadixKey(double k) {
+  k += 0.0;
+  uint64_t u;
+  memcpy(&u, &k, sizeof(u));
+  return u & 0x8000000000000000ULL ? ~u : u | 0x8000000000000000ULL;
+}
+
+// The type of a table's key, or void for tables generated without GetKey(),
+// which are sorted by comparing them with KeyCompareLessThan() instead.
+template<typename T, typename = void> struct TableKeyType {
+  typedef void type;
+};
+template<typename T> struct TableKeyType<
+    T, decltype(void(std::declval<const T &>().GetKey()))> {
+  typedef decltype(std::declval<const T &>().GetKey()) type;
+};
+
+template<typename K> struct KeyedOffset {
+  K key;
+  uoffset_t off;
+};
+
+// Stable LSD radix sort, a byte at a time. Bytes that are the same in all
+// keys (e.g. the high bytes of small ids) are skipped.
+template<typename K> void RadixSort(std::vector<KeyedOffset<K>> *v) {
+  if (v->size() < 2) return;
+  std::vector<KeyedOffset<K>> tmp(v->size());
+  for (size_t shift = 0; shift < sizeof(K) * 8; shift += 8) {
+    size_t pos[257] = { 0 };
+    for (size_t i = 0; i < v->size(); i++) {
+      pos[(((*v)[i].key >> shift) & 0xFF) + 1]++;
+    }
+    if (pos[(((*v)[0].key >> shift) & 0xFF) + 1] == v->size()) continue;
+    for (size_t b = 1; b < 256; b++) pos[b] += pos[b - 1];
+    for (size_t i = 0; i < v->size(); i++) {
+      tmp[pos[((*v)[i].key >> shift) & 0xFF]++] = (*v)[i];
+    }
+    v->swap(tmp);
+  }
+}
+
+// A string key, with its first 8 bytes (or up to the terminator) packed into
+// an integer, so most comparisons don't need to touch the string itself.
+struct StringKeyedOffset {
+  uint64_t prefix;
+  const char *str;
+  uoffset_t off;
+
+  StringKeyedOffset() {}
+  StringKeyedOffset(const String *s, uoffset_t o)
+      : prefix(0), str(s->c_str()), off(o) {
+    for (size_t i = 0; i < 8; i++) {
+      prefix <<= 8;
+      if (str[i]) prefix |= static_cast<uint8_t>(str[i]);
+      else { prefix <<= 8 * (7 - i); break; }
+    }
+  }
+
+  // Same order as String::operator<.
+  bool operator<(const StringKeyedOffset &o) const {
+    if (prefix != o.prefix) return prefix < o.prefix;
+    // Equal prefixes without a terminator mean the first 8 bytes are equal.
+    return (prefix & 0xFF) && strcmp(str + 8, o.str + 8) < 0;
+  }
+};
+
+// Stable merge sort: `runner` sorts parts of at least `min_per_task` elements
+// in parallel, then merges them pairwise in parallel rounds.
+template<typename T> void ParallelStableSort(std::vector<T> *v,
+                                             TaskRunner *runner,
+                                             size_t min_per_task) {
+  size_t parts = runner ? std::min(runner->Concurrency(),
+                                   v->size() / min_per_task) : 1;
+  if (parts < 2) {
+    std::stable_sort(v->begin(), v->end());
+    return;
+  }
+  struct Sort {
+    std::vector<T> *v;
+    std::vector<T> tmp;
+    size_t parts;
+    size_t width;  // How many of the original parts are merged already.
+
+    size_t Begin(size_t part) const {
+      return std::min(part, parts) * v->size() / parts;
+    }
+    static void SortPart(void *ctx, size_t i) {
+      auto &s = *reinterpret_cast<Sort *>(ctx);
+      std::stable_sort(s.v->begin() + s.Begin(i), s.v->begin() + s.Begin(i + 1));
+    }
+    static void MergeParts(void *ctx, size_t i) {
+      auto &s = *reinterpret_cast<Sort *>(ctx);
+      auto begin = s.v->begin();
+      auto a = s.Begin(2 * i * s.width), b = s.Begin((2 * i + 1) * s.width),
+           c = s.Begin((2 * i + 2) * s.width);
+      std::merge(begin + a, begin + b, begin + b, begin + c, s.tmp.begin() + a);
+    }
+  } sort;
+  sort.v = v;
+  sort.tmp.resize(v->size());
+  sort.parts = parts;
+  runner->ForEach(parts, Sort::SortPart, &sort);
+  for (sort.width = 1; sort.width < parts; sort.width *= 2) {
+    runner->ForEach((parts + 2 * sort.width - 1) / (2 * sort.width),
+                    Sort::MergeParts, &sort);
+    v->swap(sort.tmp);
+  }
+}
 /// @endcond
 
 /// @addtogroup flatbuffers_cpp_api
@@ -606,20 +1214,22 @@ FLATBUFFERS_FINAL_CLASS
   /// to`1024`.
   /// @param[in] allocator A pointer to the `simple_allocator` that should be
   /// used. Defaults to `nullptr`, which means the `default_allocator` will be
-  /// be used.
+  /// be used. A custom allocator must outlive this builder, as well as any
+  /// buffer obtained through `ReleaseBufferPointer()`.
   explicit FlatBufferBuilder(uoffset_t initial_size = 1024,
                              const simple_allocator *allocator = nullptr)
-      : buf_(initial_size, allocator ? *allocator : default_allocator),
-        nested(false), finished(false), minalign_(1), force_defaults_(false),
-        string_pool(nullptr) {
+      : buf_(initial_size, allocator ? *allocator : default_allocator()),
+        nested(false), finished(false), size_prefixed_(false),
+        num_vtables_(0), minalign_(1),
+        force_defaults_(false), num_strings_(0), max_strings_(0),
+        clock_hand_(0), runner_(nullptr), min_keys_per_task_(16384),
+        wide_buf_(nullptr), wide_minalign_(1) {
     offsetbuf_.reserve(16);  // Avoid first few reallocs.
-    vtables_.reserve(16);
+    vtables_.resize(32);
     EndianCheck();
   }
 
-  ~FlatBufferBuilder() {
-    if (string_pool) delete string_pool;
-  }
+  ~FlatBufferBuilder() { delete wide_buf_; }
 
   /// @brief Reset all the state in this FlatBufferBuilder so it can be reused
   /// to construct another buffer.
@@ -628,23 +1238,87 @@ FLATBUFFERS_FINAL_CLASS
     offsetbuf_.clear();
     nested = false;
     finished = false;
-    vtables_.clear();
+    size_prefixed_ = false;
+    // Keep the index allocated, it is most likely going to be needed again.
+    std::fill(vtables_.begin(), vtables_.end(), VTableSlot());
+    num_vtables_ = 0;
     minalign_ = 1;
-    if (string_pool) string_pool->clear();
+    std::fill(string_pool_.begin(), string_pool_.end(), StringSlot());
+    num_strings_ = 0;
+    clock_hand_ = 0;
+    copied_strings_.clear();
+    if (wide_buf_) wide_buf_->clear();
+    wide_minalign_ = 1;
+    offset64_fields_.clear();
   }
 
   /// @brief The current size of the serialized buffer, counting from the end.
+  /// Until `Finish()`, vectors with 64-bit offsets are not included, as they
+  /// are kept apart (see `CreateVector64()`). Finished buffers beyond 4GB
+  /// must be accessed through `GetBufferSlices()` and `GetSize64()`.
   /// @return Returns an `uoffset_t` with the current size of the buffer.
-  uoffset_t GetSize() const { return buf_.size(); }
+  uoffset_t GetSize() const {
+    assert(buf_.size() <= static_cast<uoffset_t>(~0u));
+    return static_cast<uoffset_t>(buf_.size());
+  }
+
+  /// @brief Like `GetSize()`, for buffers that may exceed 4GB once finished.
+  /// @return Returns an `uoffset64_t` with the current size of the buffer.
+  uoffset64_t GetSize64() const { return buf_.size(); }
 
   /// @brief Get the serialized buffer (after you call `Finish()`).
   /// @return Returns an `uint8_t` pointer to the FlatBuffer data inside the
   /// buffer.
   uint8_t *GetBufferPointer() const {
     Finished();
+    // With chunked storage, use GetBufferSlices() or call FlattenBuffer()
+    // first.
+    assert(buf_.num_chunks() == 1);
     return buf_.data();
   }
 
+  /// @brief Get the serialized buffer (after you call `Finish()`) as a list
+  /// of contiguous pieces, in memory order, e.g. for use with `writev()`.
+  /// @return Returns a single slice, unless `SetChunkSize()` was used.
+  std::vector<BufferSlice> GetBufferSlices() const {
+    Finished();
+    return buf_.slices();
+  }
+
+  /// @brief Store the buffer in a single contiguous allocation, if it is
+  /// spread over multiple chunks (see `SetChunkSize()`). This copies the
+  /// data once, afterwards `GetBufferPointer()` can be used.
+  void FlattenBuffer() { buf_.flatten(); }
+
+  /// @brief Instead of reallocating (and copying) the buffer whenever it
+  /// grows, continue in a new chunk of at least `chunk_size` bytes.
+  /// Use `GetBufferSlices()` to access the result without copying it.
+  /// @param[in] chunk_size The chunk size in bytes, or `0` to go back to a
+  /// single contiguous buffer (the default).
+  /// @warning `CreateVectorOfSortedTables()` and `GetTemporaryPointer()`
+  /// require all data to be in a single chunk.
+  void SetChunkSize(size_t chunk_size) { buf_.set_chunk_size(chunk_size); }
+
+  /// @brief Make room for `len` more bytes up front, plus what `Finish()`
+  /// adds, so the buffer grows at most once instead of in many steps, e.g.:
+  /// `fbb.Reserve(monster.EstimatePackedSize());
+  /// FinishMonsterBuffer(fbb, monster.Pack(fbb));`
+  /// @param[in] len The number of bytes about to be written, as estimated by
+  /// the generated `EstimatePackedSize()` of object API types, or by
+  /// `flatbuffers::EstimatePackedSize()` in reflection.h for `CopyTable()`.
+  void Reserve(size_t len) { buf_.reserve(len + kMaxFinishSize); }
+
+  /// @brief Sort large vectors of tables with string keys in
+  /// `CreateVectorOfSortedTables()` on several threads.
+  /// @param[in] runner The thread pool to use, which must outlive this
+  /// builder, or `nullptr` to sort on the calling thread (the default).
+  /// @param[in] min_keys_per_task Vectors are split into at most one part per
+  /// thread, with at least this many keys in each part.
+  void SetTaskRunner(TaskRunner *runner, size_t min_keys_per_task = 16384) {
+    runner_ = runner;
+    min_keys_per_task_ = std::max<size_t>(min_keys_per_task, 1);
+  }
+
   /// @brief Get a pointer to an unfinished buffer.
   /// @return Returns a `uint8_t` pointer to the unfinished buffer.
   uint8_t *GetCurrentBufferPointer() const { return buf_.data(); }
@@ -678,17 +1352,23 @@ FLATBUFFERS_FINAL_CLASS
   /// @param[in] bool fd When set to `true`, always serializes default values.
   void ForceDefaults(bool fd) { force_defaults_ = fd; }
 
+  /// @brief Whether default values are serialized, see `ForceDefaults()`.
+  bool ForcingDefaults() const { return force_defaults_; }
+
   /// @cond FLATBUFFERS_INTERNAL
   void Pad(size_t num_bytes) { buf_.fill(num_bytes); }
 
   void Align(size_t elem_size) {
     if (elem_size > minalign_) minalign_ = elem_size;
-    buf_.fill(PaddingBytes(buf_.size(), elem_size));
+    auto padding = PaddingBytes(buf_.size(), elem_size);
+    FLATBUFFERS_PERF_COUNT(padding_bytes, padding);
+    buf_.fill(padding);
   }
 
   void PushFlatBuffer(const uint8_t *bytes, size_t size) {
     PushBytes(bytes, size);
     finished = true;
+    size_prefixed_ = false;
   }
 
   void PushBytes(const uint8_t *bytes, size_t size) {
@@ -741,6 +1421,19 @@ FLATBUFFERS_FINAL_CLASS
     AddElement(field, ReferTo(off.o), static_cast<uoffset_t>(0));
   }
 
+  // For fields with the `offset64` attribute. Their vectors end up after all
+  // other data, so until Finish() knows how much that is, the offset stored
+  // here is relative to the end of those vectors.
+  template<typename T> void AddOffset(voffset_t field, Offset64<T> off) {
+    if (!off.o) return;  // An offset of 0 means NULL, don't store.
+    assert(wide_buf_ && off.o <= wide_buf_->size());
+    Align(sizeof(uoffset64_t));
+    auto loc = PushElement<uoffset64_t>(GetSize() + sizeof(uoffset64_t) -
+                                        off.o);
+    TrackField(field, loc);
+    offset64_fields_.push_back(loc);
+  }
+
   template<typename T> void AddStruct(voffset_t field, const T *structptr) {
     if (!structptr) return;  // Default, don't store.
     Align(AlignOf<T>());
@@ -780,6 +1473,7 @@ FLATBUFFERS_FINAL_CLASS
   uoffset_t StartTable() {
     NotNested();
     nested = true;
+    buf_.begin_object();
     return GetSize();
   }
 
@@ -810,22 +1504,58 @@ FLATBUFFERS_FINAL_CLASS
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
     offsetbuf_.clear();
-    auto vt1 = reinterpret_cast<voffset_t *>(buf_.data());
+    return AddVTable(vtableoffsetloc);
+  }
+
+  // Tables whose layout flatc computed ahead of time (see the generated
+  // Create functions) are written with StartTable(), then this, which aligns
+  // like the first AddElement() would and returns where to write the fields
+  // of the table. The vtable offset and any padding in it are zeroed.
+  uint8_t *PushPrecomputedTable(size_t table_size, size_t alignment) {
+    assert(nested);
+    Align(alignment);
+    auto table = buf_.make_space(table_size);
+    memset(table, 0, table_size);
+    return table;
+  }
+
+  // Writes the vtable for such a table, with field_offsets[i] being the
+  // offset of field i (0 if absent), then deduplicates it like EndTable().
+  uoffset_t EndPrecomputedTable(uoffset_t start,
+                                const voffset_t *field_offsets,
+                                voffset_t numfields) {
+    assert(nested);
+    auto vtableoffsetloc = GetSize();
+    auto table_object_size = vtableoffsetloc - start;
+    assert(table_object_size < 0x10000);  // Vtable use 16bit offsets.
+    auto vt = buf_.make_space(FieldIndexToOffset(numfields));
+    WriteScalar<voffset_t>(vt, FieldIndexToOffset(numfields));
+    WriteScalar<voffset_t>(vt + sizeof(voffset_t),
+                           static_cast<voffset_t>(table_object_size));
+    for (voffset_t i = 0; i < numfields; i++) {
+      WriteScalar<voffset_t>(vt + FieldIndexToOffset(i), field_offsets[i]);
+    }
+    return AddVTable(vtableoffsetloc);
+  }
+
+  // Finishes a table, the vtable of which was just written: if an identical
+  // vtable exists, it's removed again and the table refers to that one.
+  uoffset_t AddVTable(uoffset_t vtableoffsetloc) {
+    auto vt1 = buf_.data();
     auto vt1_size = ReadScalar<voffset_t>(vt1);
+    auto vt1_hash = HashBytes(vt1, vt1_size);
     auto vt_use = GetSize();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
-    for (auto it = vtables_.begin(); it != vtables_.end(); ++it) {
-      auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*it));
-      auto vt2_size = *vt2;
-      if (vt1_size != vt2_size || memcmp(vt2, vt1, vt1_size)) continue;
-      vt_use = *it;
+    auto existing = FindVTable(vt1, vt1_size, vt1_hash);
+    if (existing) {
+      vt_use = existing;
       buf_.pop(GetSize() - vtableoffsetloc);
-      break;
-    }
-    // If this is a new vtable, remember it.
-    if (vt_use == GetSize()) {
-      vtables_.push_back(vt_use);
+      FLATBUFFERS_PERF_COUNT(vtables_deduplicated, 1);
+    } else {
+      // This is a new vtable, remember it.
+      InsertVTable(vt_use, vt1_hash);
+      FLATBUFFERS_PERF_COUNT(vtables_emitted, 1);
     }
     // Fill the vtable offset we created above.
     // The offset points from the beginning of the object to where the
@@ -837,6 +1567,7 @@ FLATBUFFERS_FINAL_CLASS
                   static_cast<soffset_t>(vtableoffsetloc));
 
     nested = false;
+    buf_.end_object();
     return vtableoffsetloc;
   }
 
@@ -844,7 +1575,9 @@ FLATBUFFERS_FINAL_CLASS
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field) {
     auto table_ptr = buf_.data_at(table.o);
-    auto vtable_ptr = table_ptr - ReadScalar<soffset_t>(table_ptr);
+    // Locate the vtable by offset rather than by pointer, since it may live
+    // in a different chunk.
+    auto vtable_ptr = buf_.data_at(table.o + ReadScalar<soffset_t>(table_ptr));
     bool ok = ReadScalar<voffset_t>(vtable_ptr + field) != 0;
     // If this fails, the caller will show what field needs to be set.
     assert(ok);
@@ -863,7 +1596,9 @@ FLATBUFFERS_FINAL_CLASS
   // Aligns such that when "len" bytes are written, an object can be written
   // after it with "alignment" without padding.
   void PreAlign(size_t len, size_t alignment) {
-    buf_.fill(PaddingBytes(GetSize() + len, alignment));
+    auto padding = PaddingBytes(GetSize() + len, alignment);
+    FLATBUFFERS_PERF_COUNT(padding_bytes, padding);
+    buf_.fill(padding);
   }
   template<typename T> void PreAlign(size_t len) {
     AssertScalarT<T>();
@@ -877,10 +1612,12 @@ FLATBUFFERS_FINAL_CLASS
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateString(const char *str, size_t len) {
     NotNested();
+    buf_.begin_object();
     PreAlign<uoffset_t>(len + 1);  // Always 0-terminated.
     buf_.fill(1);
     PushBytes(reinterpret_cast<const uint8_t *>(str), len);
     PushElement(static_cast<uoffset_t>(len));
+    buf_.end_object();
     return Offset<String>(GetSize());
   }
 
@@ -898,6 +1635,13 @@ FLATBUFFERS_FINAL_CLASS
     return CreateString(str.c_str(), str.length());
   }
 
+  /// @brief Store a string with a custom allocator (e.g. an `arena_string`)
+  /// in the buffer, which can contain any binary data.
+  template<typename Alloc> Offset<String> CreateString(
+      const std::basic_string<char, std::char_traits<char>, Alloc> &str) {
+    return CreateString(str.c_str(), str.length());
+  }
+
   /// @brief Store a string in the buffer, which can contain any binary data.
   /// @param[in] str A const pointer to a `String` struct to add to the buffer.
   /// @return Returns the offset in the buffer where the string starts
@@ -905,6 +1649,30 @@ FLATBUFFERS_FINAL_CLASS
     return str ? CreateString(str->c_str(), str->Length()) : 0;
   }
 
+  #ifdef FLATBUFFERS_USE_QT
+  /// @brief Store a string in the buffer, which can contain any binary data.
+  /// @param[in] str A const reference to a QByteArray to store in the buffer.
+  /// @return Returns the offset in the buffer where the string starts.
+  Offset<String> CreateString(const QByteArray &str) {
+    return CreateString(str.constData(), static_cast<size_t>(str.size()));
+  }
+  #endif
+
+  /// @brief Store a copy of a string from another buffer, such as one that is
+  /// being repacked. Copying the same string again, e.g. one that was shared
+  /// in the other buffer, returns the offset of the first copy, without
+  /// looking at the contents. So the other buffer must not change until
+  /// `Clear()`.
+  /// @param[in] str A const pointer to a `String` in the other buffer.
+  /// @return Returns the offset in the buffer where the string starts.
+  Offset<String> CreateStringCopy(const String *str) {
+    auto it = copied_strings_.find(str);
+    if (it != copied_strings_.end()) return Offset<String>(it->second);
+    auto off = CreateString(str);
+    copied_strings_[str] = off.o;
+    return off;
+  }
+
   /// @brief Store a string in the buffer, which can contain any binary data.
   /// If a string with this exact contents has already been serialized before,
   /// instead simply returns the offset of the existing string.
@@ -912,21 +1680,17 @@ FLATBUFFERS_FINAL_CLASS
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char *str, size_t len) {
-    if (!string_pool)
-      string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
-    auto size_before_string = buf_.size();
-    // Must first serialize the string, since the set is all offsets into
-    // buffer.
-    auto off = CreateString(str, len);
-    auto it = string_pool->find(off);
+    NotNested();
+    auto hash = HashBytes(reinterpret_cast<const uint8_t *>(str), len);
     // If it exists we reuse existing serialized data!
-    if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
+    auto existing = FindString(str, len, hash);
+    if (existing.o) {
+      FLATBUFFERS_PERF_COUNT(shared_string_hits, 1);
+      return existing;
     }
+    auto off = CreateString(str, len);
     // Record this string for future use.
-    string_pool->insert(off);
+    InsertString(off.o, hash);
     return off;
   }
 
@@ -957,16 +1721,30 @@ FLATBUFFERS_FINAL_CLASS
     return CreateSharedString(str->c_str(), str->Length());
   }
 
+  /// @brief Limit how many strings `CreateSharedString()` remembers, to bound
+  /// the memory it uses. Once the limit is reached, strings that have not been
+  /// shared recently are forgotten (they stay in the buffer, but later calls
+  /// with the same contents will store a new copy).
+  /// @param[in] max_strings The maximum number of strings to remember, or `0`
+  /// for no limit (the default).
+  void SetSharedStringCapacity(size_t max_strings) {
+    max_strings_ = max_strings;
+    while (max_strings_ && num_strings_ > max_strings_) EvictString();
+  }
+
   /// @cond FLATBUFFERS_INTERNAL
   uoffset_t EndVector(size_t len) {
     assert(nested);  // Hit if no corresponding StartVector.
     nested = false;
-    return PushElement(static_cast<uoffset_t>(len));
+    auto vec = PushElement(static_cast<uoffset_t>(len));
+    buf_.end_object();
+    return vec;
   }
 
   void StartVector(size_t len, size_t elemsize) {
     NotNested();
     nested = true;
+    buf_.begin_object();
     PreAlign<uoffset_t>(len * elemsize);
     PreAlign(len * elemsize, elemsize);  // Just in case elemsize > uoffset_t.
   }
@@ -1006,14 +1784,20 @@ FLATBUFFERS_FINAL_CLASS
   /// buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<T>> CreateVector(const std::vector<T> &v) {
+  template<typename T, typename Alloc> Offset<Vector<T>> CreateVector(
+      const std::vector<T, Alloc> &v) {
     return CreateVector(data(v), v.size());
   }
 
   // vector<bool> may be implemented using a bit-set, so we can't access it as
   // an array. Instead, read elements manually.
   // Background: https://isocpp.org/blog/2012/11/on-vectorbool
-  Offset<Vector<uint8_t>> CreateVector(const std::vector<bool> &v) {
+  // (Checking Alloc keeps explicit calls such as CreateVector<T>(v) from
+  // picking this overload.)
+  template<typename Alloc> typename std::enable_if<
+    std::is_same<typename Alloc::value_type, bool>::value,
+    Offset<Vector<uint8_t>>>::type CreateVector(
+      const std::vector<bool, Alloc> &v) {
     StartVector(v.size(), sizeof(uint8_t));
     for (auto i = v.size(); i > 0; ) {
       PushElement(static_cast<uint8_t>(v[--i]));
@@ -1049,17 +1833,19 @@ FLATBUFFERS_FINAL_CLASS
     for (size_t i = 0; i < v.size(); i++) offsets[i] = CreateString(v[i]);
     return CreateVector(offsets);
   }
-#ifdef FLATBUFFERS_USE_QT
+
+  /// @brief Serialize a `std::vector` of other string types, such as
+  /// `QByteArray` or `arena_string`, into a FlatBuffer `vector`.
+  template<typename S, typename Alloc>
   Offset<Vector<Offset<String>>> CreateVectorOfStrings(
-    const std::vector<QByteArray> &v) {
+      const std::vector<S, Alloc> &v) {
     std::vector<Offset<String>> offsets(v.size());
     for (size_t i = 0; i < v.size(); i++) {
       const auto &str = v[i];
-      offsets[i] = CreateString(str.constData(), str.size());
+      offsets[i] = CreateString(str.data(), static_cast<size_t>(str.size()));
     }
     return CreateVector(offsets);
   }
-#endif
 
   /// @brief Serialize an array of structs into a FlatBuffer `vector`.
   /// @tparam T The data type of the struct array elements.
@@ -1081,26 +1867,26 @@ FLATBUFFERS_FINAL_CLASS
   /// serialize into the buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<const T *>> CreateVectorOfStructs(
-      const std::vector<T> &v) {
+  template<typename T, typename Alloc>
+  Offset<Vector<const T *>> CreateVectorOfStructs(
+      const std::vector<T, Alloc> &v) {
     return CreateVectorOfStructs(data(v), v.size());
   }
 
-  /// @cond FLATBUFFERS_INTERNAL
-  template<typename T>
-  struct TableKeyComparator {
-  TableKeyComparator(vector_downward& buf) : buf_(buf) {}
-    bool operator()(const Offset<T> &a, const Offset<T> &b) const {
-      auto table_a = reinterpret_cast<T *>(buf_.data_at(a.o));
-      auto table_b = reinterpret_cast<T *>(buf_.data_at(b.o));
-      return table_a->KeyCompareLessThan(table_b);
-    }
-    vector_downward& buf_;
-
-  private:
-    TableKeyComparator& operator= (const TableKeyComparator&);
-  };
-  /// @endcond
+  /// @brief Copy a `vector` of scalars or structs from another FlatBuffer.
+  /// Its elements are already in little endian, so they are copied as is.
+  /// @tparam T The data type of the vector elements.
+  /// @param[in] v The vector to copy.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<T>> CreateVectorCopy(const Vector<T> *v) {
+    typedef typename std::remove_cv<
+      typename std::remove_pointer<T>::type>::type E;
+    auto len = v->size();
+    StartVector(len * sizeof(E) / AlignOf<E>(), AlignOf<E>());
+    PushBytes(v->Data(), sizeof(E) * len);
+    return Offset<Vector<T>>(EndVector(len));
+  }
 
   /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
   /// in sorted order.
@@ -1110,9 +1896,15 @@ FLATBUFFERS_FINAL_CLASS
   /// @param[in] len The number of elements to store in the `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
+  /// Tables with equal keys keep their relative order. Sorting on string keys
+  /// is done in parallel if a task runner was set, see `SetTaskRunner()`.
   template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(
       Offset<T> *v, size_t len) {
-    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    // Keys are read through pointers, so the tables (and the data they refer
+    // to) must be in a single chunk.
+    assert(buf_.num_chunks() == 1);
+    typedef typename TableKeyType<T>::type K;
+    SortTablesByKey(v, len, static_cast<K *>(nullptr));
     return CreateVector(v, len);
   }
 
@@ -1128,6 +1920,115 @@ FLATBUFFERS_FINAL_CLASS
     return CreateVectorOfSortedTables(v->data(), v->size());
   }
 
+  /// @brief Serialize a key index for a vector of tables, which allows faster
+  /// lookups with `Vector::LookupByKeyIndex()` than `LookupByKey()`, for
+  /// tables whose key field has the `key_index` attribute. Store it next to
+  /// the vector, e.g. in a field of type `[ulong]` for a key of type `ulong`.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] sorted The `table` offsets in sorted order, as left behind by
+  /// `CreateVectorOfSortedTables()`.
+  /// @param[in] len The number of tables.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector of keys is stored.
+  template<typename T>
+  Offset<Vector<typename T::KeyType>> CreateKeyIndex(const Offset<T> *sorted,
+                                                      size_t len) {
+    // Tables are read through pointers, see CreateVectorOfSortedTables.
+    assert(buf_.num_chunks() == 1);
+    std::vector<typename T::KeyType> keys(len);
+    EytzingerFill([&](size_t i) {
+      return GetTable(sorted[i])->GetKey();
+    }, keys.empty() ? nullptr : &keys[0], len);
+    return CreateVector(keys);
+  }
+
+  /// @brief Serialize a key index for a vector of tables, see above.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] sorted The `table` offsets in sorted order.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector of keys is stored.
+  template<typename T>
+  Offset<Vector<typename T::KeyType>> CreateKeyIndex(
+      const std::vector<Offset<T>> &sorted) {
+    return CreateKeyIndex(data(sorted), sorted.size());
+  }
+
+  /// @brief Copy a buffer finished by another builder into this one, as a
+  /// subtree, e.g. to build parts of a large buffer on other threads.
+  /// Offsets in a FlatBuffer are relative to where they are stored, so the
+  /// buffer is copied as is, minus its size prefix, root offset and file
+  /// identifier.
+  /// Tables created in this builder afterwards may share its vtables.
+  /// @tparam T The type of the root table of `child`.
+  /// @param[in] child The builder the buffer was finished in, which may use
+  /// chunked storage.
+  /// @param[in] has_identifier Whether `child` was finished with a file
+  /// identifier.
+  /// @return Returns a typed `Offset` to the root table of `child`, now in
+  /// this buffer.
+  template<typename T> Offset<T> SpliceBuffer(const FlatBufferBuilder &child,
+                                              bool has_identifier = false) {
+    NotNested();
+    child.Finished();
+    // Keep the data at the same alignment relative to the end.
+    Align(child.minalign_);
+    auto start = GetSize();
+    auto slices = child.buf_.slices();
+    // Drop the header, reading the root offset from it. Finish() keeps it in
+    // one chunk, but it may follow data in the same chunk or start a new
+    // one, so take it from as many leading slices as it covers.
+    uint8_t header[2 * sizeof(uoffset_t) + kFileIdentifierLength];
+    auto root_at = child.size_prefixed_ ? sizeof(uoffset_t) : 0;
+    auto header_size = root_at + sizeof(uoffset_t) +
+                       (has_identifier ? kFileIdentifierLength : 0);
+    auto first = slices.begin();
+    for (size_t read = 0; read < header_size; ) {
+      auto n = (std::min)(header_size - read, first->size);
+      memcpy(header + read, first->data, n);
+      read += n;
+      first->data += n;
+      first->size -= n;
+      if (!first->size) ++first;
+    }
+    // Relative to where it is stored, like any offset.
+    auto root = root_at + ReadScalar<uoffset_t>(header + root_at);
+    // Slices are in memory order, but the buffer grows downwards.
+    for (auto it = slices.end(); it != first; ) {
+      --it;
+      memcpy(buf_.make_space(it->size), it->data, it->size);
+    }
+    for (auto it = child.vtables_.begin(); it != child.vtables_.end(); ++it) {
+      if (it->off) InsertVTable(start + it->off, it->hash);
+    }
+    return Offset<T>(start + child.GetSize() - root);
+  }
+
+  /// @brief Copy a finished FlatBuffer into this one, as a subtree, see
+  /// above.
+  /// @tparam T The type of the root table of `buf`.
+  /// @param[in] buf The finished buffer.
+  /// @param[in] size The size of `buf`.
+  /// @param[in] alignment The largest alignment of anything in `buf`.
+  /// @param[in] has_identifier Whether `buf` has a file identifier.
+  /// @param[in] size_prefixed Whether `buf` starts with its size, see
+  /// `FinishSizePrefixed()`.
+  /// @return Returns a typed `Offset` to the root table of `buf`, now in this
+  /// buffer.
+  template<typename T> Offset<T> SpliceBuffer(
+      const uint8_t *buf, size_t size,
+      size_t alignment = sizeof(largest_scalar_t),
+      bool has_identifier = false, bool size_prefixed = false) {
+    NotNested();
+    Align(alignment);
+    auto root_at = size_prefixed ? sizeof(uoffset_t) : 0;
+    auto header = root_at + sizeof(uoffset_t) +
+                  (has_identifier ? kFileIdentifierLength : 0);
+    assert(size >= header);
+    memcpy(buf_.make_space(size - header), buf + header, size - header);
+    return Offset<T>(GetSize() + header - root_at -
+                     ReadScalar<uoffset_t>(buf + root_at));
+  }
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
@@ -1160,25 +2061,122 @@ FLATBUFFERS_FINAL_CLASS
                                      reinterpret_cast<uint8_t **>(buf));
   }
 
+  /// @brief Serialize an array of scalars into a `vector` with a 64-bit
+  /// length, for a field with the `offset64` attribute. These vectors are
+  /// kept apart from all other data until `Finish()` puts them at the end of
+  /// the buffer, so that only they may lie beyond the 2GB all other data is
+  /// limited to. They can be created at any time before `Finish()`.
+  /// @tparam T The data type of the array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset64` to pass to the field's `add_` method.
+  template<typename T> Offset64<Vector64<T>> CreateVector64(const T *v,
+                                                            size_t len) {
+    uint8_t *buf;
+    auto vec = CreateUninitializedVector64(len, sizeof(T), sizeof(T), &buf);
+    #if FLATBUFFERS_LITTLEENDIAN
+      if (len) memcpy(buf, v, len * sizeof(T));
+    #else
+      for (size_t i = 0; i < len; i++) WriteScalar(buf + i * sizeof(T), v[i]);
+    #endif
+    return Offset64<Vector64<T>>(vec);
+  }
+
+  /// @brief Serialize a `std::vector` into a `vector` with a 64-bit length,
+  /// see above.
+  template<typename T, typename Alloc> Offset64<Vector64<T>> CreateVector64(
+      const std::vector<T, Alloc> &v) {
+    return CreateVector64(data(v), v.size());
+  }
+
+  template<typename Alloc> typename std::enable_if<
+    std::is_same<typename Alloc::value_type, bool>::value,
+    Offset64<Vector64<uint8_t>>>::type CreateVector64(
+      const std::vector<bool, Alloc> &v) {
+    uint8_t *buf;
+    auto vec = CreateUninitializedVector64(v.size(), 1, 1, &buf);
+    for (size_t i = 0; i < v.size(); i++) buf[i] = v[i];
+    return Offset64<Vector64<uint8_t>>(vec);
+  }
+
+  /// @brief Serialize an array of structs into a `vector` with a 64-bit
+  /// length, see `CreateVector64()`.
+  template<typename T> Offset64<Vector64<const T *>> CreateVectorOfStructs64(
+      const T *v, size_t len) {
+    uint8_t *buf;
+    auto vec = CreateUninitializedVector64(len, sizeof(T), AlignOf<T>(), &buf);
+    if (len) memcpy(buf, v, len * sizeof(T));
+    return Offset64<Vector64<const T *>>(vec);
+  }
+
+  template<typename T, typename Alloc>
+  Offset64<Vector64<const T *>> CreateVectorOfStructs64(
+      const std::vector<T, Alloc> &v) {
+    return CreateVectorOfStructs64(data(v), v.size());
+  }
+
+  /// @brief Copy a `vector` with a 64-bit length from another FlatBuffer, see
+  /// `CreateVectorCopy()`.
+  template<typename T> Offset64<Vector64<T>> CreateVectorCopy(
+      const Vector64<T> *v) {
+    typedef typename std::remove_cv<
+      typename std::remove_pointer<T>::type>::type E;
+    uint8_t *buf;
+    auto len = static_cast<size_t>(v->size());
+    auto vec = CreateUninitializedVector64(len, sizeof(E), AlignOf<E>(), &buf);
+    if (len) memcpy(buf, v->Data(), len * sizeof(E));
+    return Offset64<Vector64<T>>(vec);
+  }
+
+  /// @brief Create a `vector` with a 64-bit length of `len` elements of
+  /// `elemsize` bytes each, to be written (little endian) through `buf`
+  /// before anything else is added to the builder.
+  uoffset64_t CreateUninitializedVector64(size_t len, size_t elemsize,
+                                          size_t alignment, uint8_t **buf) {
+    NotNested();
+    if (!wide_buf_) {
+      wide_buf_ = new vector_downward(sizeof(largest_scalar_t),
+                                      buf_.allocator(),
+                                      FLATBUFFERS_MAX_64_BUFFER_SIZE);
+    }
+    auto &wide = *wide_buf_;
+    alignment = (std::max)(alignment, sizeof(uoffset64_t));
+    if (alignment > wide_minalign_) wide_minalign_ = alignment;
+    auto bytes = len * elemsize;
+    wide.reserve(bytes + 2 * alignment);
+    // Elements start aligned, and so does the length in front of them.
+    wide.fill(PaddingBytes(wide.size() + bytes, alignment));
+    wide.make_space(bytes);
+    auto length = EndianScalar(static_cast<uoffset64_t>(len));
+    wide.push(reinterpret_cast<const uint8_t *>(&length), sizeof(length));
+    *buf = wide.data() + sizeof(length);
+    return wide.size();
+  }
+
   /// @brief The length of a FlatBuffer file header.
   static const size_t kFileIdentifierLength = 4;
 
+  /// @brief The most `Finish()` adds to a buffer: the root offset, a file
+  /// identifier, and padding up to the largest alignment `force_align` allows.
+  static const size_t kMaxFinishSize = sizeof(uoffset_t) +
+                                       kFileIdentifierLength + 15;
+
   /// @brief Finish serializing a buffer by writing the root offset.
   /// @param[in] file_identifier If a `file_identifier` is given, the buffer
   /// will be prefixed with a standard FlatBuffers file header.
   template<typename T> void Finish(Offset<T> root,
                                    const char *file_identifier = nullptr) {
-    NotNested();
-    // This will cause the whole buffer to be aligned.
-    PreAlign(sizeof(uoffset_t) + (file_identifier ? kFileIdentifierLength : 0),
-             minalign_);
-    if (file_identifier) {
-      assert(strlen(file_identifier) == kFileIdentifierLength);
-      buf_.push(reinterpret_cast<const uint8_t *>(file_identifier),
-                kFileIdentifierLength);
-    }
-    PushElement(ReferTo(root.o));  // Location of root.
-    finished = true;
+    Finish(root.o, file_identifier, false);
+  }
+
+  /// @brief Finish a buffer like `Finish()`, then prefix it with its size (a
+  /// `uoffset_t`, not counting itself), so that buffers can be written one
+  /// after another to a file or socket, and read back with a
+  /// `BufferStreamReader`. Use `GetSizePrefixedRoot()` and
+  /// `Verifier::VerifySizePrefixedBuffer()` to access such a buffer.
+  template<typename T> void FinishSizePrefixed(
+      Offset<T> root, const char *file_identifier = nullptr) {
+    Finish(root.o, file_identifier, true);
   }
 
  private:
@@ -1191,7 +2189,12 @@ FLATBUFFERS_FINAL_CLASS
     voffset_t id;
   };
 
-  simple_allocator default_allocator;
+  // Shared by all builders, such that released buffers never refer to a
+  // builder that has since been destroyed.
+  static const simple_allocator &default_allocator() {
+    static simple_allocator allocator;
+    return allocator;
+  }
 
   vector_downward buf_;
 
@@ -1204,30 +2207,278 @@ FLATBUFFERS_FINAL_CLASS
   // Ensure the buffer is finished before it is being accessed.
   bool finished;
 
-  std::vector<uoffset_t> vtables_;  // todo: Could make this into a map?
+  // Whether the buffer was finished with FinishSizePrefixed().
+  bool size_prefixed_;
+
+  // Vtables written so far, as an open addressing hash table keyed on the
+  // vtable contents. An `off` of 0 marks an empty slot (no vtable can start
+  // at the very end of the buffer).
+  struct VTableSlot {
+    VTableSlot() : off(0), hash(0) {}
+    uoffset_t off;
+    uint32_t hash;
+  };
+  std::vector<VTableSlot> vtables_;  // Size is always a power of 2.
+  size_t num_vtables_;
+
+  void Finish(uoffset_t root, const char *file_identifier, bool size_prefix) {
+    NotNested();
+    auto wide_size = PadWideData();
+    // This will cause the whole buffer to be aligned.
+    auto header = sizeof(uoffset_t) +
+                  (file_identifier ? kFileIdentifierLength : 0) +
+                  (size_prefix ? sizeof(uoffset_t) : 0);
+    PreAlign(header, minalign_);
+    // With chunked storage, keep the header in one chunk.
+    buf_.reserve(header);
+    if (file_identifier) {
+      assert(strlen(file_identifier) == kFileIdentifierLength);
+      buf_.push(reinterpret_cast<const uint8_t *>(file_identifier),
+                kFileIdentifierLength);
+    }
+    PushElement(ReferTo(root));  // Location of root.
+    if (size_prefix) {
+      // The size must fit the prefix.
+      assert(buf_.size() + wide_size <= static_cast<uoffset_t>(~0u));
+      PushElement(static_cast<uoffset_t>(buf_.size() + wide_size));
+    }
+    if (wide_size) AppendWideData();
+    finished = true;
+    size_prefixed_ = size_prefix;
+  }
+
+  // Pads the vectors with 64-bit offsets to the alignment of the whole
+  // buffer, and points the offsets to them now that their size is known.
+  // Returns that size.
+  size_t PadWideData() {
+    if (!wide_buf_ || !wide_buf_->size()) return 0;
+    if (wide_minalign_ > minalign_) minalign_ = wide_minalign_;
+    wide_buf_->fill(PaddingBytes(wide_buf_->size(), minalign_));
+    auto wide_size = wide_buf_->size();
+    for (auto it = offset64_fields_.begin(); it != offset64_fields_.end();
+         ++it) {
+      auto loc = buf_.data_at(*it);
+      WriteScalar(loc, ReadScalar<uoffset64_t>(loc) + wide_size);
+    }
+    return wide_size;
+  }
+
+  // Puts all other data in front of those vectors, copying the (usually
+  // much smaller) former.
+  void AppendWideData() {
+    auto wide_size = wide_buf_->size();
+    // Chunked storage continues in new chunks, rather than reallocating.
+    wide_buf_->set_chunk_size(buf_.chunk_size());
+    auto slices = buf_.slices();
+    for (auto it = slices.rbegin(); it != slices.rend(); ++it) {
+      memcpy(wide_buf_->make_space(it->size), it->data, it->size);
+    }
+    FLATBUFFERS_PERF_COUNT(bytes_copied, buf_.size());
+    buf_.swap(*wide_buf_);
+    wide_buf_->clear();
+    offset64_fields_.clear();
+    // The vtables are now that much further from the end, which SpliceBuffer()
+    // relies on. Past 4GB they can't be shared by 32-bit offsets anyway.
+    bool in_reach = buf_.size() <= static_cast<uoffset_t>(~0u);
+    for (auto it = vtables_.begin(); it != vtables_.end(); ++it) {
+      if (!it->off) continue;
+      if (in_reach)
+        it->off += static_cast<uoffset_t>(wide_size);
+      else
+        *it = VTableSlot();
+    }
+    if (!in_reach) num_vtables_ = 0;
+  }
+
+  // Returns the location of a vtable identical to `vt`, or 0 if none.
+  uoffset_t FindVTable(const uint8_t *vt, voffset_t vt_size,
+                       uint32_t hash) const {
+    auto mask = vtables_.size() - 1;
+    for (auto i = hash & mask; vtables_[i].off; i = (i + 1) & mask) {
+      auto &slot = vtables_[i];
+      if (slot.hash != hash) continue;
+      auto vt2 = buf_.data_at(slot.off);
+      if (ReadScalar<voffset_t>(vt2) == vt_size && !memcmp(vt2, vt, vt_size))
+        return slot.off;
+    }
+    return 0;
+  }
+
+  void InsertVTable(uoffset_t off, uint32_t hash) {
+    // Keep the load factor at or below 1/2, so probe sequences stay short.
+    if ((num_vtables_ + 1) * 2 > vtables_.size()) {
+      std::vector<VTableSlot> old(vtables_.size() * 2);
+      old.swap(vtables_);
+      num_vtables_ = 0;
+      for (auto it = old.begin(); it != old.end(); ++it) {
+        if (it->off) InsertVTable(it->off, it->hash);
+      }
+    }
+    auto mask = vtables_.size() - 1;
+    auto i = hash & mask;
+    while (vtables_[i].off) i = (i + 1) & mask;
+    vtables_[i].off = off;
+    vtables_[i].hash = hash;
+    num_vtables_++;
+  }
 
   size_t minalign_;
 
   bool force_defaults_;  // Serialize values equal to their defaults anyway.
 
-  struct StringOffsetCompare {
-    StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
-    bool operator() (const Offset<String> &a, const Offset<String> &b) const {
-      auto stra = reinterpret_cast<const String *>(buf_->data_at(a.o));
-      auto strb = reinterpret_cast<const String *>(buf_->data_at(b.o));
-      return strncmp(stra->c_str(), strb->c_str(),
-                     std::min(stra->size(), strb->size()) + 1) < 0;
+  // Strings written by CreateSharedString, as an open addressing hash table
+  // keyed on the string contents, like vtables_. Allocated on first use.
+  // When max_strings_ is set, entries are evicted with the clock algorithm:
+  // a lookup hit marks an entry as referenced, and the clock hand sweeps the
+  // table, giving referenced entries a second chance.
+  struct StringSlot {
+    StringSlot() : off(0), hash(0), referenced(false) {}
+    uoffset_t off;
+    uint32_t hash;
+    bool referenced;
+  };
+  std::vector<StringSlot> string_pool_;  // Size is always a power of 2.
+  size_t num_strings_;
+  size_t max_strings_;  // 0 means unbounded.
+  size_t clock_hand_;
+
+  // Returns the location of a string with these contents, or 0 if none.
+  Offset<String> FindString(const char *str, size_t len, uint32_t hash) {
+    if (string_pool_.empty()) return 0;
+    auto mask = string_pool_.size() - 1;
+    for (auto i = hash & mask; string_pool_[i].off; i = (i + 1) & mask) {
+      auto &slot = string_pool_[i];
+      if (slot.hash != hash) continue;
+      // Strings never straddle chunks, so their contents are contiguous.
+      auto s = reinterpret_cast<const String *>(buf_.data_at(slot.off));
+      if (s->size() == len && !memcmp(s->c_str(), str, len)) {
+        slot.referenced = true;
+        return slot.off;
+      }
+    }
+    return 0;
+  }
+
+  void InsertString(uoffset_t off, uint32_t hash) {
+    if (max_strings_ && num_strings_ >= max_strings_) EvictString();
+    // Keep the load factor at or below 1/2, so probe sequences stay short.
+    if ((num_strings_ + 1) * 2 > string_pool_.size()) {
+      std::vector<StringSlot> old(std::max<size_t>(string_pool_.size() * 2,
+                                                   16));
+      old.swap(string_pool_);
+      num_strings_ = 0;
+      for (auto it = old.begin(); it != old.end(); ++it) {
+        if (it->off) InsertString(it->off, it->hash);
+      }
     }
-    const vector_downward *buf_;
+    auto mask = string_pool_.size() - 1;
+    auto i = hash & mask;
+    while (string_pool_[i].off) i = (i + 1) & mask;
+    string_pool_[i].off = off;
+    string_pool_[i].hash = hash;
+    string_pool_[i].referenced = false;
+    num_strings_++;
+  }
+
+  // Forgets the first unreferenced string the clock hand comes across.
+  void EvictString() {
+    assert(num_strings_);
+    auto mask = string_pool_.size() - 1;
+    for (;;) {
+      auto i = clock_hand_;
+      clock_hand_ = (clock_hand_ + 1) & mask;
+      auto &slot = string_pool_[i];
+      if (!slot.off) continue;
+      if (slot.referenced) {
+        slot.referenced = false;
+        continue;
+      }
+      // Remove by shifting back later entries of the probe sequence, so
+      // lookups never need tombstones.
+      for (auto j = (i + 1) & mask; string_pool_[j].off; j = (j + 1) & mask) {
+        auto home = string_pool_[j].hash & mask;
+        // Move j into the hole at i unless its home lies cyclically in (i, j].
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+          string_pool_[i] = string_pool_[j];
+          i = j;
+        }
+      }
+      string_pool_[i] = StringSlot();
+      num_strings_--;
+      return;
+    }
+  }
+
+  TaskRunner *runner_;
+  size_t min_keys_per_task_;
+
+  // Vectors with 64-bit offsets, and where the fields referring to them are.
+  vector_downward *wide_buf_;  // Created on first use.
+  size_t wide_minalign_;
+  std::vector<uoffset_t> offset64_fields_;
+
+  // Where CreateStringCopy() stored the strings it copied.
+  std::unordered_map<const String *, uoffset_t> copied_strings_;
+
+  template<typename T> const T *GetTable(Offset<T> off) const {
+    return reinterpret_cast<const T *>(buf_.data_at(off.o));
+  }
+
+  template<typename T, typename K> void SortTablesByKey(Offset<T> *v,
+                                                        size_t len, K *) {
+    typedef decltype(RadixKey(K())) U;
+    std::vector<KeyedOffset<U>> keyed(len);
+    for (size_t i = 0; i < len; i++) {
+      keyed[i].key = RadixKey(GetTable(v[i])->GetKey());
+      keyed[i].off = v[i].o;
+    }
+    RadixSort(&keyed);
+    for (size_t i = 0; i < len; i++) v[i] = keyed[i].off;
+  }
+
+  template<typename T> void SortTablesByKey(Offset<T> *v, size_t len,
+                                            const String **) {
+    std::vector<StringKeyedOffset> keyed;
+    keyed.reserve(len);
+    for (size_t i = 0; i < len; i++) {
+      keyed.push_back(StringKeyedOffset(GetTable(v[i])->GetKey(), v[i].o));
+    }
+    ParallelStableSort(&keyed, runner_, min_keys_per_task_);
+    for (size_t i = 0; i < len; i++) v[i] = keyed[i].off;
+  }
+
+  template<typename T> struct TableKeyComparator {
+    explicit TableKeyComparator(const FlatBufferBuilder &fbb) : fbb_(fbb) {}
+    bool operator()(const Offset<T> &a, const Offset<T> &b) const {
+      return fbb_.GetTable(a)->KeyCompareLessThan(fbb_.GetTable(b));
+    }
+    const FlatBufferBuilder &fbb_;
+
+   private:
+    TableKeyComparator &operator=(const TableKeyComparator &);
   };
 
-  // For use with CreateSharedString. Instantiated on first use only.
-  typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
-  StringOffsetMap *string_pool;
+  // Tables without GetKey(), see TableKeyType.
+  template<typename T> void SortTablesByKey(Offset<T> *v, size_t len,
+                                            void *) {
+    std::stable_sort(v, v + len, TableKeyComparator<T>(*this));
+  }
 };
 /// @}
 
 /// @cond FLATBUFFERS_INTERNAL
+// Upper bounds on the space a string or vector takes up in a builder, padding
+// included, for the generated EstimatePackedSize() functions.
+inline size_t EstimateStringSize(size_t len) {
+  return sizeof(uoffset_t) + len + 1 + (sizeof(uoffset_t) - 1);
+}
+
+inline size_t EstimateVectorSize(size_t len, size_t elem_size) {
+  // StartVector() aligns for both the length and the elements.
+  return sizeof(uoffset_t) + len * elem_size + (sizeof(uoffset_t) - 1) +
+         (elem_size - 1);
+}
+
 // Helpers to get a typed pointer to the root object contained in the buffer.
 template<typename T> T *GetMutableRoot(void *buf) {
   EndianCheck();
@@ -1239,6 +2490,17 @@ template<typename T> const T *GetRoot(const void *buf) {
   return GetMutableRoot<T>(const_cast<void *>(buf));
 }
 
+/// @brief The root of a buffer written with `FinishSizePrefixed()`.
+template<typename T> const T *GetSizePrefixedRoot(const void *buf) {
+  return GetRoot<T>(reinterpret_cast<const uint8_t *>(buf) + sizeof(uoffset_t));
+}
+
+/// @brief The size of a buffer written with `FinishSizePrefixed()`, not
+/// counting the prefix itself.
+inline uoffset_t GetPrefixedSize(const void *buf) {
+  return ReadScalar<uoffset_t>(buf);
+}
+
 /// Helpers to get a typed pointer to objects that are currently beeing built.
 /// @warning Creating new objects will lead to reallocations and invalidates
 /// the pointer!
@@ -1259,13 +2521,123 @@ inline bool BufferHasIdentifier(const void *buf, const char *identifier) {
                  identifier, FlatBufferBuilder::kFileIdentifierLength) == 0;
 }
 
+/// @cond FLATBUFFERS_INTERNAL
+// Checks that each of the `count` offsets at `offsets` points to at least
+// `min_size` bytes that lie before `limit`, where offsets are relative to
+// their own position as usual, and `pos` is the position of the first offset
+// counting from the start of the buffer (`limit` counts from there too).
+// The offsets themselves must lie before `limit`.
+inline bool OffsetTargetsInRange(const uint8_t *offsets, size_t count,
+                                 size_t pos, size_t limit, size_t min_size) {
+  if (limit < min_size) return !count;
+  // With rem = limit - min_size - position of an offset, an offset is in
+  // range iff it is <= rem.
+  auto rem = static_cast<int64_t>(limit - min_size) -
+             static_cast<int64_t>(pos);
+  size_t i = 0;
+  // If the buffer is small enough, rem fits an int32_t for every offset, and
+  // offsets with their top bit set are out of range anyway, so the SIMD code
+  // does a signed compare plus a check of that top bit.
+  if (limit <= FLATBUFFERS_MAX_BUFFER_SIZE) {
+  #ifdef FLATBUFFERS_AVX2
+    auto rem8 = _mm256_sub_epi32(_mm256_set1_epi32(static_cast<int32_t>(rem)),
+                                 _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28));
+    auto bad8 = _mm256_setzero_si256();
+    for (; i + 8 <= count; i += 8) {
+      auto off = _mm256_loadu_si256(
+                   reinterpret_cast<const __m256i *>(offsets + i * 4));
+      bad8 = _mm256_or_si256(bad8, _mm256_or_si256(off,
+               _mm256_cmpgt_epi32(off, rem8)));
+      rem8 = _mm256_sub_epi32(rem8, _mm256_set1_epi32(32));
+    }
+    if (_mm256_movemask_ps(_mm256_castsi256_ps(bad8))) return false;
+    rem -= static_cast<int64_t>(i * 4);
+  #endif
+  #ifdef FLATBUFFERS_SSE2
+    auto rem4 = _mm_sub_epi32(_mm_set1_epi32(static_cast<int32_t>(rem)),
+                              _mm_setr_epi32(0, 4, 8, 12));
+    auto bad4 = _mm_setzero_si128();
+    auto start = i;
+    for (; i + 4 <= count; i += 4) {
+      auto off = _mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(offsets + i * 4));
+      bad4 = _mm_or_si128(bad4, _mm_or_si128(off, _mm_cmpgt_epi32(off, rem4)));
+      rem4 = _mm_sub_epi32(rem4, _mm_set1_epi32(16));
+    }
+    if (_mm_movemask_ps(_mm_castsi128_ps(bad4))) return false;
+    rem -= static_cast<int64_t>((i - start) * 4);
+  #endif
+  }
+  bool bad = false;
+  for (; i < count; i++, rem -= 4) {
+    bad |= ReadScalar<uoffset_t>(offsets + i * 4) > rem;
+  }
+  return !bad;
+}
+
+// Checks that the 64-bit offset at `p` (see Table::GetPointer64()) points
+// forward, to before `end`, without forming the pointer it leads to: a
+// hostile offset could wrap it around to elsewhere in the buffer.
+inline bool Offset64InRange(const uint8_t *p, const uint8_t *end) {
+  auto off = ReadScalar<uoffset64_t>(p);
+  return off != 0 && off < static_cast<uoffset64_t>(end - p);
+}
+
+// Returns the number of leading bytes of `s` that are 7-bit ASCII.
+inline size_t AsciiPrefixLength(const uint8_t *s, size_t len) {
+  size_t i = 0;
+  #ifdef FLATBUFFERS_AVX2
+    for (; i + 32 <= len; i += 32) {
+      auto mask = _mm256_movemask_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(s + i)));
+      if (mask) return i + CountTrailingZeros(static_cast<uint32_t>(mask));
+    }
+  #endif
+  #ifdef FLATBUFFERS_SSE2
+    for (; i + 16 <= len; i += 16) {
+      auto mask = _mm_movemask_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)));
+      if (mask) return i + CountTrailingZeros(static_cast<uint32_t>(mask));
+    }
+  #endif
+  while (i < len && s[i] < 0x80) i++;
+  return i;
+}
+
+// Whether `s` is well-formed UTF-8 (RFC 3629: no overlong encodings,
+// surrogates or code points past U+10FFFF). Zero bytes are allowed.
+inline bool IsValidUTF8(const uint8_t *s, size_t len) {
+  for (size_t i = 0;;) {
+    i += AsciiPrefixLength(s + i, len - i);
+    if (i == len) return true;
+    uint32_t c = s[i];
+    size_t n;  // Number of continuation bytes.
+    uint32_t min;  // Smallest code point that needs n continuation bytes.
+    if ((c & 0xE0) == 0xC0) { n = 1; c &= 0x1F; min = 0x80; }
+    else if ((c & 0xF0) == 0xE0) { n = 2; c &= 0x0F; min = 0x800; }
+    else if ((c & 0xF8) == 0xF0) { n = 3; c &= 0x07; min = 0x10000; }
+    else return false;
+    if (len - i <= n) return false;
+    for (size_t j = 1; j <= n; j++) {
+      if ((s[i + j] & 0xC0) != 0x80) return false;
+      c = (c << 6) | (s[i + j] & 0x3F);
+    }
+    if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return false;
+    i += n + 1;
+  }
+}
+/// @endcond
+
 // Helper class to verify the integrity of a FlatBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
+  // With _check_utf8, strings must also be valid UTF-8, as the schema
+  // language requires (this is not checked by default, for speed).
   Verifier(const uint8_t *buf, size_t buf_len, size_t _max_depth = 64,
-           size_t _max_tables = 1000000)
+           size_t _max_tables = 1000000, bool _check_utf8 = false)
     : buf_(buf), end_(buf + buf_len), depth_(0), max_depth_(_max_depth),
-      num_tables_(0), max_tables_(_max_tables)
+      num_tables_(0), max_tables_(_max_tables), check_utf8_(_check_utf8),
+      runner_(nullptr), min_tables_per_task_(0)
     #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
       , upper_bound_(buf)
     #endif
@@ -1285,6 +2657,7 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Verify any range within the buffer.
   bool Verify(const void *elem, size_t elem_len) const {
+    FLATBUFFERS_PERF_COUNT(bytes_verified, elem_len);
     #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
       auto upper_bound = reinterpret_cast<const uint8_t *>(elem) + elem_len;
       if (upper_bound_ < upper_bound)
@@ -1318,13 +2691,36 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return Verify(reinterpret_cast<const Vector<T> *>(vec));
   }
 
+  // Verify the 64-bit offset at `p`, which must be in the buffer, before it
+  // is followed.
+  bool VerifyOffset64(const uint8_t *p) const {
+    return Check(Offset64InRange(p, end_));
+  }
+
+  // Verify a pointer (may be NULL) of a vector with a 64-bit length.
+  template<typename T> bool Verify(const Vector64<T> *vec) const {
+    if (!vec) return true;
+    if (!Verify<uoffset64_t>(vec)) return false;
+    auto size = vec->size();
+    // Protect against byte_size overflowing.
+    auto max_elems = static_cast<size_t>(end_ - buf_) / sizeof(T);
+    if (!Check(size <= max_elems)) return false;
+    return Verify(vec, sizeof(size) + sizeof(T) * static_cast<size_t>(size));
+  }
+
+  // Verify a pointer (may be NULL) of a vector to struct with a 64-bit length.
+  template<typename T> bool Verify(const Vector64<const T *> *vec) const {
+    return Verify(reinterpret_cast<const Vector64<T> *>(vec));
+  }
+
   // Verify a pointer (may be NULL) to string.
   bool Verify(const String *str) const {
     const uint8_t *end;
     return !str ||
            (VerifyVector(reinterpret_cast<const uint8_t *>(str), 1, &end) &&
-            Verify(end, 1) &&      // Must have terminator
-            Check(*end == '\0'));  // Terminating byte must be 0.
+            Verify(end, 1) &&       // Must have terminator
+            Check(*end == '\0') &&  // Terminating byte must be 0.
+            VerifyUTF8(str));
   }
 
   // Common code between vectors and strings.
@@ -1345,17 +2741,33 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Special case for string contents, after the above has been called.
   bool VerifyVectorOfStrings(const Vector<Offset<String>> *vec) const {
-      if (vec) {
-        for (uoffset_t i = 0; i < vec->size(); i++) {
-          if (!Verify(vec->Get(i))) return false;
-        }
+    if (!vec) return true;
+    // Check all offsets at once, after which the length field and at least
+    // the terminator of every string are known to be inside the buffer.
+    if (!VerifyOffsetTargets(vec, sizeof(uoffset_t) + 1)) return false;
+    for (uoffset_t i = 0; i < vec->size(); i++) {
+      auto str = vec->Get(i);
+      auto len = str->size();
+      if (!Check(len < static_cast<size_t>(end_ - str->Data())) ||
+          !Check(str->Data()[len] == '\0') ||
+          !VerifyUTF8(str)) {
+        return false;
       }
-      return true;
+      #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+        Verify(str, sizeof(uoffset_t) + len + 1);  // Track the upper bound.
+      #endif
+    }
+    return true;
   }
 
   // Special case for table contents, after the above has been called.
   template<typename T> bool VerifyVectorOfTables(const Vector<Offset<T>> *vec) {
     if (vec) {
+      // Fail early if any table does not even start inside the buffer.
+      if (!VerifyOffsetTargets(vec, sizeof(soffset_t))) return false;
+      if (runner_ && vec->size() >= 2 * min_tables_per_task_) {
+        return VerifyTablesInParallel(vec);
+      }
       for (uoffset_t i = 0; i < vec->size(); i++) {
         if (!vec->Get(i)->Verify(*this)) return false;
       }
@@ -1363,6 +2775,17 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return true;
   }
 
+  // Verify vectors of at least 2 * min_tables_per_task tables by splitting
+  // them into ranges that are verified by separate tasks on `runner`, which
+  // must outlive this Verifier. The verdict, the limits on depth and number
+  // of tables, and GetComputedSize() are all the same as when verifying
+  // serially. Pass nullptr to go back to serial verification.
+  void SetTaskRunner(TaskRunner *runner,
+                     size_t min_tables_per_task = 256) {
+    runner_ = runner;
+    min_tables_per_task_ = std::max<size_t>(min_tables_per_task, 1);
+  }
+
   // Verify this whole buffer, starting with root type T.
   template<typename T> bool VerifyBuffer(const char *identifier) {
     if (identifier && (size_t(end_ - buf_) < 2 * sizeof(flatbuffers::uoffset_t) ||
@@ -1380,6 +2803,23 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
             ;
   }
 
+  // Verify a buffer written with FinishSizePrefixed(): the size prefix must
+  // fit, and the buffer must verify like VerifyBuffer() within that size.
+  template<typename T> bool VerifySizePrefixedBuffer(const char *identifier) {
+    if (!Verify<uoffset_t>(buf_)) return false;
+    auto size = ReadScalar<uoffset_t>(buf_);
+    if (!Check(size <= static_cast<size_t>(end_ - buf_) - sizeof(uoffset_t)))
+      return false;
+    auto buf = buf_;
+    auto end = end_;
+    buf_ += sizeof(uoffset_t);
+    end_ = buf_ + size;
+    auto ok = VerifyBuffer<T>(identifier);
+    buf_ = buf;
+    end_ = end;
+    return ok;
+  }
+
   // Called at the start of a table to increase counters measuring data
   // structure depth and amount, and possibly bails out with false if
   // limits set by the constructor have been hit. Needs to be balanced
@@ -1407,12 +2847,78 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   #endif
 
  private:
+  // Checks every offset in a vector that was already verified points to at
+  // least min_size bytes inside the buffer.
+  template<typename T> bool VerifyOffsetTargets(const Vector<Offset<T>> *vec,
+                                                size_t min_size) const {
+    return Check(OffsetTargetsInRange(vec->Data(), vec->size(),
+                                      vec->Data() - buf_, end_ - buf_,
+                                      min_size));
+  }
+
+  bool VerifyUTF8(const String *str) const {
+    return !check_utf8_ || Check(IsValidUTF8(str->Data(), str->size()));
+  }
+
+  template<typename T> struct TableRanges {
+    const Vector<Offset<T>> *vec;
+    size_t num_ranges;
+    std::vector<Verifier> *verifiers;  // One per range.
+    std::vector<uint8_t> *ok;          // Verdict per range.
+  };
+
+  template<typename T> static void VerifyTableRange(void *ctx, size_t range) {
+    auto &ranges = *reinterpret_cast<TableRanges<T> *>(ctx);
+    auto size = ranges.vec->size();
+    auto begin = size * range / ranges.num_ranges;
+    auto end = size * (range + 1) / ranges.num_ranges;
+    auto &verifier = (*ranges.verifiers)[range];
+    bool ok = true;
+    for (auto i = begin; ok && i < end; i++) {
+      ok = ranges.vec->Get(static_cast<uoffset_t>(i))->Verify(verifier);
+    }
+    (*ranges.ok)[range] = ok;
+  }
+
+  // Each range gets its own Verifier, starting at the current depth, with
+  // whatever is left of the table budget, and their counts are merged after.
+  // The serial Verifier fails iff the total goes over max_tables_ at some
+  // point, and counts only go up, so checking the total is equivalent.
+  template<typename T> bool VerifyTablesInParallel(
+                                                 const Vector<Offset<T>> *vec) {
+    auto num_ranges = std::min<size_t>(runner_->Concurrency() * 4,
+                                       vec->size() / min_tables_per_task_);
+    Verifier child(*this);
+    child.num_tables_ = 0;
+    child.max_tables_ = max_tables_ - num_tables_;
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+      child.upper_bound_ = buf_;
+    #endif
+    std::vector<Verifier> verifiers(num_ranges, child);
+    std::vector<uint8_t> ok(num_ranges, 0);
+    TableRanges<T> ranges = { vec, num_ranges, &verifiers, &ok };
+    runner_->ForEach(num_ranges, VerifyTableRange<T>, &ranges);
+    bool all_ok = true;
+    for (size_t i = 0; i < num_ranges; i++) {
+      all_ok = all_ok && ok[i];
+      num_tables_ += verifiers[i].num_tables_;
+      #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+        if (upper_bound_ < verifiers[i].upper_bound_)
+          upper_bound_ = verifiers[i].upper_bound_;
+      #endif
+    }
+    return Check(all_ok && num_tables_ <= max_tables_);
+  }
+
   const uint8_t *buf_;
   const uint8_t *end_;
   size_t depth_;
   size_t max_depth_;
   size_t num_tables_;
   size_t max_tables_;
+  bool check_utf8_;
+  TaskRunner *runner_;
+  size_t min_tables_per_task_;
   #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
   mutable const uint8_t *upper_bound_;
   #endif
@@ -1420,12 +2926,19 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
 // Convenient way to bundle a buffer and its length, to pass it around
 // typed by its root.
-// A BufferRef does not own its buffer.
+// A BufferRef does not own its buffer, unless constructed from a released
+// buffer (or `owner` is set otherwise), in which case copies share ownership.
 struct BufferRefBase {};  // for std::is_base_of
 template<typename T> struct BufferRef : BufferRefBase {
   BufferRef() : buf(nullptr), len(0), must_free(false) {}
   BufferRef(uint8_t *_buf, uoffset_t _len)
     : buf(_buf), len(_len), must_free(false) {}
+  #ifndef FLATBUFFERS_CPP98_STL
+  // Takes ownership of a buffer from FlatBufferBuilder::ReleaseBufferPointer.
+  BufferRef(unique_ptr_t &&_buf, uoffset_t _len)
+    : buf(_buf.get()), len(_len), must_free(false),
+      owner(std::make_shared<unique_ptr_t>(std::move(_buf))) {}
+  #endif
 
   ~BufferRef() { if (must_free) free(buf); }
 
@@ -1439,6 +2952,152 @@ template<typename T> struct BufferRef : BufferRefBase {
   uint8_t *buf;
   uoffset_t len;
   bool must_free;
+  #ifndef FLATBUFFERS_CPP98_STL
+  // Keeps the memory `buf` points into alive, if set.
+  std::shared_ptr<void> owner;
+  #endif
+};
+
+/// @brief Reads buffers written with `FinishSizePrefixed()` one after the
+/// other from a stream of bytes, such as a mapped log file or the data of
+/// successive `read()` calls:
+///
+///     flatbuffers::BufferStreamReader reader(VerifyMonsterBuffer);
+///     while ((len = read(fd, chunk, sizeof(chunk))) > 0) {
+///       reader.Append(chunk, len);
+///       const uint8_t *buf;
+///       size_t size;
+///       while (reader.Next(&buf, &size)) Process(GetMonster(buf));
+///       if (reader.Failed()) break;
+///     }
+///
+/// Buffers that lie entirely within the data given to `Append()` are
+/// verified and returned in place. Only those split over two `Append()`
+/// calls, or not aligned in the data, are copied first, into storage that is
+/// reused for the next one.
+class BufferStreamReader {
+ public:
+  /// @param[in] verify Run on every buffer before it is returned, e.g. the
+  /// generated `VerifyMonsterBuffer`, or `nullptr` to trust the stream.
+  /// @param[in] max_size A buffer that claims to be larger than this fails
+  /// the stream, rather than having its size allocated.
+  explicit BufferStreamReader(bool (*verify)(Verifier &verifier) = nullptr,
+                              size_t max_size = FLATBUFFERS_MAX_BUFFER_SIZE)
+    : verify_(verify), max_size_(max_size), data_(nullptr), end_(nullptr),
+      carried_(0), failed_(false) {}
+
+  /// @brief Continue the stream with `len` more bytes, which must stay valid
+  /// until `Next()` returns false. By then, whatever part of a buffer is left
+  /// over has been copied.
+  void Append(const void *data, size_t len) {
+    assert(data_ == end_);  // Call Next() until it returns false first.
+    data_ = reinterpret_cast<const uint8_t *>(data);
+    end_ = data_ + len;
+  }
+
+  /// @brief Get the next complete buffer. It stays valid until the next call.
+  /// @param[out] buf The buffer, past its size prefix, i.e. for `GetRoot()`.
+  /// @param[out] size Its size, not counting the prefix.
+  /// @return false if more data must be appended first, or if the stream
+  /// failed (see `Failed()`).
+  bool Next(const uint8_t **buf, size_t *size) {
+    if (failed_) return false;
+    if (carried_) {
+      // Complete the buffer started in earlier data, the size prefix first.
+      if (carried_ < sizeof(uoffset_t) &&
+          !Carry(sizeof(uoffset_t) - carried_)) {
+        return false;
+      }
+      auto total = sizeof(uoffset_t) + ReadScalar<uoffset_t>(carry());
+      if (total - sizeof(uoffset_t) > max_size_) return Fail();
+      if (!Carry(total - carried_)) return false;
+      carried_ = 0;
+      return Found(carry(), total, buf, size);
+    }
+    auto avail = static_cast<size_t>(end_ - data_);
+    if (avail >= sizeof(uoffset_t)) {
+      auto total = sizeof(uoffset_t) + ReadPrefix(data_);
+      if (total - sizeof(uoffset_t) > max_size_) return Fail();
+      if (avail >= total) {
+        auto start = data_;
+        data_ += total;
+        // Finish() made the buffer size a multiple of the buffer's alignment.
+        auto align = std::min(AlignOf<largest_scalar_t>(),
+                              total & (~total + 1));
+        if (reinterpret_cast<uintptr_t>(start) & (align - 1)) {
+          Reserve(total);
+          memcpy(carry(), start, total);
+          start = carry();
+        }
+        return Found(start, total, buf, size);
+      }
+    }
+    Carry(avail);
+    return false;
+  }
+
+  /// @brief Whether a buffer failed verification, or was too large.
+  bool Failed() const { return failed_; }
+
+  /// @brief The number of bytes of an incomplete buffer held back for the
+  /// next `Append()`, e.g. to detect a truncated file.
+  size_t Pending() const { return carried_; }
+
+ private:
+  BufferStreamReader(const BufferStreamReader &);
+  BufferStreamReader &operator=(const BufferStreamReader &);
+
+  uint8_t *carry() { return reinterpret_cast<uint8_t *>(carry_.data()); }
+
+  // The size prefix, which need not be aligned in the appended data.
+  static uoffset_t ReadPrefix(const uint8_t *p) {
+    uoffset_t prefix;
+    memcpy(&prefix, p, sizeof(prefix));
+    return EndianScalar(prefix);
+  }
+
+  void Reserve(size_t len) {
+    auto words = (len + sizeof(largest_scalar_t) - 1) /
+                 sizeof(largest_scalar_t);
+    if (carry_.size() < words) carry_.resize(words);
+  }
+
+  // Moves up to `len` bytes of the data to the carried over buffer, returns
+  // whether that was all of them.
+  bool Carry(size_t len) {
+    auto avail = static_cast<size_t>(end_ - data_);
+    auto n = std::min(len, avail);
+    if (!n) return !len;
+    Reserve(carried_ + n);
+    memcpy(carry() + carried_, data_, n);
+    carried_ += n;
+    data_ += n;
+    return n == len;
+  }
+
+  bool Found(const uint8_t *start, size_t total, const uint8_t **buf,
+             size_t *size) {
+    *buf = start + sizeof(uoffset_t);
+    *size = total - sizeof(uoffset_t);
+    if (verify_) {
+      Verifier verifier(*buf, *size);
+      if (!verify_(verifier)) return Fail();
+    }
+    return true;
+  }
+
+  bool Fail() {
+    failed_ = true;
+    return false;
+  }
+
+  bool (*verify_)(Verifier &verifier);
+  size_t max_size_;
+  const uint8_t *data_;
+  const uint8_t *end_;
+  std::vector<largest_scalar_t> carry_;  // Aligned for any buffer.
+  size_t carried_;
+  bool failed_;
 };
 
 // "structs" are flat structures that do not have an offset table, thus
@@ -1499,6 +3158,18 @@ class Table {
     return const_cast<Table *>(this)->GetPointer<P>(field);
   }
 
+  // As GetPointer, for fields with the `offset64` attribute.
+  template<typename P> P GetPointer64(voffset_t field) {
+    auto field_offset = GetOptionalFieldOffset(field);
+    auto p = data_ + field_offset;
+    return field_offset
+      ? reinterpret_cast<P>(p + ReadScalar<uoffset64_t>(p))
+      : nullptr;
+  }
+  template<typename P> P GetPointer64(voffset_t field) const {
+    return const_cast<Table *>(this)->GetPointer64<P>(field);
+  }
+
   template<typename P> P GetStruct(voffset_t field) const {
     auto field_offset = GetOptionalFieldOffset(field);
     auto p = const_cast<uint8_t *>(data_ + field_offset);
@@ -1537,6 +3208,7 @@ class Table {
   // Verify the vtable of this table.
   // Call this once per table, followed by VerifyField once per field.
   bool VerifyTableStart(Verifier &verifier) const {
+    FLATBUFFERS_PERF_COUNT(tables_verified, 1);
     // Check the vtable offset.
     if (!verifier.Verify<soffset_t>(data_)) return false;
     auto vtable = data_ - ReadScalar<soffset_t>(data_);
@@ -1565,6 +3237,16 @@ class Table {
            verifier.Verify<T>(data_ + field_offset);
   }
 
+  // VerifyField for fields with the `offset64` attribute, which also checks
+  // the offset before GetPointer64() follows it.
+  bool VerifyOffset64(const Verifier &verifier, voffset_t field,
+                      bool required = false) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    if (!field_offset) return verifier.Check(!required);
+    return verifier.Verify<uoffset64_t>(data_ + field_offset) &&
+           verifier.VerifyOffset64(data_ + field_offset);
+  }
+
  private:
   // private constructor & copy constructor: you obtain instances of this
   // class by pointing to existing data only
@@ -1625,45 +3307,44 @@ template <typename T>
 class ListModel : public AbstractListModel
 {
 public:
-  ListModel(std::vector<T> &vector) : m_vector(vector) {}
+  ListModel(std::vector<T> &vector) : m_vector(&vector) {}
 
   // QAbstractItemModel interface
   int rowCount(const QModelIndex &parent) const override {
     if (parent.isValid())
       return 0;
-    return m_vector.size();
+    return m_vector->size();
   }
 
   QVariant data(const QModelIndex &index, int role) const override {
-    if (!index.isValid() || size_t(index.row()) >= m_vector.size() ||
+    if (!index.isValid() || size_t(index.row()) >= m_vector->size() ||
       role != Qt::DisplayRole) {
       return QVariant();
       }
-      return QVariant::fromValue(m_vector[index.row()]);
+      return QVariant::fromValue((*m_vector)[index.row()]);
   }
 
   bool setData(const QModelIndex &index, const QVariant &value, int role) override {
-    if (!index.isValid() || size_t(index.row()) >= m_vector.size() ||
+    if (!index.isValid() || size_t(index.row()) >= m_vector->size() ||
       !value.canConvert<T>() ||
       role != Qt::DisplayRole) {
       return false;
       }
-      m_vector[index.row()] = value.value<T>();
+      (*m_vector)[index.row()] = value.value<T>();
     return true;
   }
 
   bool insertRows(int row, int count, const QModelIndex &parent) override {
-    if (size_t(row) > m_vector.size() || parent.isValid())
+    if (size_t(row) > m_vector->size() || parent.isValid())
       return false;
-    for (auto it = m_vector.begin() + row; count--; ++it)
-      m_vector.emplace(it);
+    m_vector->insert(m_vector->begin() + row, size_t(count), T());
     return true;
   }
   bool removeRows(int row, int count, const QModelIndex &parent) override {
-    if (size_t(row + count) >= m_vector.size() || parent.isValid())
+    if (size_t(row + count) >= m_vector->size() || parent.isValid())
       return false;
-    auto it = m_vector.begin() + row;
-    m_vector.erase(it, it + count);
+    auto it = m_vector->begin() + row;
+    m_vector->erase(it, it + count);
     return true;
   }
   QHash<int, QByteArray> roleNames() const override {
@@ -1671,80 +3352,402 @@ public:
     return names;
   }
 
+  // Replaces the vector with `size` elements, given by `unpack(element,
+  // index)`, telling views only about the rows that changed (according to
+  // T's operator==), or were added or removed at the end. Each element is
+  // first unpacked into a scratch copy to compare it; the rows that changed
+  // are then unpacked again in place, so that the models of their own
+  // vectors get updated too.
+  template <typename F>
+  void update(size_t size, F unpack) {
+    auto common = std::min(size, m_vector->size());
+    T scratch = T();
+    size_t changed = 0, first_changed = 0;
+    for (size_t i = 0; i < common; ++i) {
+      unpack(scratch, uoffset_t(i));
+      if (scratch == (*m_vector)[i]) {
+        repoint((*m_vector)[i], scratch);
+        if (changed)
+          emit dataChanged(index(int(first_changed)), index(int(i - 1)));
+        changed = 0;
+        continue;
+      }
+      fill((*m_vector)[i], unpack, i);
+      if (!changed++)
+        first_changed = i;
+    }
+    if (changed)
+      emit dataChanged(index(int(first_changed)), index(int(common - 1)));
+
+    if (size > common) {
+      beginInsertRows(QModelIndex(), int(common), int(size - 1));
+      m_vector->resize(size);
+      for (size_t i = common; i < size; ++i)
+        fill((*m_vector)[i], unpack, i);
+      endInsertRows();
+    } else if (m_vector->size() > common) {
+      beginRemoveRows(QModelIndex(), int(common), int(m_vector->size() - 1));
+      m_vector->erase(m_vector->begin() + common, m_vector->end());
+      endRemoveRows();
+    }
+  }
+
+  // The vector was moved, with the table holding it: the rows are the same,
+  // views have nothing to update.
+  void setVector(std::vector<T> &vector) { m_vector = &vector; }
+
+private:
+  // A string that compares equal may still point into the buffer it was
+  // unpacked from (see UnPackString()), which the table is about to let go
+  // of: it shares the new one instead. Tables hold on to their own buffer.
+  static void repoint(QByteArray &to, const QByteArray &from) { to = from; }
+  template <typename R>
+  static void repoint(R, const T &) {}
+
+  template <typename F>
+  static void fill(T &to, F &unpack, size_t i) {
+    unpack(to, uoffset_t(i));
+  }
+  // For the proxies of std::vector<bool>.
+  template <typename R, typename F>
+  static void fill(R to, F &unpack, size_t i) {
+    T val = T();
+    unpack(val, uoffset_t(i));
+    to = val;
+  }
+
+  std::vector<T> *m_vector;
+};
+
+// Holds the ListModel a Qt5 native table hands out for a vector field, so
+// that reading the property again returns the same one. A copy of the table
+// starts without one, since the model refers to the original vector. Moving
+// the table (as a vector of tables does when it grows) moves the model along,
+// so that views keep showing it.
+template <typename T>
+class ListModelCache
+{
+public:
+  ListModelCache() : m_model(nullptr), m_offset(0) {}
+  ListModelCache(const ListModelCache &) : m_model(nullptr), m_offset(0) {}
+  ListModelCache(ListModelCache &&other) FLATBUFFERS_NOEXCEPT
+    : m_model(nullptr), m_offset(0) {
+    *this = std::move(other);
+  }
+  ListModelCache &operator=(const ListModelCache &) { return *this; }
+  ListModelCache &operator=(ListModelCache &&other) FLATBUFFERS_NOEXCEPT {
+    if (this == &other) return *this;
+    delete m_model;
+    m_model = other.m_model;
+    m_offset = other.m_offset;
+    other.m_model = nullptr;
+    if (m_model) m_model->setVector(vector());
+    return *this;
+  }
+  ~ListModelCache() { delete m_model; }
+
+  ListModel<T> *get(std::vector<T> &vector) {
+    if (!m_model) {
+      m_model = new ListModel<T>(vector);
+      m_offset = reinterpret_cast<uint8_t *>(&vector) -
+                 reinterpret_cast<uint8_t *>(this);
+    }
+    return m_model;
+  }
+
+  // The model, if it has been created, for UnPack() to update.
+  ListModel<T> *model() const { return m_model; }
+
+private:
+  // The vector is a member of the same table as the cache, so it is always
+  // found at the same offset from it.
+  std::vector<T> &vector() {
+    return *reinterpret_cast<std::vector<T> *>(
+        reinterpret_cast<uint8_t *>(this) + m_offset);
+  }
+
+  ListModel<T> *m_model;
+  ptrdiff_t m_offset;  // From the cache to the vector.
+};
+
+// How VectorModel below presents the elements of a Vector<T>: scalars as a
+// single "modelData" role, ...
+template <typename T>
+struct VectorModelRoles
+{
+  static QVariant data(T value, int role) {
+    return role == Qt::DisplayRole ? QVariant::fromValue(value) : QVariant();
+  }
+  static QHash<int, QByteArray> names() {
+    return {{Qt::DisplayRole, "modelData"}};
+  }
+};
+
+// ... strings as well, without copying them out of the buffer, ...
+template <>
+struct VectorModelRoles<Offset<String>>
+{
+  static QVariant data(const String *value, int role) {
+    if (role != Qt::DisplayRole)
+      return QVariant();
+    return QByteArray::fromRawData(value->c_str(), int(value->size()));
+  }
+  static QHash<int, QByteArray> names() {
+    return {{Qt::DisplayRole, "modelData"}};
+  }
+};
+
+// ... structs as well, ...
+template <typename T>
+struct VectorModelRoles<const T *>
+{
+  static QVariant data(const T *value, int role) {
+    return role == Qt::DisplayRole ? QVariant::fromValue(*value) : QVariant();
+  }
+  static QHash<int, QByteArray> names() {
+    return {{Qt::DisplayRole, "modelData"}};
+  }
+};
+
+// ... and tables with a role per field, see the QtRoleNames() and
+// QtRoleData() the Qt5 generator adds to them.
+template <typename T>
+struct VectorModelRoles<Offset<T>>
+{
+  static QVariant data(const T *value, int role) {
+    return value->QtRoleData(role);
+  }
+  static QHash<int, QByteArray> names() { return T::QtRoleNames(); }
+};
+
+// A read-only list model over a vector in a FlatBuffer, such that QML views
+// of large vectors don't need the buffer unpacked. The buffer must outlive
+// the model.
+template <typename T>
+class VectorModel : public QAbstractListModel
+{
+public:
+  explicit VectorModel(const Vector<T> *vector, QObject *parent = nullptr)
+    : QAbstractListModel(parent), m_vector(vector) {}
+
+  // QAbstractItemModel interface
+  int rowCount(const QModelIndex &parent = QModelIndex()) const override {
+    if (parent.isValid() || !m_vector)
+      return 0;
+    return int(m_vector->size());
+  }
+
+  QVariant data(const QModelIndex &index, int role) const override {
+    if (!index.isValid() || !m_vector ||
+        uoffset_t(index.row()) >= m_vector->size())
+      return QVariant();
+    return VectorModelRoles<T>::data(m_vector->Get(uoffset_t(index.row())),
+                                     role);
+  }
+
+  QHash<int, QByteArray> roleNames() const override {
+    static QHash<int, QByteArray> names = VectorModelRoles<T>::names();
+    return names;
+  }
+
+  // Show another vector, such as the same field in a newer buffer.
+  void setVector(const Vector<T> *vector) {
+    beginResetModel();
+    m_vector = vector;
+    endResetModel();
+  }
+
+  const Vector<T> *vector() const { return m_vector; }
+
 private:
-  std::vector<T> &m_vector;
+  const Vector<T> *m_vector;
+};
+
+template <typename T>
+VectorModel<T> *NewVectorModel(const Vector<T> *vector, QObject *parent) {
+  return new VectorModel<T>(vector, parent);
+}
+
+// Holds the VectorModel the Qt5 generated models object of a table hands out
+// for a vector field, made on first use, so that reading the property again
+// returns the same one. The model is a child of the models object, which
+// deletes it.
+template <typename T>
+class VectorModelCache
+{
+public:
+  VectorModelCache() : m_model(nullptr) {}
+
+  VectorModel<T> *get(const Vector<T> *vector, QObject *parent) {
+    if (!m_model)
+      m_model = new VectorModel<T>(vector, parent);
+    return m_model;
+  }
+
+  // Show another vector in the model, if it has been made.
+  void set(const Vector<T> *vector) {
+    if (m_model)
+      m_model->setVector(vector);
+  }
+
+private:
+  VectorModelCache(const VectorModelCache &);
+  VectorModelCache &operator=(const VectorModelCache &);
+
+  VectorModel<T> *m_model;
 };
+
+// Makes `buffer` the calling thread's source buffer while in scope. Native
+// tables generated with --object-api-raw-strings that are unpacked from it
+// then share it, and their strings point into it rather than copying it.
+// Scopes may be nested. `buffer` must own its data: one made with
+// QByteArray::fromRawData() shares nothing, so the strings would point into
+// memory that nothing keeps alive.
+class SourceBufferScope {
+ public:
+  explicit SourceBufferScope(const QByteArray &buffer) : prev_(CurrentRef()) {
+    CurrentRef() = &buffer;
+  }
+  ~SourceBufferScope() { CurrentRef() = prev_; }
+
+  // The current source buffer, if `table` lies in it.
+  static const QByteArray *Find(const void *table) {
+    auto buffer = CurrentRef();
+    if (!buffer) return nullptr;
+    auto p = reinterpret_cast<const char *>(table);
+    auto begin = buffer->constData();
+    return p >= begin && p < begin + buffer->size() ? buffer : nullptr;
+  }
+
+ private:
+  SourceBufferScope(const SourceBufferScope &);
+  SourceBufferScope &operator=(const SourceBufferScope &);
+
+  static const QByteArray *&CurrentRef() {
+    static thread_local const QByteArray *current = nullptr;
+    return current;
+  }
+
+  const QByteArray *prev_;
+};
+
+// Points `to` at `str` in `source`, if given, or else copies it.
+inline void UnPackString(const String *str, QByteArray &to,
+                         const QByteArray *source) {
+  if (source)
+    to = QByteArray::fromRawData(str->c_str(), int(str->size()));
+  else
+    to = QByteArray(str->c_str(), int(str->size()));
+}
+
+// Stores `str`, which UnPackString() may have pointed into `source`. If it
+// still does, the string is copied from there, so that strings shared in
+// `source` stay shared. `source` is the buffer the table was unpacked from
+// (see SourceBufferScope).
+inline Offset<String> PackString(FlatBufferBuilder &fbb, const QByteArray &str,
+                                 const QByteArray &source) {
+  auto data = str.constData();
+  auto begin = source.constData();
+  auto end = begin + source.size();
+  // A String in `source`, with its length, contents and terminator in
+  // bounds, and exactly the contents of `str`.
+  if (data >= begin + sizeof(uoffset_t) && data + str.size() < end &&
+      (data - begin) % sizeof(uoffset_t) == 0 && !data[str.size()]) {
+    auto s = reinterpret_cast<const String *>(data - sizeof(uoffset_t));
+    if (s->c_str() == data && int(s->size()) == str.size())
+      return fbb.CreateStringCopy(s);
+  }
+  return fbb.CreateString(str);
+}
 #endif
 
-template<typename T>
+// A nullable, owned pointer to a struct or native table in the object API.
+// Memory comes from `A` (see arena_allocator in arena.h), so a pointer passed
+// to the constructor that takes ownership must have been allocated with it.
+// Assigning null (as UnPack() does for absent fields) keeps the old object
+// around, and assigning a value again reuses it, so that unpacking into the
+// same objects repeatedly doesn't allocate. release() frees it.
+template<typename T, typename A = std::allocator<T>>
 class Optional
 {
 public:
-  Optional() : val_(nullptr) {}
-  Optional(T *val) : val_(val) {}
-  Optional(const T &other) : val_(new T(other)) {}
-  Optional(const Optional<T> &other) {
-    if (other)
-      val_ = new T(*other.val_);
-    else
-      val_ = nullptr;
+  Optional() : val_(nullptr), set_(false) {}
+  Optional(T *val) : val_(val), set_(val != nullptr) {}
+  Optional(const T &other) : val_(New(other)), set_(true) {}
+  Optional(const Optional &other) : val_(nullptr), set_(false) {
+    if (other) {
+      val_ = New(*other.val_);
+      set_ = true;
+    }
   }
-  ~Optional() { delete val_;}
+  // Moving hands the object over, so that vectors of native tables move
+  // them when they grow, rather than copying them.
+  Optional(Optional &&other) FLATBUFFERS_NOEXCEPT
+    : val_(other.val_), set_(other.set_) {
+    other.val_ = nullptr;
+    other.set_ = false;
+  }
+  ~Optional() { Delete(val_);}
 
-  inline operator bool() const { return val_; }
+  inline operator bool() const { return set_; }
 
-  inline T *get() const { return val_; }
-  inline operator T * () const { return val_; }
-  inline T * operator ->() const { return val_; }
+  inline T *get() const { return set_ ? val_ : nullptr; }
+  inline operator T * () const { return get(); }
+  inline T * operator ->() const { return get(); }
 
-  inline T *create() { delete val_; val_ = new T(); return val_; }
-  inline void release() { delete val_; val_ = nullptr; }
+  inline T *create() {
+    Delete(val_);
+    val_ = New();
+    set_ = true;
+    return val_;
+  }
+  inline void release() { Delete(val_); val_ = nullptr; set_ = false; }
+  // Like release(), but keeps the object for reuse.
+  inline void clear() { set_ = false; }
 
-  inline Optional &operator =(const Optional<T> &other) {
+  inline Optional &operator =(const Optional &other) {
     if (!other) {
-      release();
+      clear();
       return *this;
     }
-    if (!val_)
-      val_ = new T(*other.val_);
-    else
-      *val_ = *other.val_;
+    return *this = *other.val_;
+  }
+
+  inline Optional &operator =(Optional &&other) FLATBUFFERS_NOEXCEPT {
+    std::swap(val_, other.val_);
+    std::swap(set_, other.set_);
     return *this;
   }
 
   inline Optional &operator =(const T &other) {
     if (!val_)
-      val_ = new T(other);
-    else
+      val_ = New(other);
+    else if (val_ != &other)
       *val_ = other;
+    set_ = true;
     return *this;
   }
 
   inline Optional &operator =(const T *other) {
     if (!other) {
-      release();
+      clear();
       return *this;
     }
-
-    if (!val_)
-      val_ = new T(*other);
-    else
-      *val_ = *other;
-    return *this;
+    return *this = *other;
   }
 
-  inline bool operator ==(const Optional<T> &other) const {
-    if (val_ && other.val_)
+  inline bool operator ==(const Optional &other) const {
+    if (set_ && other.set_)
         return *val_ == *other.val_;
     return false;
   }
 
-  inline bool operator !=(const Optional<T> &other) const {
+  inline bool operator !=(const Optional &other) const {
       return !operator==(other);
   }
 #ifdef FLATBUFFERS_USE_QT
   inline QVariant toQVariant() const {
-    return val_ ? QVariant::fromValue(*val_) : QVariant();
+    return set_ ? QVariant::fromValue(*val_) : QVariant();
   }
   inline Optional &fromQVariant(const QVariant &val) {
     if (val.isNull() || !val.canConvert<T>())
@@ -1755,25 +3758,126 @@ public:
   }
 #endif
 protected:
+  static T *New() { return ::new (A().allocate(1)) T(); }
+  template<typename U> static T *New(const U &u) {
+    return ::new (A().allocate(1)) T(u);
+  }
+  static void Delete(T *p) {
+    if (!p) return;
+    p->~T();
+    A().deallocate(p, 1);
+  }
+
   T *val_;
+  bool set_;  // val_ may be kept for reuse while unset.
 };
 
-template<typename T, typename S>
-class OptionalTable : public Optional<T> {
+template<typename T, typename S, typename A = std::allocator<T>>
+class OptionalTable : public Optional<T, A> {
 public:
-  using Optional<T>::operator=;
+  using Optional<T, A>::operator=;
   inline OptionalTable &operator =(const S *other) {
     if (!other) {
-      this->release();
+      this->clear();
       return *this;
     }
     if (!this->val_)
-      this->val_ = new T(other);
+      this->val_ = this->New(other);
     else
       *(this->val_) = other;
+    this->set_ = true;
     return *this;
   }
 };
+
+// A nullable struct in the object API, with the same interface as Optional.
+// Structs are small and of fixed size, so rather than a pointer to one this
+// holds the struct itself, next to a flag telling whether it is set.
+template<typename T>
+class OptionalStruct
+{
+public:
+  OptionalStruct() : set_(false) {}
+  OptionalStruct(const T &other) : val_(other), set_(true) {}
+  OptionalStruct(const T *other) : set_(other != nullptr) {
+    if (other) put(*other);
+  }
+  // Structs are copied with memcpy(), which can't throw.
+  OptionalStruct(const OptionalStruct &other) FLATBUFFERS_NOEXCEPT
+    : val_(other.val_), set_(other.set_) {}
+
+  inline operator bool() const { return set_; }
+
+  inline T *get() const { return set_ ? const_cast<T *>(&val_) : nullptr; }
+  inline operator T * () const { return get(); }
+  inline T * operator ->() const { return get(); }
+
+  inline T *create() { put(T()); set_ = true; return &val_; }
+  inline void release() { set_ = false; }
+  inline void clear() { set_ = false; }
+
+  inline OptionalStruct &operator =(const T &other) {
+    if (&other != &val_) put(other);  // May be our own struct, from get().
+    set_ = true;
+    return *this;
+  }
+
+  inline OptionalStruct &operator =(const OptionalStruct &other) {
+    if (this != &other) {
+      put(other.val_);
+      set_ = other.set_;
+    }
+    return *this;
+  }
+
+  inline OptionalStruct &operator =(const T *other) {
+    if (!other) {
+      clear();
+      return *this;
+    }
+    return *this = *other;
+  }
+
+  inline bool operator ==(const OptionalStruct &other) const {
+    if (set_ && other.set_)
+      return val_ == other.val_;
+    return false;
+  }
+
+  inline bool operator !=(const OptionalStruct &other) const {
+      return !operator==(other);
+  }
+#ifdef FLATBUFFERS_USE_QT
+  inline QVariant toQVariant() const {
+    return set_ ? QVariant::fromValue(val_) : QVariant();
+  }
+  inline OptionalStruct &fromQVariant(const QVariant &val) {
+    if (val.isNull() || !val.canConvert<T>())
+      clear();
+    else
+      *this = val.value<T>();
+    return *this;
+  }
+#endif
+private:
+  // Generated structs have a copy constructor but no copy assignment.
+  void put(const T &other) { new (&val_) T(other); }
+
+  T val_;
+  bool set_;
+};
+
+// A member of a lazily unpacked native table (see `flatc --object-api-lazy`):
+// the native value, and whether it has been unpacked from the source table.
+template<typename T>
+struct LazyField
+{
+  LazyField() : value(), loaded(false) {}
+  explicit LazyField(const T &val) : value(val), loaded(false) {}
+
+  T value;
+  bool loaded;
+};
 // Helper function to test if a field is present, using any of the field
 // enums in the generated code.
 // `table` must be a generated table type. Since this is a template parameter,
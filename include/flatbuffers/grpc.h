@@ -30,41 +30,83 @@ class SerializationTraits<T, typename std::enable_if<std::is_base_of<
  public:
   // The type we're passing here is a BufferRef, which is already serialized
   // FlatBuffer data, which then gets passed to GRPC.
+  // If the BufferRef owns its memory (e.g. it was constructed from
+  // FlatBufferBuilder::ReleaseBufferPointer()), GRPC shares ownership of it
+  // and no copy is made. Otherwise the buffer may be reused as soon as the
+  // call returns, so it must be copied.
   static grpc::Status Serialize(const T& msg,
                                 grpc_byte_buffer **buffer,
                                 bool *own_buffer) {
-    // TODO(wvo): make this work without copying.
-    auto slice = gpr_slice_from_copied_buffer(
-                   reinterpret_cast<const char *>(msg.buf), msg.len);
+    gpr_slice slice;
+    if (msg.owner) {
+      slice = gpr_slice_new_with_user_data(msg.buf, msg.len, ReleaseOwner,
+                                           new std::shared_ptr<void>(
+                                             msg.owner));
+    } else {
+      slice = gpr_slice_from_copied_buffer(
+                reinterpret_cast<const char *>(msg.buf), msg.len);
+    }
     *buffer = grpc_raw_byte_buffer_create(&slice, 1);
+    gpr_slice_unref(slice);  // The byte buffer holds its own reference.
     *own_buffer = true;
     return grpc::Status();
   }
 
   // There is no de-serialization step in FlatBuffers, so we just receive
-  // the data from GRPC.
+  // the data from GRPC. If it arrived in a single slice, the message refers
+  // to it in place, otherwise the slices are joined into one allocation.
   static grpc::Status Deserialize(grpc_byte_buffer *buffer,
                                   T *msg,
                                   int max_message_size) {
-    // TODO(wvo): make this more efficient / zero copy when possible.
     auto len = grpc_byte_buffer_length(buffer);
-    msg->buf = reinterpret_cast<uint8_t *>(malloc(len));
-    msg->len = static_cast<flatbuffers::uoffset_t>(len);
-    msg->must_free = true;
-    uint8_t *current = msg->buf;
     grpc_byte_buffer_reader reader;
     grpc_byte_buffer_reader_init(&reader, buffer);
-    gpr_slice slice;
-    while (grpc_byte_buffer_reader_next(&reader, &slice)) {
-      memcpy(current, GPR_SLICE_START_PTR(slice), GPR_SLICE_LENGTH(slice));
-      current += GPR_SLICE_LENGTH(slice);
-      gpr_slice_unref(slice);
+    gpr_slice first, slice;
+    if (!grpc_byte_buffer_reader_next(&reader, &first)) {
+      first = gpr_empty_slice();
+    }
+    if (!grpc_byte_buffer_reader_next(&reader, &slice)) {
+      // Single slice: keep a reference to it for as long as msg needs it.
+      // Small slices hold their data inline, so point into the copy that is
+      // kept, not into `first`.
+      auto kept = new gpr_slice(first);
+      *msg = T(GPR_SLICE_START_PTR(*kept),
+               static_cast<flatbuffers::uoffset_t>(GPR_SLICE_LENGTH(*kept)));
+      msg->owner = std::shared_ptr<void>(kept, UnrefSlice);
+    } else {
+      *msg = T();
+      msg->buf = reinterpret_cast<uint8_t *>(malloc(len));
+      msg->len = static_cast<flatbuffers::uoffset_t>(len);
+      msg->must_free = true;
+      uint8_t *current = msg->buf;
+      current = Append(current, first);
+      do {
+        current = Append(current, slice);
+      } while (grpc_byte_buffer_reader_next(&reader, &slice));
+      GPR_ASSERT(current == msg->buf + msg->len);
     }
-    GPR_ASSERT(current == msg->buf + msg->len);
     grpc_byte_buffer_reader_destroy(&reader);
     grpc_byte_buffer_destroy(buffer);
     return grpc::Status();
   }
+
+ private:
+  static void ReleaseOwner(void *owner) {
+    delete reinterpret_cast<std::shared_ptr<void> *>(owner);
+  }
+
+  static void UnrefSlice(void *slice) {
+    gpr_slice_unref(*reinterpret_cast<gpr_slice *>(slice));
+    delete reinterpret_cast<gpr_slice *>(slice);
+  }
+
+  // Copies a slice to dest and releases it.
+  static uint8_t *Append(uint8_t *dest, gpr_slice slice) {
+    memcpy(dest, GPR_SLICE_START_PTR(slice), GPR_SLICE_LENGTH(slice));
+    dest += GPR_SLICE_LENGTH(slice);
+    gpr_slice_unref(slice);
+    return dest;
+  }
 };
 
 }  // namespace grpc;
@@ -224,7 +224,8 @@ struct Definition {
 };
 
 struct FieldDef : public Definition {
-  FieldDef() : deprecated(false), required(false), key(false), padding(0) {}
+  FieldDef() : deprecated(false), required(false), key(false),
+               offset64(false), padding(0) {}
 
   Offset<reflection::Field> Serialize(FlatBufferBuilder *builder, uint16_t id,
                                       const Parser &parser) const;
@@ -234,6 +235,7 @@ struct FieldDef : public Definition {
                    // written in new data nor accessed in new code.
   bool required;   // Field must always be present.
   bool key;        // Field functions as a key for creating sorted vectors.
+  bool offset64;   // Vector referred to by a 64-bit offset (see Vector64).
   size_t padding;  // Bytes to always pad after this field.
 };
 
@@ -277,6 +279,13 @@ inline size_t InlineAlignment(const Type &type) {
   return IsStruct(type) ? type.struct_def->minalign : SizeOf(type.base_type);
 }
 
+// The size of a field in a table (other than a struct), as used to order
+// the fields by size.
+inline size_t FieldSize(const FieldDef &field) {
+  return field.offset64 ? sizeof(uoffset64_t)
+                        : SizeOf(field.value.type.base_type);
+}
+
 struct EnumVal {
   EnumVal(const std::string &_name, int64_t _val)
     : name(_name), value(_val), struct_def(nullptr) {}
@@ -347,6 +356,9 @@ struct IDLOptions {
   bool generate_name_strings;
   bool escape_proto_identifiers;
   bool generate_object_based_api;
+  bool object_api_arena;
+  bool object_api_lazy;
+  bool object_api_raw_strings;
   bool union_value_namespacing;
   bool allow_non_utf8;
 
@@ -376,6 +388,9 @@ struct IDLOptions {
       generate_name_strings(false),
       escape_proto_identifiers(false),
       generate_object_based_api(false),
+      object_api_arena(false),
+      object_api_lazy(false),
+      object_api_raw_strings(false),
       union_value_namespacing(true),
       allow_non_utf8(false),
       lang(IDLOptions::kJava),
@@ -449,12 +464,14 @@ class Parser : public ParserState {
     known_attributes_["deprecated"] = true;
     known_attributes_["required"] = true;
     known_attributes_["key"] = true;
+    known_attributes_["key_index"] = true;
     known_attributes_["hash"] = true;
     known_attributes_["id"] = true;
     known_attributes_["force_align"] = true;
     known_attributes_["bit_flags"] = true;
     known_attributes_["original_order"] = true;
     known_attributes_["nested_flatbuffer"] = true;
+    known_attributes_["offset64"] = true;
     known_attributes_["csharp_partial"] = true;
     known_attributes_["streaming"] = true;
     known_attributes_["idempotent"] = true;
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2016 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_POOL_ALLOCATOR_H_
+#define FLATBUFFERS_POOL_ALLOCATOR_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// An allocator for FlatBufferBuilder that recycles buffers instead of
+// returning them to the heap, for programs that build many buffers in a row.
+
+namespace flatbuffers {
+
+// Maximum number of free blocks kept per size class and per thread. Blocks
+// freed beyond this go back to the heap.
+#ifndef FLATBUFFERS_POOL_MAX_CACHED_BLOCKS
+  #define FLATBUFFERS_POOL_MAX_CACHED_BLOCKS 16
+#endif
+
+// Counters of the calling thread's pool, see pool_allocator::thread_stats().
+struct pool_allocator_stats {
+  pool_allocator_stats() : hits(0), misses(0), recycled(0), released(0) {}
+  size_t hits;      // Allocations served from a free list.
+  size_t misses;    // Allocations that had to go to the heap.
+  size_t recycled;  // Deallocations that were put on a free list.
+  size_t released;  // Deallocations that went back to the heap.
+};
+
+// Allocates blocks rounded up to a power of 2 (a "size class"), and keeps
+// freed blocks on per-thread free lists, one per size class.
+// Each block is prefixed with a small header holding its size class, so a
+// block may be freed from any thread (it then joins that thread's pool) and
+// through any pool_allocator instance.
+// Like any allocator passed to FlatBufferBuilder, it must outlive the
+// buffers obtained with ReleaseBufferPointer().
+class pool_allocator : public simple_allocator {
+ public:
+  // Smallest and largest size classes that are pooled, as powers of 2.
+  // Larger requests are passed straight to the heap.
+  static const size_t kMinClass = 8;   // 256 bytes.
+  static const size_t kMaxClass = 26;  // 64MB.
+  static const size_t kNumClasses = kMaxClass - kMinClass + 1;
+
+  virtual uint8_t *allocate(size_t size) const {
+    auto cls = SizeClass(size);
+    auto &pool = ThreadPool();
+    if (cls < kNumClasses && pool.free_lists[cls]) {
+      auto block = pool.free_lists[cls];
+      pool.free_lists[cls] = block->next;
+      block->size_class = cls;
+      pool.num_free[cls]--;
+      pool.stats.hits++;
+      return reinterpret_cast<uint8_t *>(block) + kHeaderSize;
+    }
+    pool.stats.misses++;
+    auto block_size = cls < kNumClasses ? ClassSize(cls) : size;
+    auto block = reinterpret_cast<BlockHeader *>(
+                   new uint8_t[kHeaderSize + block_size]);
+    block->size_class = cls;
+    return reinterpret_cast<uint8_t *>(block) + kHeaderSize;
+  }
+
+  virtual void deallocate(uint8_t *p) const {
+    if (!p) return;
+    auto block = reinterpret_cast<BlockHeader *>(p - kHeaderSize);
+    auto cls = block->size_class;
+    auto &pool = ThreadPool();
+    if (cls < kNumClasses &&
+        pool.num_free[cls] < FLATBUFFERS_POOL_MAX_CACHED_BLOCKS) {
+      block->next = pool.free_lists[cls];
+      pool.free_lists[cls] = block;
+      pool.num_free[cls]++;
+      pool.stats.recycled++;
+      return;
+    }
+    pool.stats.released++;
+    delete[] reinterpret_cast<uint8_t *>(block);
+  }
+
+  // The counters of the calling thread's pool since the last reset.
+  static pool_allocator_stats thread_stats() { return ThreadPool().stats; }
+  static void reset_thread_stats() {
+    ThreadPool().stats = pool_allocator_stats();
+  }
+
+  // Returns all free blocks of the calling thread's pool to the heap.
+  static void trim_thread_pool() { ThreadPool().Trim(); }
+
+ private:
+  union BlockHeader {
+    size_t size_class;
+    BlockHeader *next;  // Only while the block is on a free list.
+    largest_scalar_t align;
+  };
+  // Keep the memory handed out aligned for any scalar.
+  static const size_t kHeaderSize = sizeof(BlockHeader);
+
+  struct ThreadLocalPool {
+    ThreadLocalPool() {
+      for (size_t i = 0; i < kNumClasses; i++) {
+        free_lists[i] = nullptr;
+        num_free[i] = 0;
+      }
+    }
+    ~ThreadLocalPool() { Trim(); }
+
+    void Trim() {
+      for (size_t i = 0; i < kNumClasses; i++) {
+        while (free_lists[i]) {
+          auto block = free_lists[i];
+          free_lists[i] = block->next;
+          delete[] reinterpret_cast<uint8_t *>(block);
+        }
+        num_free[i] = 0;
+      }
+    }
+
+    BlockHeader *free_lists[kNumClasses];
+    size_t num_free[kNumClasses];
+    pool_allocator_stats stats;
+  };
+
+  static ThreadLocalPool &ThreadPool() {
+    static thread_local ThreadLocalPool pool;
+    return pool;
+  }
+
+  // Returns the index of the smallest class that holds `size` bytes, or
+  // kNumClasses if it is too large to be pooled.
+  static size_t SizeClass(size_t size) {
+    size_t cls = 0;
+    while (cls < kNumClasses && ClassSize(cls) < size) cls++;
+    return cls;
+  }
+
+  static size_t ClassSize(size_t cls) {
+    return static_cast<size_t>(1) << (cls + kMinClass);
+  }
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_POOL_ALLOCATOR_H_
@@ -85,15 +85,26 @@ inline const String *GetFieldS(const Table &table,
 template<typename T> Vector<T> *GetFieldV(const Table &table,
                                           const reflection::Field &field) {
   assert(field.type()->base_type() == reflection::Vector &&
-         sizeof(T) == GetTypeSize(field.type()->element()));
+         sizeof(T) == GetTypeSize(field.type()->element()) &&
+         !field.offset64());  // Use GetFieldV64.
   return table.GetPointer<Vector<T> *>(field.offset());
 }
 
+// Get a field, if you know it's a vector with the `offset64` attribute.
+template<typename T> Vector64<T> *GetFieldV64(const Table &table,
+                                              const reflection::Field &field) {
+  assert(field.type()->base_type() == reflection::Vector &&
+         sizeof(T) == GetTypeSize(field.type()->element()) &&
+         field.offset64());
+  return table.GetPointer64<Vector64<T> *>(field.offset());
+}
+
 // Get a field, if you know it's a vector, generically.
 // To actually access elements, use the return value together with
 // field.type()->element() in any of GetAnyVectorElemI below etc.
 inline VectorOfAny *GetFieldAnyV(const Table &table,
                                  const reflection::Field &field) {
+  assert(!field.offset64());  // Has a 64-bit length, use GetFieldV64.
   return table.GetPointer<VectorOfAny *>(field.offset());
 }
 
@@ -365,6 +376,7 @@ void SetString(const reflection::Schema &schema, const std::string &val,
 // "vec" must live inside "flatbuf" and may be invalidated after this call.
 // If your FlatBuffer's root table is not the schema's root table, you should
 // pass in your root_table type as well.
+// Vectors of `offset64` fields (see GetFieldV64) can't be resized.
 uint8_t *ResizeAnyVector(const reflection::Schema &schema, uoffset_t newsize,
                          const VectorOfAny *vec, uoffset_t num_elems,
                          uoffset_t elem_size, std::vector<uint8_t> *flatbuf,
@@ -428,6 +440,36 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const Table &table,
                                 bool use_string_pooling = false);
 
+// Checks that `buf` of `length` bytes holds a valid buffer of `root_table`
+// (the schema's root table by default), like the Verify functions generated
+// for it do. The file identifier is not checked.
+bool VerifyAnyBuffer(const reflection::Schema &schema, const uint8_t *buf,
+                     size_t length,
+                     const reflection::Object *root_table = nullptr,
+                     size_t max_depth = 64, size_t max_tables = 1000000);
+
+// Rewrites a whole buffer into `fbb` in minimal form, keeping its file
+// identifier: space left behind by the resizing functions above or by
+// AddFlatBuffer() is dropped, identical vtables and strings are stored once,
+// and tables and vectors referred to from several places are copied once, so
+// the result reads exactly like the original. The fields of each table are
+// written largest first, so need the least padding. Takes time linear in the
+// size of the buffer, which must be valid (see VerifyAnyBuffer()).
+void CompactBuffer(FlatBufferBuilder &fbb, const reflection::Schema &schema,
+                   const uint8_t *flatbuf,
+                   const reflection::Object *root_table = nullptr);
+
+// As above, replacing the contents of `flatbuf` with the compacted buffer.
+void CompactBuffer(const reflection::Schema &schema,
+                   std::vector<uint8_t> *flatbuf,
+                   const reflection::Object *root_table = nullptr);
+
+// An upper bound on the bytes CopyTable() adds to a builder for `table`, to
+// pass to FlatBufferBuilder::Reserve() so the copy needs a single allocation.
+size_t EstimatePackedSize(const reflection::Schema &schema,
+                          const reflection::Object &objectdef,
+                          const Table &table);
+
 }  // namespace flatbuffers
 
 #endif  // FLATBUFFERS_REFLECTION_H_
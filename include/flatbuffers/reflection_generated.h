@@ -84,6 +84,16 @@ inline flatbuffers::Offset<Type> CreateType(flatbuffers::FlatBufferBuilder &_fbb
     BaseType base_type = None,
     BaseType element = None,
     int32_t index = -1) {
+  if (_fbb.ForcingDefaults() || (index != -1 && static_cast<int8_t>(element) != 0 && static_cast<int8_t>(base_type) != 0)) {
+    // All fields are present, so the layout is known.
+    static const flatbuffers::voffset_t offsets_[] = { 6, 7, 8 };
+    auto start_ = _fbb.StartTable();
+    auto table_ = _fbb.PushPrecomputedTable(12, 4);
+    flatbuffers::WriteScalar<int32_t>(table_ + 8, index);
+    flatbuffers::WriteScalar<int8_t>(table_ + 7, static_cast<int8_t>(element));
+    flatbuffers::WriteScalar<int8_t>(table_ + 6, static_cast<int8_t>(base_type));
+    return flatbuffers::Offset<Type>(_fbb.EndPrecomputedTable(start_, offsets_, 3));
+  }
   TypeBuilder builder_(_fbb);
   builder_.add_index(index);
   builder_.add_element(element);
@@ -99,6 +109,7 @@ struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *key() const { return GetPointer<const flatbuffers::String *>(VT_KEY); }
   bool KeyCompareLessThan(const KeyValue *o) const { return *key() < *o->key(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(key()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_KEY); }
   const flatbuffers::String *value() const { return GetPointer<const flatbuffers::String *>(VT_VALUE); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -149,6 +160,7 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int64_t value() const { return GetField<int64_t>(VT_VALUE, 0); }
   bool KeyCompareLessThan(const EnumVal *o) const { return value() < o->value(); }
   int KeyCompareWithValue(int64_t val) const { return value() < val ? -1 : value() > val; }
+  int64_t GetKey() const { return GetField<int64_t>(VT_VALUE, 0); }
   const Object *object() const { return GetPointer<const Object *>(VT_OBJECT); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
@@ -205,6 +217,7 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Enum *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *values() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *>(VT_VALUES); }
   bool is_union() const { return GetField<uint8_t>(VT_IS_UNION, 0) != 0; }
   const Type *underlying_type() const { return GetPointer<const Type *>(VT_UNDERLYING_TYPE); }
@@ -280,11 +293,13 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_DEPRECATED = 16,
     VT_REQUIRED = 18,
     VT_KEY = 20,
-    VT_ATTRIBUTES = 22
+    VT_ATTRIBUTES = 22,
+    VT_OFFSET64 = 24
   };
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Field *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   const Type *type() const { return GetPointer<const Type *>(VT_TYPE); }
   uint16_t id() const { return GetField<uint16_t>(VT_ID, 0); }
   uint16_t offset() const { return GetField<uint16_t>(VT_OFFSET, 0); }
@@ -294,6 +309,7 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool required() const { return GetField<uint8_t>(VT_REQUIRED, 0) != 0; }
   bool key() const { return GetField<uint8_t>(VT_KEY, 0) != 0; }
   const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *attributes() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<KeyValue>> *>(VT_ATTRIBUTES); }
+  bool offset64() const { return GetField<uint8_t>(VT_OFFSET64, 0) != 0; }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyFieldRequired<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
@@ -310,6 +326,7 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<flatbuffers::uoffset_t>(verifier, VT_ATTRIBUTES) &&
            verifier.Verify(attributes()) &&
            verifier.VerifyVectorOfTables(attributes()) &&
+           VerifyField<uint8_t>(verifier, VT_OFFSET64) &&
            verifier.EndTable();
   }
 };
@@ -327,10 +344,11 @@ struct FieldBuilder {
   void add_required(bool required) { fbb_.AddElement<uint8_t>(Field::VT_REQUIRED, static_cast<uint8_t>(required), 0); }
   void add_key(bool key) { fbb_.AddElement<uint8_t>(Field::VT_KEY, static_cast<uint8_t>(key), 0); }
   void add_attributes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes) { fbb_.AddOffset(Field::VT_ATTRIBUTES, attributes); }
+  void add_offset64(bool offset64) { fbb_.AddElement<uint8_t>(Field::VT_OFFSET64, static_cast<uint8_t>(offset64), 0); }
   FieldBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   FieldBuilder &operator=(const FieldBuilder &);
   flatbuffers::Offset<Field> Finish() {
-    auto o = flatbuffers::Offset<Field>(fbb_.EndTable(start_, 10));
+    auto o = flatbuffers::Offset<Field>(fbb_.EndTable(start_, 11));
     fbb_.Required(o, Field::VT_NAME);  // name
     fbb_.Required(o, Field::VT_TYPE);  // type
     return o;
@@ -347,7 +365,8 @@ inline flatbuffers::Offset<Field> CreateField(flatbuffers::FlatBufferBuilder &_f
     bool deprecated = false,
     bool required = false,
     bool key = false,
-    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<KeyValue>>> attributes = 0,
+    bool offset64 = false) {
   FieldBuilder builder_(_fbb);
   builder_.add_default_real(default_real);
   builder_.add_default_integer(default_integer);
@@ -356,6 +375,7 @@ inline flatbuffers::Offset<Field> CreateField(flatbuffers::FlatBufferBuilder &_f
   builder_.add_name(name);
   builder_.add_offset(offset);
   builder_.add_id(id);
+  builder_.add_offset64(offset64);
   builder_.add_key(key);
   builder_.add_required(required);
   builder_.add_deprecated(deprecated);
@@ -372,8 +392,9 @@ inline flatbuffers::Offset<Field> CreateFieldDirect(flatbuffers::FlatBufferBuild
     bool deprecated = false,
     bool required = false,
     bool key = false,
-    const std::vector<flatbuffers::Offset<KeyValue>> *attributes = nullptr) {
-  return CreateField(_fbb, name ? _fbb.CreateString(name) : 0, type, id, offset, default_integer, default_real, deprecated, required, key, attributes ? _fbb.CreateVector<flatbuffers::Offset<KeyValue>>(*attributes) : 0);
+    const std::vector<flatbuffers::Offset<KeyValue>> *attributes = nullptr,
+    bool offset64 = false) {
+  return CreateField(_fbb, name ? _fbb.CreateString(name) : 0, type, id, offset, default_integer, default_real, deprecated, required, key, attributes ? _fbb.CreateVector<flatbuffers::Offset<KeyValue>>(*attributes) : 0, offset64);
 }
 
 struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -388,6 +409,7 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Object *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   const flatbuffers::Vector<flatbuffers::Offset<Field>> *fields() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Field>> *>(VT_FIELDS); }
   bool is_struct() const { return GetField<uint8_t>(VT_IS_STRUCT, 0) != 0; }
   int32_t minalign() const { return GetField<int32_t>(VT_MINALIGN, 0); }
@@ -531,16 +553,22 @@ inline flatbuffers::Offset<Schema> CreateSchemaDirect(flatbuffers::FlatBufferBui
 
 inline const reflection::Schema *GetSchema(const void *buf) { return flatbuffers::GetRoot<reflection::Schema>(buf); }
 
+inline const reflection::Schema *GetSizePrefixedSchema(const void *buf) { return flatbuffers::GetSizePrefixedRoot<reflection::Schema>(buf); }
+
 inline const char *SchemaIdentifier() { return "BFBS"; }
 
 inline bool SchemaBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, SchemaIdentifier()); }
 
 inline bool VerifySchemaBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<reflection::Schema>(SchemaIdentifier()); }
 
+inline bool VerifySizePrefixedSchemaBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<reflection::Schema>(SchemaIdentifier()); }
+
 inline const char *SchemaExtension() { return "bfbs"; }
 
 inline void FinishSchemaBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<reflection::Schema> root) { fbb.Finish(root, SchemaIdentifier()); }
 
+inline void FinishSizePrefixedSchemaBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<reflection::Schema> root) { fbb.FinishSizePrefixed(root, SchemaIdentifier()); }
+
 }  // namespace reflection
 
 #endif  // FLATBUFFERS_GENERATED_REFLECTION_REFLECTION_H_
@@ -134,6 +134,71 @@ bool DirExists(const char *name);
 // no transcoding.
 bool LoadFile(const char *name, bool binary, std::string *buf);
 
+// A read-only view of a whole file, memory mapped where the platform supports
+// it, so that large binary FlatBuffers can be accessed (with GetRoot) or
+// verified in place, without first copying them to the heap.
+// Elsewhere the file is read into memory instead.
+// Unlike LoadFile, this always reads from the file system, ignoring any
+// function set with SetLoadFileFunction.
+// Mappings are page aligned, so the data is suitably aligned for any
+// FlatBuffer.
+class MappedBuffer {
+ public:
+  // Hints about how the data will be accessed, passed on to madvise() where
+  // available, and ignored elsewhere.
+  enum Advice {
+    kAdviceNormal,
+    kAdviceSequential,  // Read front to back, e.g. by a Verifier.
+    kAdviceRandom,      // Accessed sparsely, e.g. a lookup table.
+    kAdviceWillNeed,    // Start reading it all into the page cache now.
+    kAdviceDontNeed,    // Not needed for now, pages may be dropped.
+  };
+
+  MappedBuffer() : data_(nullptr), size_(0) {}
+  MappedBuffer(MappedBuffer &&other) : data_(nullptr), size_(0) {
+    *this = std::move(other);
+  }
+  MappedBuffer &operator=(MappedBuffer &&other);
+  ~MappedBuffer() { Unmap(); }
+
+  // Maps file "name", replacing any previous mapping. Returns false if the
+  // file could not be opened or mapped.
+  bool Map(const char *name, Advice advice = kAdviceNormal);
+
+  // As Map, then runs "verify" (e.g. the generated VerifyMonsterBuffer) over
+  // the data, and unmaps it again if that fails. The data is first advised
+  // to be sequential for the verifier, and then set to "advice".
+  // (Defined here, as the Verifier depends on the caller's configuration.)
+  bool MapAndVerify(const char *name, bool (*verify)(Verifier &verifier),
+                    Advice advice = kAdviceNormal) {
+    if (!Map(name, kAdviceSequential)) return false;
+    Verifier verifier(data_, size_);
+    if (!verify(verifier)) {
+      Unmap();
+      return false;
+    }
+    Advise(advice);
+    return true;
+  }
+
+  // Changes the advice for a range of the data (default: all of it).
+  // Returns false if the platform rejected the advice.
+  bool Advise(Advice advice, size_t offset = 0, size_t len = ~size_t(0));
+
+  void Unmap();
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MappedBuffer(const MappedBuffer &);
+  MappedBuffer &operator=(const MappedBuffer &);
+
+  const uint8_t *data_;
+  size_t size_;
+  std::string contents_;  // Where mapping is not supported.
+};
+
 // Save data "buf" of length "len" bytes into a file
 // "name" returning true if successful, false otherwise.
 // If "binary" is false data is written using ifstream's
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2016 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_WORK_STEALING_POOL_H_
+#define FLATBUFFERS_WORK_STEALING_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "flatbuffers/flatbuffers.h"
+
+// A thread pool for verifying large buffers in parallel:
+//
+//   flatbuffers::WorkStealingPool pool;
+//   flatbuffers::Verifier verifier(buf, len);
+//   verifier.SetTaskRunner(&pool);
+//   bool ok = VerifyMonsterBuffer(verifier);
+//
+// or for sorting large vectors of tables with string keys:
+//
+//   builder.SetTaskRunner(&pool);
+//   auto sorted = builder.CreateVectorOfSortedTables(&monsters);
+
+namespace flatbuffers {
+
+// Every worker thread has its own queue of tasks. New tasks go to the back
+// of the queue of the thread that creates them, which also takes tasks from
+// the back, while idle threads steal from the front of other queues. So
+// nested ForEach calls mostly run on the thread that made them, with large
+// chunks of work migrating to other threads.
+// A thread waiting for its tasks to finish runs other tasks meanwhile, so
+// tasks may call ForEach themselves without tying up threads.
+class WorkStealingPool : public TaskRunner {
+ public:
+  // Starts num_threads worker threads (0 uses the number of cores). Threads
+  // calling ForEach help run the tasks, so e.g. a pool with 3 threads keeps
+  // 4 cores busy.
+  explicit WorkStealingPool(size_t num_threads = 0)
+      : queued_(0), stop_(false) {
+    if (!num_threads) {
+      auto cores = std::thread::hardware_concurrency();
+      num_threads = cores > 1 ? cores - 1 : 1;
+    }
+    // The last queue is shared by threads outside the pool.
+    for (size_t i = 0; i <= num_threads; i++) {
+      queues_.push_back(std::unique_ptr<Queue>(new Queue()));
+    }
+    for (size_t i = 0; i < num_threads; i++) {
+      threads_.push_back(std::thread(&WorkStealingPool::Work, this, i));
+    }
+  }
+
+  ~WorkStealingPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto it = threads_.begin(); it != threads_.end(); ++it) it->join();
+  }
+
+  virtual size_t Concurrency() const { return threads_.size() + 1; }
+
+  virtual void ForEach(size_t num_tasks, void (*fn)(void *ctx, size_t i),
+                       void *ctx) {
+    if (!num_tasks) return;
+    Batch batch;
+    batch.fn = fn;
+    batch.ctx = ctx;
+    batch.remaining = num_tasks;
+    auto self = QueueIndex();
+    {
+      std::lock_guard<std::mutex> lock(sleep_mutex_);
+      queued_ += num_tasks;
+    }
+    {
+      auto &queue = *queues_[self];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      // Pushed in reverse, so the owner runs them in order.
+      for (size_t i = num_tasks; i > 0; i--) {
+        Task task = { &batch, i - 1 };
+        queue.tasks.push_back(task);
+      }
+    }
+    wake_.notify_all();
+    // Help out until the batch is done. The last few tasks of the batch may
+    // be running elsewhere, in which case there's nothing left to do here.
+    while (batch.remaining.load()) {
+      if (!RunOne(self)) std::this_thread::yield();
+    }
+  }
+
+ private:
+  struct Batch {
+    void (*fn)(void *ctx, size_t i);
+    void *ctx;
+    std::atomic<size_t> remaining;
+  };
+
+  struct Task {
+    Batch *batch;
+    size_t index;
+  };
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  // The pool and queue the calling thread works for, if any.
+  struct WorkerId {
+    const WorkStealingPool *pool;
+    size_t queue;
+  };
+  static WorkerId &ThisWorker() {
+    static thread_local WorkerId id = { nullptr, 0 };
+    return id;
+  }
+
+  size_t QueueIndex() const {
+    auto &id = ThisWorker();
+    return id.pool == this ? id.queue : queues_.size() - 1;
+  }
+
+  void Work(size_t index) {
+    WorkerId id = { this, index };
+    ThisWorker() = id;
+    for (;;) {
+      if (RunOne(index)) continue;
+      std::unique_lock<std::mutex> lock(sleep_mutex_);
+      wake_.wait(lock, [this]() { return stop_ || queued_.load(); });
+      if (stop_) return;
+    }
+  }
+
+  // Runs a task from queue `self`, or else one stolen from another queue.
+  // Returns false if there were none.
+  bool RunOne(size_t self) {
+    Task task = { nullptr, 0 };
+    if (!Pop(*queues_[self], true, &task)) {
+      size_t i = 1;
+      for (; i < queues_.size(); i++) {
+        if (Pop(*queues_[(self + i) % queues_.size()], false, &task)) break;
+      }
+      if (i == queues_.size()) return false;
+    }
+    task.batch->fn(task.batch->ctx, task.index);
+    task.batch->remaining--;
+    return true;
+  }
+
+  bool Pop(Queue &queue, bool back, Task *task) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) return false;
+    if (back) {
+      *task = queue.tasks.back();
+      queue.tasks.pop_back();
+    } else {
+      *task = queue.tasks.front();
+      queue.tasks.pop_front();
+    }
+    queued_--;
+    return true;
+  }
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> queued_;  // Tasks in all queues.
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_WORK_STEALING_POOL_H_
@@ -45,10 +45,17 @@ struct EquipmentUnion {
   EquipmentUnion() : type(Equipment_NONE), table(nullptr) {}
   EquipmentUnion(const EquipmentUnion &);
   EquipmentUnion &operator=(const EquipmentUnion &);
+  EquipmentUnion(EquipmentUnion &&u) FLATBUFFERS_NOEXCEPT :
+    type(Equipment_NONE), table(nullptr)
+    { std::swap(type, u.type); std::swap(table, u.table); }
+  EquipmentUnion &operator=(EquipmentUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(table, u.table); return *this; }
   ~EquipmentUnion();
+  void Reset();
 
   void UnPack(const void *union_obj, Equipment _t);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  size_t EstimatePackedSize() const;
 
   WeaponT *AsWeapon() { return type == Equipment_Weapon ? reinterpret_cast<WeaponT *>(table) : nullptr; }
   EquipmentUnion &operator=(const WeaponT &_o);
@@ -136,11 +143,14 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
 
 struct MonsterT : public flatbuffers::NativeTable {
   flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const Monster *object);
   inline MonsterT& operator=(const Monster *object) { UnPack(object); return *this;}
   explicit MonsterT(const Monster *object) { UnPack(object); }
 
-  flatbuffers::Optional<Vec3> pos;
+  flatbuffers::OptionalStruct<Vec3> pos;
   int16_t mana;
   int16_t hp;
   std::string name;
@@ -231,6 +241,9 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
 
 struct WeaponT : public flatbuffers::NativeTable {
   flatbuffers::Offset<Weapon> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const Weapon *object);
   inline WeaponT& operator=(const Weapon *object) { UnPack(object); return *this;}
   explicit WeaponT(const Weapon *object) { UnPack(object); }
@@ -274,26 +287,30 @@ inline void MonsterT::UnPack(const Monster *_o) {
   pos = _o->pos();
   mana = _o->mana();
   hp = _o->hp();
-  name.assign(_o->name()->c_str(), _o->name()->size());
-  inventory.clear();
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
   if (_o->inventory()) {
-    inventory.reserve(_o->inventory()->size());
-    for (auto it = _o->inventory()->begin(), __end = _o->inventory()->end(); it != __end; ++it)
-      inventory.push_back((*it));
+    inventory.resize(_o->inventory()->size());
+    auto _e = inventory.begin();
+    for (auto it = _o->inventory()->begin(), __end = _o->inventory()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    inventory.clear();
   }
   color = _o->color();
-  weapons.clear();
   if (_o->weapons()) {
-    weapons.reserve(_o->weapons()->size());
-    for (auto it = _o->weapons()->begin(), __end = _o->weapons()->end(); it != __end; ++it)
-      weapons.push_back(WeaponT((*it)));
+    weapons.resize(_o->weapons()->size());
+    auto _e = weapons.begin();
+    for (auto it = _o->weapons()->begin(), __end = _o->weapons()->end(); it != __end; ++it, ++_e)
+      (*_e).UnPack((*it));
+  } else {
+    weapons.clear();
   }
   equipped.UnPack(_o->equipped(), _o->equipped_type());
 }
 
 inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
   return CreateMonster(_fbb,
-    pos,
+    pos.get(),
     mana,
     hp,
     name.size() ? _fbb.CreateString(name) : 0,
@@ -304,8 +321,23 @@ inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilde
     equipped.Pack(_fbb));
 }
 
+inline size_t MonsterT::EstimatePackedSize() const {
+  size_t _size = 67;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (inventory.size()) {
+    _size += flatbuffers::EstimateVectorSize(inventory.size(), 1);
+  }
+  if (weapons.size()) {
+    _size += flatbuffers::EstimateVectorSize(weapons.size(), 4);
+    for (auto it = weapons.begin(); it != weapons.end(); ++it)
+      _size += it->EstimatePackedSize();
+  }
+  _size += equipped.EstimatePackedSize();
+  return _size;
+}
+
 inline void WeaponT::UnPack(const Weapon *_o) {
-  name.assign(_o->name()->c_str(), _o->name()->size());
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
   damage = _o->damage();
 }
 
@@ -315,6 +347,12 @@ inline flatbuffers::Offset<Weapon> WeaponT::Pack(flatbuffers::FlatBufferBuilder
     damage);
 }
 
+inline size_t WeaponT::EstimatePackedSize() const {
+  size_t _size = 23;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  return _size;
+}
+
 inline bool VerifyEquipment(flatbuffers::Verifier &verifier, const void *union_obj, Equipment type) {
   switch (type) {
     case Equipment_NONE: return true;
@@ -324,8 +362,14 @@ inline bool VerifyEquipment(flatbuffers::Verifier &verifier, const void *union_o
 }
 
 inline void EquipmentUnion::UnPack(const void *union_obj, Equipment _t) {
+  if (union_obj && _t == type) {
+    switch (_t) {
+      case Equipment_Weapon: static_cast<WeaponT *>(table)->UnPack(reinterpret_cast<const Weapon *>(union_obj)); return;
+      default: break;
+    }
+  }
+  Reset();
   type = _t;
-  delete table;
   if (!union_obj) { table = nullptr; type = Equipment_NONE; return; }
   switch (_t) {
     case Equipment_NONE: table = nullptr; break;
@@ -342,10 +386,17 @@ inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBui
   }
 }
 
+inline size_t EquipmentUnion::EstimatePackedSize() const {
+  switch (type) {
+    case Equipment_Weapon: return static_cast<const WeaponT *>(table)->EstimatePackedSize();
+    default: return 0;
+  }
+}
+
 inline EquipmentUnion::EquipmentUnion(const EquipmentUnion &other) : type(Equipment_NONE), table(nullptr) { *this = other; }
 inline EquipmentUnion& EquipmentUnion::operator=(const EquipmentUnion &other) {
+  Reset();
   type = other.type;
-  delete table;
   switch (other.type) {
     case Equipment_Weapon: table = new WeaponT(*(static_cast<WeaponT *>(other.table))); break;
     default:
@@ -356,28 +407,38 @@ inline EquipmentUnion& EquipmentUnion::operator=(const EquipmentUnion &other) {
   return *this;
 }
 
-inline EquipmentUnion::~EquipmentUnion() {
+inline EquipmentUnion::~EquipmentUnion() { Reset(); }
+
+inline void EquipmentUnion::Reset() {
   switch (type) {
     case Equipment_Weapon: delete static_cast<WeaponT *>(table); break;
     default: assert(!table); break;
   }
+  table = nullptr;
+  type = Equipment_NONE;
 }
 
 inline EquipmentUnion& EquipmentUnion::operator=(const WeaponT &_o) {
+  Reset();
   type = Equipment_Weapon;
-  delete table;
   table = new WeaponT(_o);
   return *this;
 }
 
 inline const MyGame::Sample::Monster *GetMonster(const void *buf) { return flatbuffers::GetRoot<MyGame::Sample::Monster>(buf); }
 
+inline const MyGame::Sample::Monster *GetSizePrefixedMonster(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Sample::Monster>(buf); }
+
 inline Monster *GetMutableMonster(void *buf) { return flatbuffers::GetMutableRoot<Monster>(buf); }
 
 inline bool VerifyMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Sample::Monster>(nullptr); }
 
+inline bool VerifySizePrefixedMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Sample::Monster>(nullptr); }
+
 inline void FinishMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Sample::Monster> root) { fbb.Finish(root); }
 
+inline void FinishSizePrefixedMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Sample::Monster> root) { fbb.FinishSizePrefixed(root); }
+
 }  // namespace Sample
 }  // namespace MyGame
 
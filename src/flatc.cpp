@@ -16,6 +16,7 @@
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
+#include "flatbuffers/reflection.h"
 #include "flatbuffers/util.h"
 #include <limits>
 
@@ -127,6 +128,15 @@ static void Error(const std::string &err, bool usage, bool show_exe_name) {
       "  --gen-name-strings Generate type name functions for C++.\n"
       "  --escape-proto-ids Disable appending '_' in namespaces names.\n"
       "  --gen-object-api   Generate an additional object-based API\n"
+      "  --object-api-arena Object API types allocate from the current\n"
+      "                     flatbuffers::Arena, see flatbuffers/arena.h.\n"
+      "  --object-api-lazy  Also generate object API types (XLazyT) that unpack\n"
+      "                     each field on first access, and copy the others\n"
+      "                     from their source buffer when packed.\n"
+      "  --object-api-raw-strings\n"
+      "                     With --cpp-framework qt5, object API strings point\n"
+      "                     into the flatbuffers::SourceBufferScope buffer they\n"
+      "                     were unpacked from, rather than copying them.\n"
       "  --cpp-variant VAR  What C++ variant to generate code for:\n"
       "                       c++0x (default): Minimal c++11 functionality at the level of VS2010 / GCC 4.6.2).\n"
       "                       c++11: Code for a fully compliant c++11 compiler (VS2015 / GCC 4.8).\n"
@@ -137,6 +147,9 @@ static void Error(const std::string &err, bool usage, bool show_exe_name) {
       "                     This may crash flatc given a mismatched schema.\n"
       "  --proto            Input is a .proto, translate to .fbs.\n"
       "  --schema           Serialize schemas instead of JSON (use with -b)\n"
+      "  --compact          Rewrite binary inputs in minimal form, dropping\n"
+      "                     unused space and duplicate vtables and strings\n"
+      "                     (use with -b).\n"
       "  --conform FILE     Specify a schema the following schemas should be\n"
       "                     an evolution of. Gives errors if not.\n"
       "FILEs may be schemas, or JSON files (conforming to preceding schema)\n"
@@ -173,6 +186,7 @@ int main(int argc, const char *argv[]) {
   bool print_make_rules = false;
   bool raw_binary = false;
   bool schema_binary = false;
+  bool compact_binary = false;
   std::vector<std::string> filenames;
   std::vector<const char *> include_directories;
   size_t binary_files_from = std::numeric_limits<size_t>::max();
@@ -214,6 +228,12 @@ int main(int argc, const char *argv[]) {
         opts.generate_name_strings = true;
       } else if(arg == "--gen-object-api") {
         opts.generate_object_based_api = true;
+      } else if(arg == "--object-api-arena") {
+        opts.object_api_arena = true;
+      } else if(arg == "--object-api-lazy") {
+        opts.object_api_lazy = true;
+      } else if(arg == "--object-api-raw-strings") {
+        opts.object_api_raw_strings = true;
       } else if(arg == "--cpp-variant") {
         if (++argi >= argc) Error("missing param following" + arg, true);
         arg = std::string(argv[argi]);
@@ -252,6 +272,8 @@ int main(int argc, const char *argv[]) {
         opts.escape_proto_identifiers = true;
       } else if(arg == "--schema") {
         schema_binary = true;
+      } else if(arg == "--compact") {
+        compact_binary = true;
       } else if(arg == "-M") {
         print_make_rules = true;
       } else if(arg == "--version") {
@@ -297,17 +319,17 @@ int main(int argc, const char *argv[]) {
   for (auto file_it = filenames.begin();
             file_it != filenames.end();
           ++file_it) {
-      std::string contents;
-      if (!flatbuffers::LoadFile(file_it->c_str(), true, &contents))
-        Error("unable to load file: " + *file_it);
-
       bool is_binary = static_cast<size_t>(file_it - filenames.begin()) >=
                        binary_files_from;
       if (is_binary) {
+        // Binaries are copied into the builder anyway, so map them rather
+        // than reading them into yet another copy first.
+        flatbuffers::MappedBuffer contents;
+        if (!contents.Map(file_it->c_str(),
+                          flatbuffers::MappedBuffer::kAdviceSequential))
+          Error("unable to load file: " + *file_it);
         g_parser->builder_.Clear();
-        g_parser->builder_.PushFlatBuffer(
-          reinterpret_cast<const uint8_t *>(contents.c_str()),
-          contents.length());
+        g_parser->builder_.PushFlatBuffer(contents.data(), contents.size());
         if (!raw_binary) {
           // Generally reading binaries that do not correspond to the schema
           // will crash, and sadly there's no way around that when the binary
@@ -319,7 +341,8 @@ int main(int argc, const char *argv[]) {
                  *file_it +
                  "\" matches the schema, use --raw-binary to read this file"
                  " anyway.");
-          } else if (!flatbuffers::BufferHasIdentifier(contents.c_str(),
+          } else if (contents.size() < 2 * sizeof(flatbuffers::uoffset_t) ||
+                     !flatbuffers::BufferHasIdentifier(contents.data(),
                          g_parser->file_identifier_.c_str())) {
             Error("binary \"" +
                  *file_it +
@@ -328,7 +351,30 @@ int main(int argc, const char *argv[]) {
                  "\", use --raw-binary to read this file anyway.");
           }
         }
+        if (compact_binary) {
+          if (!g_parser->root_struct_def_)
+            Error("current schema has no root_type: cannot compact \"" +
+                  *file_it + "\"");
+          // Copy through the reflection data of the schema, which lives in
+          // the builder too.
+          g_parser->Serialize();
+          std::string schema(reinterpret_cast<const char *>(
+                               g_parser->builder_.GetBufferPointer()),
+                             g_parser->builder_.GetSize());
+          g_parser->builder_.Clear();
+          auto &schemadef = *reflection::GetSchema(schema.c_str());
+          // Compacting follows every offset in the binary.
+          if (!flatbuffers::VerifyAnyBuffer(schemadef, contents.data(),
+                                            contents.size()))
+            Error("binary \"" + *file_it + "\" does not match the current "
+                  "schema: cannot compact it");
+          flatbuffers::CompactBuffer(g_parser->builder_, schemadef,
+                                     contents.data());
+        }
       } else {
+        std::string contents;
+        if (!flatbuffers::LoadFile(file_it->c_str(), true, &contents))
+          Error("unable to load file: " + *file_it);
         // Check if file contains 0 bytes.
         if (contents.length() != strlen(contents.c_str())) {
           Error("input file appears to be binary: " + *file_it, true);
@@ -71,7 +71,11 @@ class CppGenerator : public BaseGenerator {
 
     if (parser_.opts.cpp_frameowork == IDLOptions::Qt5)
       code += "#ifndef FLATBUFFERS_USE_QT\n#error FLATBUFFERS_USE_QT is not defined\n#endif\n\n";
-    code += "#include \"flatbuffers/flatbuffers.h\"\n\n";
+    code += "#include \"flatbuffers/flatbuffers.h\"\n";
+    if (parser_.opts.generate_object_based_api &&
+        parser_.opts.object_api_arena)
+      code += "#include \"flatbuffers/arena.h\"\n";
+    code += "\n";
 
     if (parser_.opts.include_dependence_headers) {
       int num_includes = 0;
@@ -170,6 +174,10 @@ class CppGenerator : public BaseGenerator {
       code += name;
       code += "(const void *buf) { return flatbuffers::GetRoot<";
       code += cpp_qualified_name + ">(buf); }\n\n";
+      code += "inline const " + cpp_qualified_name + " *GetSizePrefixed";
+      code += name;
+      code += "(const void *buf) { return flatbuffers::GetSizePrefixedRoot<";
+      code += cpp_qualified_name + ">(buf); }\n\n";
       if (parser_.opts.mutable_buffer) {
         code += "inline " + name + " *GetMutable";
         code += name;
@@ -190,18 +198,22 @@ class CppGenerator : public BaseGenerator {
         code += name + "Identifier()); }\n\n";
       }
 
-      // The root verifier:
+      // The root verifiers:
+      auto identifier = parser_.file_identifier_.length()
+                        ? name + "Identifier()"
+                        : "nullptr";
       code += "inline bool Verify";
       code += name;
       code +=
           "Buffer(flatbuffers::Verifier &verifier) { "
           "return verifier.VerifyBuffer<";
-      code += cpp_qualified_name + ">(";
-      if (parser_.file_identifier_.length())
-        code += name + "Identifier()";
-      else
-        code += "nullptr";
-      code += "); }\n\n";
+      code += cpp_qualified_name + ">(" + identifier + "); }\n\n";
+      code += "inline bool VerifySizePrefixed";
+      code += name;
+      code +=
+          "Buffer(flatbuffers::Verifier &verifier) { "
+          "return verifier.VerifySizePrefixedBuffer<";
+      code += cpp_qualified_name + ">(" + identifier + "); }\n\n";
 
       if (parser_.file_extension_.length()) {
         // Return the extension
@@ -218,6 +230,13 @@ class CppGenerator : public BaseGenerator {
       if (parser_.file_identifier_.length())
         code += ", " + name + "Identifier()";
       code += "); }\n\n";
+      code += "inline void FinishSizePrefixed" + name;
+      code +=
+          "Buffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<";
+      code += cpp_qualified_name + "> root) { fbb.FinishSizePrefixed(root";
+      if (parser_.file_identifier_.length())
+        code += ", " + name + "Identifier()";
+      code += "); }\n\n";
     }
 
     assert(cur_name_space_);
@@ -234,6 +253,16 @@ class CppGenerator : public BaseGenerator {
         code += "Q_DECLARE_METATYPE(uint32_t)\n";
         code += "Q_DECLARE_METATYPE(int64_t)\n";
         code += "Q_DECLARE_METATYPE(uint64_t)\n\n";
+
+        // After the metatypes, which the role data needs.
+        for (auto it = parser_.structs_.vec.begin();
+             it != parser_.structs_.vec.end(); ++it) {
+          auto &struct_def = **it;
+          if (!struct_def.fixed && !struct_def.generated) {
+            GenQtRoles(struct_def, &code);
+            GenQtModels(struct_def, &code);
+          }
+        }
     }
 
     // Close the include guard.
@@ -276,13 +305,14 @@ class CppGenerator : public BaseGenerator {
   }
 
   // Return a C++ pointer type, specialized to the actual struct/table types,
-  // and vector element types.
-  std::string GenTypePointer(const Type &type) {
+  // and vector element types. `offset64` is set for fields with that
+  // attribute.
+  std::string GenTypePointer(const Type &type, bool offset64 = false) {
     switch (type.base_type) {
       case BASE_TYPE_STRING:
         return "flatbuffers::String";
       case BASE_TYPE_VECTOR:
-        return "flatbuffers::Vector<" +
+        return std::string("flatbuffers::Vector") + (offset64 ? "64<" : "<") +
                GenTypeWire(type.VectorType(), "", false) + ">";
       case BASE_TYPE_STRUCT:
         return WrapInNameSpace(*type.struct_def);
@@ -296,12 +326,14 @@ class CppGenerator : public BaseGenerator {
   // Return a C++ type for any type (scalar/pointer) specifically for
   // building a flatbuffer.
   std::string GenTypeWire(const Type &type, const char *postfix,
-                          bool user_facing_type) {
+                          bool user_facing_type, bool offset64 = false) {
     return IsScalar(type.base_type)
                ? GenTypeBasic(type, user_facing_type) + postfix
                : IsStruct(type) ? "const " + GenTypePointer(type) + " *"
-                                : "flatbuffers::Offset<" +
-                                      GenTypePointer(type) + ">" + postfix;
+                                : std::string("flatbuffers::Offset") +
+                                      (offset64 ? "64<" : "<") +
+                                      GenTypePointer(type, offset64) + ">" +
+                                      postfix;
   }
 
   // Return a C++ type for any type (scalar/pointer) that reflects its
@@ -315,14 +347,30 @@ class CppGenerator : public BaseGenerator {
   // TODO(wvo): make this configurable.
   std::string NativeName(const std::string &name) { return name + "T"; }
 
+  std::string LazyName(const std::string &name) { return name + "LazyT"; }
+
+  bool GenRawStrings() const {
+    return parser_.opts.generate_object_based_api &&
+           parser_.opts.cpp_frameowork == IDLOptions::Qt5 &&
+           parser_.opts.object_api_raw_strings;
+  }
+
+  bool GenLazyObjectApi() const {
+    return parser_.opts.generate_object_based_api &&
+           parser_.opts.object_api_lazy;
+  }
+
   std::string GenTypeNative(const Type &type, bool forceFullyQualified = false) {
     switch (type.base_type) {
       case BASE_TYPE_STRING:
         if (parser_.opts.cpp_frameowork == IDLOptions::Qt5)
             return "QByteArray";
-        return "std::string";
-      case BASE_TYPE_VECTOR:
-        return "std::vector<" + GenTypeNative(type.VectorType(), forceFullyQualified) + ">";
+        return parser_.opts.object_api_arena ? "flatbuffers::arena_string"
+                                             : "std::string";
+      case BASE_TYPE_VECTOR: {
+        auto element = GenTypeNative(type.VectorType(), forceFullyQualified);
+        return "std::vector<" + element + NativeAllocator(element) + ">";
+      }
       case BASE_TYPE_STRUCT:
         if (IsStruct(type)) {
           return WrapInNameSpace(*type.struct_def, forceFullyQualified);
@@ -336,22 +384,35 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
-  // generate push_back/emplace_back item
-  std::string GenPushBack(const std::string &type, const std::string &params)
-  {
-      if (parser_.opts.cpp_variant != IDLOptions::Cpp0x)
-          return params;
-      return "(" + type + params + ")";
+  // The type of the native member holding `field`. Structs are held inline,
+  // tables by pointer.
+  std::string GenMemberTypeNative(const FieldDef &field) {
+    auto &type = field.value.type;
+    auto native_type = GenTypeNative(type);
+    if (type.base_type != BASE_TYPE_STRUCT) return native_type;
+    if (IsStruct(type))
+      return "flatbuffers::OptionalStruct<" + native_type + ">";
+    return "flatbuffers::OptionalTable<" + native_type + ", " +
+           WrapInNameSpace(*type.struct_def) + NativeAllocator(native_type) +
+           ">";
+  }
+
+  // The allocator argument of native containers of `type`, if not the
+  // default one.
+  std::string NativeAllocator(const std::string &type) {
+    return parser_.opts.object_api_arena
+               ? ", flatbuffers::arena_allocator<" + type + ">"
+               : "";
   }
 
   // Return a C++ type for any type (scalar/pointer) specifically for
   // using a flatbuffer.
   std::string GenTypeGet(const Type &type, const char *afterbasic,
                          const char *beforeptr, const char *afterptr,
-                         bool user_facing_type) {
+                         bool user_facing_type, bool offset64 = false) {
     return IsScalar(type.base_type)
                ? GenTypeBasic(type, user_facing_type) + afterbasic
-               : beforeptr + GenTypePointer(type) + afterptr;
+               : beforeptr + GenTypePointer(type, offset64) + afterptr;
   }
 
   static std::string GenEnumDecl(const EnumDef &enum_def,
@@ -403,10 +464,33 @@ class CppGenerator : public BaseGenerator {
            "::Pack(flatbuffers::FlatBufferBuilder &_fbb) const";
   }
 
+  std::string UnionEstimateSignature(EnumDef &enum_def, bool inclass) {
+    return std::string("size_t ") +
+           (inclass ? "" : enum_def.name + "Union::") +
+           "EstimatePackedSize() const";
+  }
+
+  std::string TableEstimateSignature(StructDef &struct_def) {
+    return "inline size_t " + NativeName(struct_def.name) +
+           "::EstimatePackedSize() const";
+  }
+
   std::string TableUnPackSignature(StructDef &struct_def) {
     return "inline void " + NativeName(struct_def.name) + "::UnPack(const " + struct_def.name + " *_o)";
   }
 
+  std::string UnionCopySignature(EnumDef &enum_def) {
+    return "inline flatbuffers::Offset<void> Copy" + enum_def.name +
+           "(flatbuffers::FlatBufferBuilder &_fbb, const void *union_obj, " +
+           enum_def.name + " type)";
+  }
+
+  std::string TableCopySignature(StructDef &struct_def) {
+    return "inline flatbuffers::Offset<" + struct_def.name + "> Copy" +
+           struct_def.name + "(flatbuffers::FlatBufferBuilder &_fbb, const " +
+           struct_def.name + " *_o)";
+  }
+
   // Generate an enum declaration and an enum string lookup table.
   void GenEnum(EnumDef &enum_def, std::string *code_ptr) {
     std::string &code = *code_ptr;
@@ -468,9 +552,20 @@ class CppGenerator : public BaseGenerator {
       code += enum_def.name + "Union &);\n";
       code += "  " + enum_def.name + "Union &operator=(const ";
       code += enum_def.name + "Union &);\n";
-      code += "  ~" + enum_def.name + "Union();\n\n";
+      code += "  " + enum_def.name + "Union(" + enum_def.name;
+      code += "Union &&u) FLATBUFFERS_NOEXCEPT :\n";
+      code += "    type(" + GenEnumVal(enum_def, "NONE", parser_.opts, true);
+      code += "), table(nullptr)\n";
+      code += "    { std::swap(type, u.type); std::swap(table, u.table); }\n";
+      code += "  " + enum_def.name + "Union &operator=(" + enum_def.name;
+      code += "Union &&u) FLATBUFFERS_NOEXCEPT\n";
+      code += "    { std::swap(type, u.type); std::swap(table, u.table); ";
+      code += "return *this; }\n";
+      code += "  ~" + enum_def.name + "Union();\n";
+      code += "  void Reset();\n\n";
       code += "  " + UnionUnPackSignature(enum_def, true) + ";\n";
-      code += "  " + UnionPackSignature(enum_def, true) + ";\n\n";
+      code += "  " + UnionPackSignature(enum_def, true) + ";\n";
+      code += "  " + UnionEstimateSignature(enum_def, true) + ";\n\n";
       for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
            ++it) {
         auto &ev = **it;
@@ -520,6 +615,8 @@ class CppGenerator : public BaseGenerator {
 
     if (enum_def.is_union) {
       code += UnionVerifySignature(enum_def) + ";\n\n";
+      if (GenLazyObjectApi())
+        code += UnionCopySignature(enum_def) + ";\n\n";
     }
   }
 
@@ -545,10 +642,39 @@ class CppGenerator : public BaseGenerator {
     }
     code += "    default: return false;\n  }\n}\n\n";
 
+    if (GenLazyObjectApi()) {
+      // Generate a function that copies this union's table from another
+      // buffer as is.
+      code += UnionCopySignature(enum_def) + " {\n  switch (type) {\n";
+      for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+           ++it) {
+        auto &ev = **it;
+        if (!ev.value) continue;
+        code += "    case " + GetEnumVal(enum_def, ev, parser_.opts);
+        code += ": return " + WrapInNameSpace(ev.struct_def->defined_namespace,
+                                             "Copy" + ev.struct_def->name);
+        code += "(_fbb, reinterpret_cast<const ";
+        code += WrapInNameSpace(*ev.struct_def) + " *>(union_obj)).Union();\n";
+      }
+      code += "    default: return 0;\n  }\n}\n\n";
+    }
+
     if (parser_.opts.generate_object_based_api) {
       // Generate a union pack & unpack function.
+      // A table of the same type is unpacked into in place.
       code += "inline " + UnionUnPackSignature(enum_def, false);
-      code += " {\n  type = _t;\n  delete table;\n";
+      code += " {\n  if (union_obj && _t == type) {\n    switch (_t) {\n";
+      for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+           ++it) {
+        auto &ev = **it;
+        if (!ev.value) continue;
+        code += "      case " + GetEnumVal(enum_def, ev, parser_.opts);
+        code += ": static_cast<" + NativeName(WrapInNameSpace(*ev.struct_def));
+        code += " *>(table)->UnPack(reinterpret_cast<const ";
+        code += WrapInNameSpace(*ev.struct_def) + " *>(union_obj)); return;\n";
+      }
+      code += "      default: break;\n    }\n  }\n";
+      code += "  Reset();\n  type = _t;\n";
       code += "  if (!union_obj) { table = nullptr; type = ";
       std::string case_code;
       std::string  none_enum_name;
@@ -585,10 +711,23 @@ class CppGenerator : public BaseGenerator {
         }
       }
       code += "    default: return 0;\n  }\n}\n\n";
+      code += "inline " + UnionEstimateSignature(enum_def, false);
+      code += " {\n  switch (type) {\n";
+      for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+           ++it) {
+        auto &ev = **it;
+        if (!ev.value) continue;
+        code += "    case " + GetEnumVal(enum_def, ev, parser_.opts);
+        code += ": return static_cast<const ";
+        code += NativeName(WrapInNameSpace(*ev.struct_def));
+        code += " *>(table)->EstimatePackedSize();\n";
+      }
+      code += "    default: return 0;\n  }\n}\n\n";
 
       // Generate an union copy constructor and operator=.
       auto unionTypeName = enum_def.name + "Union";
-      std::string unionDestructor = "inline " + unionTypeName + "::~" + unionTypeName + "() {\n";
+      std::string unionDestructor = "inline " + unionTypeName + "::~" + unionTypeName + "() { Reset(); }\n\n";
+      unionDestructor += "inline void " + unionTypeName + "::Reset() {\n";
       unionDestructor += "  switch (type) {\n";
       code += "inline " + unionTypeName + "::" + unionTypeName;
       code += "(const " + unionTypeName + " &other) : type(";
@@ -596,8 +735,8 @@ class CppGenerator : public BaseGenerator {
       code += "), table(nullptr) { *this = other; }\n";
       code += "inline " + unionTypeName + "& " + unionTypeName + "::operator=(const ";
       code += unionTypeName + " &other) {\n";
+      code += "  Reset();\n";
       code += "  type = other.type;\n";
-      code += "  delete table;\n";
       code += "  switch (other.type) {\n";
       for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end(); ++it) {
         auto ev = (*it);
@@ -615,7 +754,9 @@ class CppGenerator : public BaseGenerator {
       code += "      table = nullptr;\n";
       code += "      break;";
       code += "\n  }\n  return *this;\n}\n\n";
-      code += unionDestructor + "    default: assert(!table); break;\n  }\n}\n\n";
+      code += unionDestructor + "    default: assert(!table); break;\n  }\n";
+      code += "  table = nullptr;\n";
+      code += "  type = " + GenEnumVal(enum_def, "NONE", parser_.opts, true) + ";\n}\n\n";
 
       // Generate unions's operator=(const SupportedStructs &_o)
       for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end(); ++it) {
@@ -624,9 +765,9 @@ class CppGenerator : public BaseGenerator {
           continue;
         auto native_name = NativeName(WrapInNameSpace(*ev->struct_def));
         code += "inline " + unionTypeName + "& " + unionTypeName + "::operator=(const " + native_name;
-        code += " &_o) {\n  type = ";
+        code += " &_o) {\n  Reset();\n  type = ";
         code += GetEnumVal(enum_def, *ev, parser_.opts);
-        code += ";\n  delete table;\n";
+        code += ";\n";
         code += "  table = new " + native_name + "(_o);\n";
         code += "  return *this;\n}\n";
       }
@@ -696,10 +837,136 @@ class CppGenerator : public BaseGenerator {
   }
 
   void GenSimpleParam(std::string &code, FieldDef &field) {
-    code += ",\n    " + GenTypeWire(field.value.type, " ", true);
+    code += ",\n    " + GenTypeWire(field.value.type, " ", true,
+                                    field.offset64);
     code += field.name + " = " + GenDefaultParam(field);
   }
 
+  // The order in which the generated Create function adds the fields of a
+  // table: largest first, unless the table keeps its original order.
+  static std::vector<const FieldDef *> CreateAddOrder(
+      const StructDef &struct_def) {
+    std::vector<const FieldDef *> add_order;
+    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
+         size; size /= 2) {
+      for (auto it = struct_def.fields.vec.rbegin();
+           it != struct_def.fields.vec.rend(); ++it) {
+        auto &field = **it;
+        if (!field.deprecated && (!struct_def.sortbysize ||
+                                  size == FieldSize(field))) {
+          add_order.push_back(&field);
+        }
+      }
+    }
+    return add_order;
+  }
+
+  // The most bytes the generated Create function can write for a table,
+  // vtable included, whichever of its fields are present and wherever in the
+  // buffer it starts.
+  static size_t MaxTableSize(const StructDef &struct_def) {
+    // The padding only depends on the buffer size modulo the largest
+    // alignment, so track the most bytes written for each such remainder.
+    const size_t kMaxAlign = 16;
+    std::vector<size_t> most(kMaxAlign, 0);
+    auto add = [&](size_t size, size_t align, std::vector<size_t> *next) {
+      for (size_t r = 0; r < kMaxAlign; r++) {
+        auto written = PaddingBytes(r, align) + size;
+        auto &n = (*next)[(r + written) % kMaxAlign];
+        n = std::max(n, most[r] + written);
+      }
+    };
+    auto add_order = CreateAddOrder(struct_def);
+    for (auto it = add_order.begin(); it != add_order.end(); ++it) {
+      auto &type = (*it)->value.type;
+      auto next = most;  // The field may be left out.
+      if ((*it)->offset64)
+        add(sizeof(uoffset64_t), sizeof(uoffset64_t), &next);
+      else
+        add(InlineSize(type), InlineAlignment(type), &next);
+      most.swap(next);
+    }
+    std::vector<size_t> ends(kMaxAlign, 0);
+    add(sizeof(soffset_t), sizeof(soffset_t), &ends);
+    return *std::max_element(ends.begin(), ends.end()) +
+           sizeof(voffset_t) * (2 + struct_def.fields.vec.size());
+  }
+
+  // Generates the fast path of CreateX() for a table of only scalar and
+  // struct fields: when all of them are present, the table looks the same
+  // every time, so the positions of the fields and the vtable are computed
+  // here, the same way StartTable(), AddElement() and EndTable() would at
+  // runtime. `fields` is the order in which CreateX() adds them.
+  void GenPrecomputedCreate(const StructDef &struct_def,
+                            const std::vector<const FieldDef *> &fields,
+                            std::string &code) {
+    if (fields.empty()) return;
+    size_t max_align = 0;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      auto &type = (*it)->value.type;
+      if (!IsScalar(type.base_type) && !IsStruct(type)) return;
+      max_align = std::max(max_align, InlineAlignment(type));
+    }
+    // The first field aligns the table. Only if no other field (or the
+    // vtable offset) needs more, the padding between fields is fixed.
+    if (InlineAlignment(fields[0]->value.type) != max_align ||
+        max_align < sizeof(soffset_t)) {
+      return;
+    }
+    // Simulate the AddElement() calls, tracking the buffer size after each.
+    std::vector<size_t> ends;
+    size_t size = 0;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      auto &type = (*it)->value.type;
+      size += PaddingBytes(size, InlineAlignment(type)) + InlineSize(type);
+      ends.push_back(size);
+    }
+    auto table_size = size + PaddingBytes(size, sizeof(soffset_t)) +
+                      sizeof(soffset_t);
+    std::vector<size_t> offsets(struct_def.fields.vec.size(), 0);
+    std::string structs_present, scalars_set, writes;
+    for (size_t i = 0; i < fields.size(); i++) {
+      auto &field = *fields[i];
+      auto offset = NumToString(table_size - ends[i]);
+      offsets[(field.value.offset - FieldIndexToOffset(0)) /
+              sizeof(voffset_t)] = table_size - ends[i];
+      if (IsStruct(field.value.type)) {
+        structs_present += (structs_present.empty() ? "" : " && ") +
+                           field.name;
+        writes += "    memcpy(table_ + " + offset + ", " + field.name;
+        writes += ", sizeof(" + GenTypeSize(field.value.type) + "));\n";
+      } else {
+        auto value = GenUnderlyingCast(field, false, field.name);
+        scalars_set += (scalars_set.empty() ? "" : " && ") + value + " != " +
+                       GenDefaultConstant(field);
+        writes += "    flatbuffers::WriteScalar<";
+        writes += GenTypeWire(field.value.type, "", false) + ">(table_ + ";
+        writes += offset + ", " + value + ");\n";
+      }
+    }
+    std::string present = structs_present;
+    if (!scalars_set.empty()) {
+      scalars_set = "_fbb.ForcingDefaults() || (" + scalars_set + ")";
+      present += present.empty() ? scalars_set
+                                 : " &&\n      (" + scalars_set + ")";
+    }
+    code += "  if (" + present + ") {\n";
+    code += "    // All fields are present, so the layout is known.\n";
+    code += "    static const flatbuffers::voffset_t offsets_[] = { ";
+    for (auto it = offsets.begin(); it != offsets.end(); ++it) {
+      code += (it == offsets.begin() ? "" : ", ") + NumToString(*it);
+    }
+    code += " };\n";
+    code += "    auto start_ = _fbb.StartTable();\n";
+    code += "    auto table_ = _fbb.PushPrecomputedTable(";
+    code += NumToString(table_size) + ", " + NumToString(max_align) + ");\n";
+    code += writes;
+    code += "    return flatbuffers::Offset<" + struct_def.name + ">(";
+    code += "_fbb.EndPrecomputedTable(start_, offsets_, ";
+    code += NumToString(offsets.size()) + "));\n";
+    code += "  }\n";
+  }
+
   // Generate an accessor struct, builder structs & function for a table.
   void GenTable(StructDef &struct_def, std::string *code_ptr, std::vector<std::string> &qgadgets) {
     std::string &code = *code_ptr;
@@ -743,16 +1010,20 @@ class CppGenerator : public BaseGenerator {
       if (!field.deprecated) {  // Deprecated fields won't be accessible.
         auto is_scalar = IsScalar(field.value.type.base_type);
         GenComment(field.doc_comment, code_ptr, nullptr, "  ");
-        code += "  " + GenTypeGet(field.value.type, " ", "const ", " *", true);
+        code += "  " + GenTypeGet(field.value.type, " ", "const ", " *", true,
+                                  field.offset64);
         code += field.name + "() const { return ";
         // Call a different accessor for pointers, that indirects.
-        auto accessor =
+        std::string accessor =
             is_scalar
                 ? "GetField<"
-                : (IsStruct(field.value.type) ? "GetStruct<" : "GetPointer<");
+                : (IsStruct(field.value.type)
+                     ? "GetStruct<"
+                     : (field.offset64 ? "GetPointer64<" : "GetPointer<"));
         auto offsetstr = GenFieldOffsetName(field);
         auto call = accessor +
-                    GenTypeGet(field.value.type, "", "const ", " *", false) +
+                    GenTypeGet(field.value.type, "", "const ", " *", false,
+                               field.offset64) +
                     ">(" + offsetstr;
         // Default value as second arg for non-pointer types.
         if (IsScalar(field.value.type.base_type))
@@ -769,7 +1040,8 @@ class CppGenerator : public BaseGenerator {
             code += GenUnderlyingCast(field, false, "_" + field.name);
             code += "); }\n";
           } else {
-            auto type = GenTypeGet(field.value.type, " ", "", " *", true);
+            auto type = GenTypeGet(field.value.type, " ", "", " *", true,
+                                   field.offset64);
             code += "  " + type + "mutable_" + field.name + "() { return ";
             code += GenUnderlyingCast(field, true,
                                       accessor + type + ">(" + offsetstr + ")");
@@ -812,6 +1084,22 @@ class CppGenerator : public BaseGenerator {
             code += " val) const { return " + field.name + "() < val ? -1 : ";
             code += field.name + "() > val; }\n";
           }
+          // The key as stored, for FlatBufferBuilder::CreateVectorOfSortedTables
+          // and CreateKeyIndex.
+          if (field.value.type.base_type == BASE_TYPE_STRING) {
+            code += "  const flatbuffers::String *GetKey() const { return ";
+            code += "GetPointer<const flatbuffers::String *>(";
+            code += GenFieldOffsetName(field) + "); }\n";
+          } else {
+            auto type = GenTypeBasic(field.value.type, false);
+            if (field.attributes.Lookup("key_index")) {
+              code += "  typedef " + type + " KeyType;\n";
+              type = "KeyType";
+            }
+            code += "  " + type + " GetKey() const { return ";
+            code += "GetField<" + type + ">(" + GenFieldOffsetName(field);
+            code += ", " + GenDefaultConstant(field) + "); }\n";
+          }
         }
       }
     }
@@ -824,10 +1112,16 @@ class CppGenerator : public BaseGenerator {
          it != struct_def.fields.vec.end(); ++it) {
       auto &field = **it;
       if (!field.deprecated) {
-        code += prefix + "VerifyField";
-        if (field.required) code += "Required";
-        code += "<" + GenTypeSize(field.value.type);
-        code += ">(verifier, " + GenFieldOffsetName(field) + ")";
+        if (field.offset64) {
+          code += prefix + "VerifyOffset64(verifier, " +
+                  GenFieldOffsetName(field) +
+                  (field.required ? ", true)" : ")");
+        } else {
+          code += prefix + "VerifyField";
+          if (field.required) code += "Required";
+          code += "<" + GenTypeSize(field.value.type) + ">(verifier, " +
+                  GenFieldOffsetName(field) + ")";
+        }
         switch (field.value.type.base_type) {
           case BASE_TYPE_UNION:
             code += prefix + "Verify" + field.value.type.enum_def->name;
@@ -869,8 +1163,16 @@ class CppGenerator : public BaseGenerator {
       }
     }
     code += prefix + "verifier.EndTable();\n  }\n";
+    if (parser_.opts.cpp_frameowork == IDLOptions::Qt5) {
+      // Roles for flatbuffers::VectorModel, defined by GenQtRoles().
+      code += "  static QHash<int, QByteArray> QtRoleNames();\n";
+      code += "  QVariant QtRoleData(int role) const;\n";
+    }
     code += "};\n\n";  // End of table.
 
+    if (parser_.opts.cpp_frameowork == IDLOptions::Qt5)
+      GenQtModelsDecl(struct_def, &code);
+
     if (parser_.opts.generate_object_based_api) {
       // Generate a C++ object that can hold an unpacked version of this
       // table.
@@ -882,33 +1184,29 @@ class CppGenerator : public BaseGenerator {
         qgadgets.emplace_back(CurrentNameSpace()->GetFullyQualifiedName(structName, 100, "::"));
       }
       code += "  flatbuffers::Offset<" + struct_def.name + "> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;\n";
+      code += "  // An upper bound on the bytes Pack() adds to a builder, see\n";
+      code += "  // FlatBufferBuilder::Reserve().\n";
+      code += "  size_t EstimatePackedSize() const;\n";
       code += "  void UnPack(const " + struct_def.name + " *object);\n";
       code += "  inline " + structName + "& operator=(const " + struct_def.name + " *object) { UnPack(object); return *this;}\n";
       code += "  explicit " + structName + "(const " + struct_def.name + " *object) { UnPack(object); }\n\n";
+      if (parser_.opts.object_api_arena) {
+        // For unions, which hold their table by pointer.
+        code += "  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<" + structName + ">()); }\n";
+        code += "  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<" + structName + ">()); }\n\n";
+      }
 
       std::string fields_init;
       std::string qt5_properties;
       std::string qt5_members;
+      std::string qt5_models;
       std::string qt5_equalOperator;
       for (auto it = struct_def.fields.vec.begin();
            it != struct_def.fields.vec.end(); ++it) {
         auto &field = **it;
         if (!field.deprecated &&  // Deprecated fields won't be accessible.
             field.value.type.base_type != BASE_TYPE_UTYPE) {
-          code += "  ";
-          if (field.value.type.base_type == BASE_TYPE_STRUCT) {
-            if (IsStruct(field.value.type))
-              code += "flatbuffers::Optional<";
-            else
-              code += "flatbuffers::OptionalTable<";
-          }
-          code += GenTypeNative(field.value.type);
-          if (field.value.type.base_type == BASE_TYPE_STRUCT) {
-            if (!IsStruct(field.value.type))
-              code += ", " + WrapInNameSpace(*field.value.type.struct_def);
-            code += ">";
-          }
-          code += " " + field.name;
+          code += "  " + GenMemberTypeNative(field) + " " + field.name;
           if (IsScalar(field.value.type.base_type))
             fields_init += (fields_init.empty() ? "\n    : "  : "\n    , ") + field.name + "(" + GenDefaultParam(field) + ")";
           code += ";\n";
@@ -924,7 +1222,8 @@ class CppGenerator : public BaseGenerator {
                   qt5_properties += "  Q_PROPERTY(QVariant " + field.name + " READ get_" + field.name + " WRITE set_" + field.name + ")\n";
               } else if (field.value.type.base_type == BASE_TYPE_VECTOR) {
                   qt5_members += "  QObject* get_"+ field.name + "() {"
-                                 "return new flatbuffers::ListModel<" + GenTypeNative(field.value.type.VectorType()) + ">("+ field.name + ");}\n";
+                                 "return "+ field.name + "_model_.get(" + field.name + ");}\n";
+                  qt5_models += "  flatbuffers::ListModelCache<" + GenTypeNative(field.value.type.VectorType()) + "> " + field.name + "_model_;\n";
                   qt5_properties += "  Q_PROPERTY(QObject* " + field.name + " READ get_" + field.name + ")\n";
               } else {
                 qt5_properties += "  Q_PROPERTY(" + GenTypeNative(field.value.type, true) + " " + field.name + " MEMBER " + field.name + ")\n";
@@ -944,11 +1243,51 @@ class CppGenerator : public BaseGenerator {
               code += "  inline bool operator ==(const " + structName +" &other) const {\n    return " + qt5_equalOperator + ";\n  }\n";
               code += "  inline bool operator !=(const " + structName +" &other) const { return !operator==(other);}\n";
           }
+          if (GenRawStrings()) {
+            // Shares the buffer the strings point into.
+            qt5_models += "  QByteArray source_buffer_;\n";
+          }
+          if (!qt5_models.empty())
+            code += "\n private:\n" + qt5_models;
       }
 
       code += "};\n\n";
     }
 
+    if (GenLazyObjectApi()) {
+      // Generate a native table that is unpacked one field at a time, from
+      // a table that must outlive it. Fields are accessed through methods,
+      // which unpack them the first time.
+      auto lazyName = LazyName(struct_def.name);
+      code += "struct " + lazyName + " {\n";
+      std::string fields_init;
+      std::string accessors;
+      std::string members;
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto &field = **it;
+        if (field.deprecated ||
+            field.value.type.base_type == BASE_TYPE_UTYPE)
+          continue;
+        auto member_type = GenMemberTypeNative(field);
+        accessors += "  " + member_type + " &" + field.name + "();\n";
+        members += "  flatbuffers::LazyField<" + member_type + "> ";
+        members += field.name + "_;\n";
+        if (IsScalar(field.value.type.base_type))
+          fields_init += ", " + field.name + "_(" + GenDefaultParam(field) + ")";
+      }
+      code += "  explicit " + lazyName + "(const " + struct_def.name;
+      code += " *source = nullptr)\n    : source_(source)" + fields_init;
+      code += " {}\n\n";
+      code += "  // Fields that were never accessed are copied from the source.\n";
+      code += "  flatbuffers::Offset<" + struct_def.name + "> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;\n";
+      code += "  const " + struct_def.name + " *source() const { return source_; }\n\n";
+      if (!accessors.empty()) code += accessors + "\n";
+      code += " private:\n";
+      code += "  const " + struct_def.name + " *source_;\n";
+      code += members + "};\n\n";
+    }
+
     // Generate a builder struct, with methods of the form:
     // void add_name(type name) { fbb_.AddElement<type>(offset, name, default);
     // }
@@ -960,7 +1299,8 @@ class CppGenerator : public BaseGenerator {
       auto &field = **it;
       if (!field.deprecated) {
         code += "  void add_" + field.name + "(";
-        code += GenTypeWire(field.value.type, " ", true) + field.name;
+        code += GenTypeWire(field.value.type, " ", true, field.offset64) +
+                field.name;
         code += ") { fbb_.Add";
         if (IsScalar(field.value.type.base_type)) {
           code += "Element<" + GenTypeWire(field.value.type, "", false);
@@ -1014,17 +1354,12 @@ class CppGenerator : public BaseGenerator {
         GenSimpleParam(code, field);
       }
     }
-    code += ") {\n  " + struct_def.name + "Builder builder_(_fbb);\n";
-    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
-         size; size /= 2) {
-      for (auto it = struct_def.fields.vec.rbegin();
-           it != struct_def.fields.vec.rend(); ++it) {
-        auto &field = **it;
-        if (!field.deprecated && (!struct_def.sortbysize ||
-                                  size == SizeOf(field.value.type.base_type))) {
-          code += "  builder_.add_" + field.name + "(" + field.name + ");\n";
-        }
-      }
+    code += ") {\n";
+    auto add_order = CreateAddOrder(struct_def);
+    GenPrecomputedCreate(struct_def, add_order, code);
+    code += "  " + struct_def.name + "Builder builder_(_fbb);\n";
+    for (auto it = add_order.begin(); it != add_order.end(); ++it) {
+      code += "  builder_.add_" + (*it)->name + "(" + (*it)->name + ");\n";
     }
     code += "  return builder_.Finish();\n}\n\n";
 
@@ -1062,7 +1397,8 @@ class CppGenerator : public BaseGenerator {
             code += "_fbb.CreateString(" + field.name + ") : 0";
           } else if (field.value.type.base_type == BASE_TYPE_VECTOR) {
             code += ", " + field.name + " ? ";
-            code += "_fbb.CreateVector<";
+            code += field.offset64 ? "_fbb.CreateVector64<"
+                                   : "_fbb.CreateVector<";
             code += GenTypeWire(field.value.type.VectorType(), "", false);
             code += ">(*" + field.name + ") : 0";
           } else {
@@ -1072,6 +1408,326 @@ class CppGenerator : public BaseGenerator {
       }
       code += ");\n}\n\n";
     }
+
+    if (GenLazyObjectApi())
+      code += TableCopySignature(struct_def) + ";\n\n";
+  }
+
+  // Generate statements that unpack `field` of the table `src` into the
+  // native member `dest`. They reuse what `dest` already holds wherever they
+  // can: vector capacity, strings, and nested tables. Vectors go through
+  // the `model` of `dest`, if given and it has been created, which tells its
+  // views what changed. Strings point into the buffer `source` points to, if
+  // given and not null.
+  std::string GenUnPackField(const FieldDef &field, const std::string &src,
+                             const std::string &dest,
+                             const std::string &indent,
+                             const std::string &model = "",
+                             const std::string &source = "") {
+    auto gen_unpack_val = [&](const Type &type, const std::string &val,
+                              const std::string &to) -> std::string {
+      switch (type.base_type) {
+        case BASE_TYPE_STRING:
+          if (!source.empty())
+            return "flatbuffers::UnPackString(" + val + ", " + to + ", " +
+                   source + ")";
+          if (parser_.opts.cpp_frameowork == IDLOptions::Qt5)
+            return to + " = QByteArray(" + val + "->c_str(), " + val +
+                   "->size())";
+          return to + ".assign(" + val + "->c_str(), " + val + "->size())";
+        case BASE_TYPE_STRUCT:
+          if (IsStruct(type))
+            return to + " = *" + val;
+          return to + ".UnPack(" + val + ")";
+        case BASE_TYPE_BOOL:
+          return to + " = " + val + " != 0";
+        default:
+          return to + " = " + val;
+      }
+    };
+    auto getter = src + "->" + field.name + "()";
+    std::string code;
+    switch (field.value.type.base_type) {
+      case BASE_TYPE_VECTOR:
+        if (!model.empty()) {
+          auto element = field.value.type.VectorType();
+          code += indent + "if (auto _m = " + model + ".model()) {\n";
+          code += indent + "  _m->update(" + getter + " ? " + getter +
+                  "->size() : 0, [&](" + GenTypeNative(element) +
+                  " &_v, flatbuffers::uoffset_t _i) { " +
+                  gen_unpack_val(element, getter + "->Get(_i)", "_v") +
+                  "; });\n";
+          code += indent + "} else ";
+        } else {
+          code += indent;
+        }
+        code += "if (" + getter + ") {\n";
+        if (IsStruct(field.value.type.VectorType())) {
+          // Structs have nothing to reuse but the vector's capacity, and
+          // only a copy constructor.
+          code += indent + "  " + dest + ".clear();\n";
+          code += indent + "  for (auto it = " + getter + "->begin(), __end = " + getter + "->end(); it != __end; ++it)\n";
+          code += indent + "    " + dest + ".push_back(*(*it));\n";
+        } else {
+          code += indent + "  " + dest + ".resize(" + getter + "->size());\n";
+          code += indent + "  auto _e = " + dest + ".begin();\n";
+          code += indent + "  for (auto it = " + getter + "->begin(), __end = " + getter + "->end(); it != __end; ++it, ++_e)\n";
+          code += indent + "    " + gen_unpack_val(field.value.type.VectorType(),
+                                                   "(*it)", "(*_e)") + ";\n";
+        }
+        code += indent + "} else {\n";
+        code += indent + "  " + dest + ".clear();\n";
+        code += indent + "}\n";
+        break;
+      case BASE_TYPE_UTYPE:
+        break;
+      case BASE_TYPE_UNION:
+        code += indent + dest + ".UnPack(" + getter + ", " + src + "->" +
+                field.name + UnionTypeFieldSuffix() + "());\n";
+        break;
+      case BASE_TYPE_STRING:
+        code += indent + "if (" + getter + ") ";
+        code += gen_unpack_val(field.value.type, getter, dest);
+        code += "; else " + dest + ".clear();\n";
+        break;
+      default:
+        code += indent + dest + " = " + getter + ";\n";
+        break;
+    }
+    return code;
+  }
+
+  // Generate an expression that serializes the native member `accessor` of
+  // `field`, to pass to the CreateX function. For a union type field,
+  // `accessor` is the union member. Strings that still point into the buffer
+  // `source`, if given, are copied from there.
+  std::string GenPackField(const FieldDef &field, const std::string &accessor,
+                           const std::string &source = "") {
+    auto stlprefix = accessor + ".size() ? ";
+    std::string postfix = " : 0";
+    std::string code;
+    switch (field.value.type.base_type) {
+      case BASE_TYPE_UTYPE:
+        return accessor + ".type";
+      case BASE_TYPE_STRING:
+        if (!source.empty())
+          return stlprefix + "flatbuffers::PackString(_fbb, " + accessor +
+                 ", " + source + ")" + postfix;
+        return stlprefix + "_fbb.CreateString(" + accessor + ")" + postfix;
+      case BASE_TYPE_VECTOR: {
+        auto vector_type = field.value.type.VectorType();
+        code += stlprefix;
+        switch (vector_type.base_type) {
+          case BASE_TYPE_STRING:
+            if (!source.empty()) {
+              code += "_fbb.CreateVector<flatbuffers::Offset<flatbuffers::";
+              code += "String>>(" + accessor + ".size(), [&](size_t i) { ";
+              code += "return flatbuffers::PackString(_fbb, " + accessor;
+              code += "[i], " + source + "); })";
+            } else {
+              code += "_fbb.CreateVectorOfStrings(" + accessor + ")";
+            }
+            break;
+          case BASE_TYPE_STRUCT:
+            if (IsStruct(vector_type)) {
+              code += "_fbb.CreateVectorOfStructs";
+              code += (field.offset64 ? "64(" : "(") + accessor + ")";
+            } else {
+              code += "_fbb.CreateVector<flatbuffers::Offset<";
+              code += vector_type.struct_def->name + ">>(" + accessor;
+              code += ".size(), [&](size_t i) { return " + accessor;
+              code += "[i].Pack(_fbb); })";
+            }
+            break;
+          default:
+            code += "_fbb.CreateVector";
+            code += (field.offset64 ? "64(" : "(") + accessor + ")";
+            break;
+        }
+        return code + postfix;
+      }
+      case BASE_TYPE_UNION:
+        return accessor + ".Pack(_fbb)";
+      case BASE_TYPE_STRUCT:
+        if (IsStruct(field.value.type))
+          return accessor + ".get()";
+        return accessor + " ? " + accessor + "->Pack(_fbb) : 0";
+      default:
+        return accessor;
+    }
+  }
+
+  // Generate an expression that copies `field` of the table `src` into the
+  // builder as is, to pass to the CreateX function.
+  std::string GenCopyField(const FieldDef &field, const std::string &src) {
+    auto &type = field.value.type;
+    auto getter = src + "->" + field.name + "()";
+    auto prefix = getter + " ? ";
+    std::string postfix = " : 0";
+    switch (type.base_type) {
+      case BASE_TYPE_STRING:
+        return prefix + "_fbb.CreateString(" + getter + ")" + postfix;
+      case BASE_TYPE_VECTOR: {
+        auto vector_type = type.VectorType();
+        if (vector_type.base_type == BASE_TYPE_STRING ||
+            (vector_type.base_type == BASE_TYPE_STRUCT &&
+             !IsStruct(vector_type))) {
+          auto element = vector_type.base_type == BASE_TYPE_STRING
+              ? std::string("flatbuffers::String")
+              : WrapInNameSpace(*vector_type.struct_def);
+          auto copy = vector_type.base_type == BASE_TYPE_STRING
+              ? std::string("_fbb.CreateString(")
+              : WrapInNameSpace(vector_type.struct_def->defined_namespace,
+                                "Copy" + vector_type.struct_def->name) +
+                "(_fbb, ";
+          return prefix + "_fbb.CreateVector<flatbuffers::Offset<" + element +
+                 ">>(" + getter + "->size(), [&](size_t i) { return " + copy +
+                 getter + "->Get(static_cast<flatbuffers::uoffset_t>(i))); })" +
+                 postfix;
+        }
+        return prefix + "_fbb.CreateVectorCopy(" + getter + ")" + postfix;
+      }
+      case BASE_TYPE_UNION:
+        return WrapInNameSpace(type.enum_def->defined_namespace,
+                               "Copy" + type.enum_def->name) +
+               "(_fbb, " + getter + ", " + src + "->" + field.name +
+               UnionTypeFieldSuffix() + "())";
+      case BASE_TYPE_STRUCT:
+        if (IsStruct(type)) return getter;
+        return prefix + WrapInNameSpace(type.struct_def->defined_namespace,
+                                        "Copy" + type.struct_def->name) +
+               "(_fbb, " + getter + ")" + postfix;
+      default:
+        return getter;
+    }
+  }
+
+  // Generate the roles a table has as an element of a flatbuffers::
+  // VectorModel: one per scalar, string and struct field, read straight from
+  // the buffer.
+  void GenQtRoles(const StructDef &struct_def, std::string *code_ptr) {
+    std::string &code = *code_ptr;
+    auto name = WrapInNameSpace(struct_def, true);
+    std::string names;
+    std::string cases;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) continue;
+      std::string value;
+      if (IsScalar(field.value.type.base_type)) {
+        value = "QVariant::fromValue(" + field.name + "())";
+      } else if (field.value.type.base_type == BASE_TYPE_STRING) {
+        value = field.name + "() ? QVariant(QByteArray::fromRawData(" +
+                field.name + "()->c_str(), int(" + field.name +
+                "()->size()))) : QVariant()";
+      } else if (IsStruct(field.value.type)) {
+        value = field.name + "() ? QVariant::fromValue(*" + field.name +
+                "()) : QVariant()";
+      } else {
+        continue;
+      }
+      auto role = "Qt::UserRole + " +
+                  NumToString(it - struct_def.fields.vec.begin());
+      names += std::string(names.empty() ? "" : ",") + "\n    {" + role +
+               ", \"" + field.name + "\"}";
+      cases += "    case " + role + ": return " + value + ";\n";
+    }
+    code += "inline QHash<int, QByteArray> " + name + "::QtRoleNames() {\n";
+    if (names.empty())
+      code += "  return {};\n}\n\n";
+    else
+      code += "  return {" + names + "\n  };\n}\n\n";
+    code += "inline QVariant " + name + "::QtRoleData(int role) const {\n";
+    if (cases.empty()) {
+      code += "  (void)role;\n  return QVariant();\n}\n\n";
+      return;
+    }
+    code += "  switch (role) {\n" + cases;
+    code += "    default: return QVariant();\n  }\n}\n\n";
+  }
+
+  // Whether a field of a table gets a flatbuffers::VectorModel in its
+  // generated models object (see GenQtModelsDecl()).
+  static bool HasQtVectorModel(const FieldDef &field) {
+    return !field.deprecated && !field.offset64 &&
+           field.value.type.base_type == BASE_TYPE_VECTOR &&
+           field.value.type.element != BASE_TYPE_UNION &&
+           field.value.type.element != BASE_TYPE_UTYPE;
+  }
+
+  static bool HasQtVectorModels(const StructDef &struct_def) {
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      if (HasQtVectorModel(**it)) return true;
+    }
+    return false;
+  }
+
+  // Generate a QObject with a property per vector field of a table, holding
+  // a read-only flatbuffers::VectorModel over it in the buffer, made when
+  // the property is first read. Its methods are defined by GenQtModels().
+  void GenQtModelsDecl(const StructDef &struct_def, std::string *code_ptr) {
+    if (!HasQtVectorModels(struct_def)) return;
+    std::string &code = *code_ptr;
+    auto name = struct_def.name + "Models";
+    code += "// Read-only list models over the vectors of a " +
+            struct_def.name + ", for QML to\n";
+    code += "// show without unpacking them (see flatbuffers::VectorModel). "
+            "The buffer\n";
+    code += "// must outlive them.\n";
+    code += "class " + name + " : public QObject {\n";
+    code += "  Q_OBJECT\n";
+    std::string members;
+    std::string models;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!HasQtVectorModel(field)) continue;
+      code += "  Q_PROPERTY(QObject* " + field.name + " READ get_" +
+              field.name + " CONSTANT)\n";
+      members += "  QObject* get_" + field.name + "();\n";
+      models += "  flatbuffers::VectorModelCache<" +
+                GenTypeWire(field.value.type.VectorType(), "", false) + "> " +
+                field.name + "_model_;\n";
+    }
+    code += " public:\n";
+    code += "  explicit " + name + "(const " + struct_def.name +
+            " *table, QObject *parent = nullptr)\n";
+    code += "    : QObject(parent), table_(table) {}\n";
+    code += members;
+    code += "  // Show the same table in a newer buffer, in the models made so "
+            "far.\n";
+    code += "  void setTable(const " + struct_def.name + " *table);\n";
+    code += "  const " + struct_def.name + " *table() const { return table_; "
+            "}\n\n";
+    code += " private:\n";
+    code += "  const " + struct_def.name + " *table_;\n";
+    code += models;
+    code += "};\n\n";
+  }
+
+  // Generate the methods declared by GenQtModelsDecl(), after the metatypes
+  // the models need.
+  void GenQtModels(const StructDef &struct_def, std::string *code_ptr) {
+    if (!HasQtVectorModels(struct_def)) return;
+    std::string &code = *code_ptr;
+    auto table = WrapInNameSpace(struct_def, true);
+    auto name = table + "Models";
+    std::string set;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!HasQtVectorModel(field)) continue;
+      code += "inline QObject *" + name + "::get_" + field.name + "() {\n";
+      code += "  return " + field.name + "_model_.get(table_ ? table_->" +
+              field.name + "() : nullptr, this);\n}\n\n";
+      set += "  " + field.name + "_model_.set(table ? table->" + field.name +
+             "() : nullptr);\n";
+    }
+    code += "inline void " + name + "::setTable(const " + table +
+            " *table) {\n";
+    code += "  table_ = table;\n" + set + "}\n\n";
   }
 
   // Generate code for tables that needs to come after the regular definition.
@@ -1081,78 +1737,28 @@ class CppGenerator : public BaseGenerator {
     if (parser_.opts.generate_object_based_api) {
       // Generate the UnPack() method.
       code += TableUnPackSignature(struct_def) + " {\n";
+      if (GenRawStrings())
+        code += "  auto _source = flatbuffers::SourceBufferScope::Find(_o);\n";
       bool any_fields = false;
       for (auto it = struct_def.fields.vec.begin();
            it != struct_def.fields.vec.end(); ++it) {
         any_fields = true;
         auto &field = **it;
-        if (!field.deprecated) {
-          auto gen_unpack_val = [&](const Type &type, const std::string &val,
-                                    bool invector, const std::string &structName) -> std::string {
-            switch (type.base_type) {
-              case BASE_TYPE_STRING:
-                if (invector)
-                    return GenPushBack("std::string", "(" + val + "->c_str(), " + val + "->size())");
-                return "(_o->" + val + "()->c_str(), _o->" + val + "()->size())";
-              case BASE_TYPE_STRUCT:
-                if (IsStruct(type)) {
-                    if (invector)
-                      return "(*" + val + ")";
-                    return " = _o->" + val + "()";
-                }
-                if (invector)
-                  return GenPushBack(structName, "(" + val + ")");
-                return " = _o->" + val + "()";
-              case BASE_TYPE_BOOL:
-                if (invector)
-                  return "(" + val + " != 0)";
-                // fall trough
-              default:
-                if (invector)
-                    return "(" + val + ")";
-                return " = _o->" + val + "()";
-                break;
-            }
-          };
-          switch (field.value.type.base_type) {
-            case BASE_TYPE_VECTOR: {
-              code += "  " + field.name + ".clear();\n";
-              code += "  if (_o->" + field.name + "()) {\n";
-              code += "    " + field.name + ".reserve(_o->" + field.name + "()->size());\n";
-              code += "    for (auto it = _o->" + field.name + "()->begin(), __end = _o->" + field.name + "()->end(); it != __end; ++it)\n";
-              code += "      " + field.name + (parser_.opts.cpp_variant == IDLOptions::Cpp0x ? ".push_back" : ".emplace_back");
-              auto type_name = field.value.type.struct_def ? WrapInNameSpace(*field.value.type.struct_def) : "";
-              if (!type_name.empty() && !IsStruct(field.value.type))
-                  type_name = NativeName(type_name);
-              code += gen_unpack_val(field.value.type.VectorType(),
-                                     "(*it)", true, type_name) + ";\n";
-              code += "  }\n";
-              continue; // Don't add ; at the end
-            }
-            case BASE_TYPE_UTYPE:
-              continue;
-            case BASE_TYPE_UNION:
-                code += "  " + field.name + ".UnPack(_o->" + field.name + "(), _o->" + field.name + "_type())";
-              break;
-            default:
-              code += "  " + field.name;
-              if (field.value.type.base_type == BASE_TYPE_STRING) {
-                if (parser_.opts.cpp_frameowork == IDLOptions::Stl)
-                  code += ".assign";
-                else
-                  code += "= QByteArray";
-              }
-              auto struct_name = field.value.type.struct_def ? WrapInNameSpace(*field.value.type.struct_def) : "";
-              if (!struct_name.empty() && !IsStruct(field.value.type))
-                  struct_name = NativeName(struct_name);
-              code += gen_unpack_val(field.value.type, field.name, false, struct_name);
-              break;
-          }
-          code += ";\n";
-        }
+        if (!field.deprecated)
+          code += GenUnPackField(
+              field, "_o", field.name, "  ",
+              parser_.opts.cpp_frameowork == IDLOptions::Qt5
+                  ? field.name + "_model_"
+                  : "",
+              GenRawStrings() ? "_source" : "");
+      }
+      if (GenRawStrings()) {
+        // Only now, as the old strings may still have been compared.
+        code += "  if (_source) source_buffer_ = *_source; "
+                "else source_buffer_.clear();\n";
+      } else if (!any_fields) {
+        code += "  (void)_o;\n";
       }
-      if (!any_fields)
-          code += "  (void)_o;\n";
       code += "}\n\n";
 
       // Generate the Pack method.
@@ -1167,61 +1773,121 @@ class CppGenerator : public BaseGenerator {
           if (field.value.type.base_type == BASE_TYPE_UTYPE) {
             field_name = field_name.substr(0, field_name.size() -
                                               strlen(UnionTypeFieldSuffix()));
-            field_name += ".type";
-          }
-          auto accessor = field_name;
-          auto stlprefix = accessor + ".size() ? ";
-          auto postfix = " : 0";
-          if (field.value.type.base_type != BASE_TYPE_STRING &&
-               field.value.type.base_type != BASE_TYPE_VECTOR) {
-            postfix = "";
           }
+          code += ",\n    " + GenPackField(field, field_name,
+                                              GenRawStrings()
+                                                  ? "source_buffer_"
+                                                  : "");
+        }
+      }
+      code += ");\n}\n\n";
 
-          code += ",\n    ";
-          switch (field.value.type.base_type) {
-            case BASE_TYPE_STRING:
-              code += stlprefix + "_fbb.CreateString(" + accessor + ")";
-              code += postfix;
-              break;
-            case BASE_TYPE_VECTOR: {
-              auto vector_type = field.value.type.VectorType();
-              code += stlprefix;
-              switch (vector_type.base_type) {
-                case BASE_TYPE_STRING:
-                  code += "_fbb.CreateVectorOfStrings(" + accessor + ")";
-                  break;
-                case BASE_TYPE_STRUCT:
-                  if (IsStruct(vector_type)) {
-                    code += "_fbb.CreateVectorOfStructs(" + accessor + ")";
-                  } else {
-                    code += "_fbb.CreateVector<flatbuffers::Offset<";
-                    code += vector_type.struct_def->name + ">>(" + accessor;
-                    code += ".size(), [&](size_t i) { return " + accessor;
-                    code += "[i].Pack(_fbb); })";
-                  }
-                  break;
-                default:
-                  code += "_fbb.CreateVector(" + accessor + ")";
-                  break;
-              }
-              code += postfix;
-              break;
+      // Generate the EstimatePackedSize() method.
+      std::string children;
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto &field = **it;
+        if (field.deprecated) continue;
+        auto &type = field.value.type;
+        switch (type.base_type) {
+          case BASE_TYPE_STRING:
+            children += "  if (" + field.name + ".size()) _size += ";
+            children += "flatbuffers::EstimateStringSize(" + field.name;
+            children += ".size());\n";
+            break;
+          case BASE_TYPE_VECTOR: {
+            // These are not written to the builder's buffer until Finish().
+            if (field.offset64) break;
+            auto vector_type = type.VectorType();
+            auto elements = vector_type.base_type == BASE_TYPE_STRING ||
+                            (vector_type.base_type == BASE_TYPE_STRUCT &&
+                             !IsStruct(vector_type));
+            children += "  if (" + field.name + ".size()) {\n";
+            children += "    _size += flatbuffers::EstimateVectorSize(";
+            children += field.name + ".size(), ";
+            children += NumToString(InlineSize(vector_type)) + ");\n";
+            if (elements) {
+              children += "    for (auto it = " + field.name + ".begin(); ";
+              children += "it != " + field.name + ".end(); ++it)\n";
+              children += "      _size += ";
+              children += vector_type.base_type == BASE_TYPE_STRING
+                          ? "flatbuffers::EstimateStringSize(it->size())"
+                          : "it->EstimatePackedSize()";
+              children += ";\n";
             }
-            case BASE_TYPE_UNION:
-              code += accessor + ".Pack(_fbb)";
-              break;
-            case BASE_TYPE_STRUCT:
-              if (IsStruct(field.value.type)) {
-                code += accessor;
-              } else {
-                code += accessor + " ? " + accessor + "->Pack(_fbb) : 0";
-              }
-              break;
-            default:
-              code += accessor;
-              break;
+            children += "  }\n";
+            break;
           }
+          case BASE_TYPE_UNION:
+            children += "  _size += " + field.name + ".EstimatePackedSize();\n";
+            break;
+          case BASE_TYPE_STRUCT:
+            if (!IsStruct(type)) {
+              children += "  if (" + field.name + ") _size += ";
+              children += field.name + "->EstimatePackedSize();\n";
+            }
+            break;
+          default:
+            break;
+        }
+      }
+      code += TableEstimateSignature(struct_def) + " {\n";
+      code += "  size_t _size = " + NumToString(MaxTableSize(struct_def));
+      code += ";\n";
+      code += children;
+      code += "  return _size;\n}\n\n";
+    }
+
+    if (GenLazyObjectApi()) {
+      // Generate a function that copies a table from another buffer as is.
+      std::string args;
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto &field = **it;
+        if (!field.deprecated)
+          args += ",\n    " + GenCopyField(field, "_o");
+      }
+      code += TableCopySignature(struct_def) + " {\n";
+      if (args.empty()) code += "  (void)_o;\n";
+      code += "  return Create" + struct_def.name + "(_fbb" + args;
+      code += ");\n}\n\n";
+
+      // Generate the accessors of the lazy native table.
+      auto lazyName = LazyName(struct_def.name);
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto &field = **it;
+        if (field.deprecated ||
+            field.value.type.base_type == BASE_TYPE_UTYPE)
+          continue;
+        auto member = field.name + "_";
+        code += "inline " + GenMemberTypeNative(field) + " &" + lazyName;
+        code += "::" + field.name + "() {\n";
+        code += "  if (!" + member + ".loaded) {\n";
+        code += "    " + member + ".loaded = true;\n";
+        code += "    if (source_) {\n";
+        code += GenUnPackField(field, "source_", member + ".value", "      ");
+        code += "    }\n  }\n";
+        code += "  return " + member + ".value;\n}\n\n";
+      }
+
+      // Generate its Pack method.
+      code += "inline flatbuffers::Offset<" + struct_def.name + "> ";
+      code += lazyName + "::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {\n";
+      code += "  return Create" + struct_def.name + "(_fbb";
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        auto &field = **it;
+        if (field.deprecated) continue;
+        auto field_name = field.name;
+        if (field.value.type.base_type == BASE_TYPE_UTYPE) {
+          field_name = field_name.substr(0, field_name.size() -
+                                            strlen(UnionTypeFieldSuffix()));
         }
+        auto member = field_name + "_";
+        code += ",\n    !source_ || " + member + ".loaded ? (";
+        code += GenPackField(field, member + ".value") + ") : (";
+        code += GenCopyField(field, "source_") + ")";
       }
       code += ");\n}\n\n";
     }
@@ -69,13 +69,14 @@ template<typename T> void Print(T val, Type type, int /*indent*/,
 }
 
 // Print a vector a sequence of JSON values, comma separated, wrapped in "[]".
-template<typename T> void PrintVector(const Vector<T> &v, Type type,
-                                      int indent, const IDLOptions &opts,
-                                      std::string *_text) {
+// V is Vector<T>, or Vector64<T> for fields with the offset64 attribute.
+template<typename T, typename V = Vector<T>> void PrintVector(
+    const V &v, Type type, int indent, const IDLOptions &opts,
+    std::string *_text) {
   std::string &text = *_text;
   text += "[";
   text += NewLine(opts);
-  for (uoffset_t i = 0; i < v.size(); i++) {
+  for (decltype(v.size()) i = 0; i < v.size(); i++) {
     if (i) {
       text += ",";
       text += NewLine(opts);
@@ -193,6 +194,21 @@ template<> void Print<const void *>(const void *val,
   }
 }
 
+// Like the BASE_TYPE_VECTOR case above, for a vector behind a 64-bit offset.
+static void PrintVector64(const void *val, Type type, int indent,
+                          const IDLOptions &opts, std::string *_text) {
+  switch (type.base_type) {
+    #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, JTYPE, GTYPE, NTYPE, \
+      PTYPE) \
+      case BASE_TYPE_ ## ENUM: \
+        PrintVector<CTYPE, Vector64<CTYPE>>( \
+          *reinterpret_cast<const Vector64<CTYPE> *>(val), \
+          type, indent, opts, _text); break;
+      FLATBUFFERS_GEN_TYPES(FLATBUFFERS_TD)
+    #undef FLATBUFFERS_TD
+  }
+}
+
 // Generate text for a scalar field.
 template<typename T> static void GenField(const FieldDef &fd,
                                           const Table *table, bool fixed,
@@ -215,6 +231,10 @@ static void GenFieldOffset(const FieldDef &fd, const Table *table, bool fixed,
     assert(IsStruct(fd.value.type));
     val = reinterpret_cast<const Struct *>(table)->
             GetStruct<const void *>(fd.value.offset);
+  } else if (fd.offset64) {
+    PrintVector64(table->GetPointer64<const void *>(fd.value.offset),
+                  fd.value.type.VectorType(), indent, opts, _text);
+    return;
   } else {
     val = IsStruct(fd.value.type)
       ? table->GetStruct<const void *>(fd.value.offset)
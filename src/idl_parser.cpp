@@ -135,6 +135,14 @@ template<> inline CheckedError atot<Offset<void>>(const char *s, Parser &parser,
   return NoError();
 }
 
+template<> inline CheckedError atot<Offset64<void>>(const char *s,
+                                                    Parser &parser,
+                                                    Offset64<void> *val) {
+  (void)parser;
+  *val = Offset64<void>(static_cast<uoffset64_t>(StringToUInt(s)));
+  return NoError();
+}
+
 std::string Namespace::GetFullyQualifiedName(const std::string &name,
                                              size_t max_components, const std::string &separator) const {
   // Early exit if we don't have a defined namespace.
@@ -239,6 +247,7 @@ bool IsIdentifierStart(char c) {
 }
 
 CheckedError Parser::Next() {
+  FLATBUFFERS_PERF_COUNT(tokens_parsed, 1);
   doc_comment_.clear();
   bool seen_newline = false;
   attribute_.clear();
@@ -567,6 +576,7 @@ CheckedError Parser::ParseType(Type &type) {
 
 CheckedError Parser::AddField(StructDef &struct_def, const std::string &name,
                               const Type &type, FieldDef **dest) {
+  FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
   auto &field = *new FieldDef();
   field.value.offset =
     FieldIndexToOffset(static_cast<voffset_t>(struct_def.fields.vec.size()));
@@ -674,6 +684,9 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
         return Error("'key' field must be string or scalar type");
     }
   }
+  if (field->attributes.Lookup("key_index") &&
+      (!field->key || !IsScalar(field->value.type.base_type)))
+    return Error("'key_index' may only be set on a scalar 'key' field");
   auto nested = field->attributes.Lookup("nested_flatbuffer");
   if (nested) {
     if (nested->type.base_type != BASE_TYPE_STRING)
@@ -687,6 +700,12 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
     // wasn't defined elsewhere.
     LookupCreateStruct(nested->constant);
   }
+  field->offset64 = field->attributes.Lookup("offset64") != nullptr;
+  if (field->offset64 &&
+      (struct_def.fixed || type.base_type != BASE_TYPE_VECTOR ||
+       !(IsScalar(type.element) || IsStruct(type.VectorType()))))
+    return Error(
+          "'offset64' may only be set on a vector of scalars or structs");
 
   if (typefield) {
     // If this field is a union, and it has a manually assigned id,
@@ -694,6 +713,7 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
     auto attr = field->attributes.Lookup("id");
     if (attr) {
       auto id = atoi(attr->constant.c_str());
+      FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
       auto val = new Value();
       val->type = attr->type;
       val->constant = NumToString(id - 1);
@@ -761,8 +781,23 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
     }
     case BASE_TYPE_VECTOR: {
       EXPECT('[');
+      auto start = builder_.GetSize();
       uoffset_t off;
       ECHECK(ParseVector(val.type.VectorType(), &off));
+      if (field && field->offset64) {
+        // Move it over to where the builder keeps vectors with 64-bit
+        // offsets.
+        auto type = val.type.VectorType();
+        auto vec = builder_.GetCurrentBufferPointer();
+        auto len = ReadScalar<uoffset_t>(vec);
+        uint8_t *elems;
+        auto off64 = builder_.CreateUninitializedVector64(
+                       len, InlineSize(type), InlineAlignment(type), &elems);
+        memcpy(elems, vec + sizeof(uoffset_t), len * InlineSize(type));
+        builder_.PopBytes(builder_.GetSize() - start);
+        val.constant = NumToString(off64);
+        break;
+      }
       val.constant = NumToString(off);
       break;
     }
@@ -852,8 +887,7 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
              it != field_stack_.rbegin() + fieldn; ++it) {
       auto &field_value = it->first;
       auto field = it->second;
-      if (!struct_def.sortbysize ||
-          size == SizeOf(field_value.type.base_type)) {
+      if (!struct_def.sortbysize || size == FieldSize(*field)) {
         switch (field_value.type.base_type) {
           #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, JTYPE, GTYPE, NTYPE, \
             PTYPE) \
@@ -878,6 +912,10 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
               builder_.Pad(field->padding); \
               if (IsStruct(field->value.type)) { \
                 SerializeStruct(*field->value.type.struct_def, field_value); \
+              } else if (field->offset64) { \
+                Offset64<void> val; \
+                ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
+                builder_.AddOffset(field_value.offset, val); \
               } else { \
                 CTYPE val; \
                 ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
@@ -960,6 +998,7 @@ CheckedError Parser::ParseMetaData(SymbolTable<Value> *attributes) {
       if (known_attributes_.find(name) == known_attributes_.end())
         return Error("user define attributes must be declared before use: " +
                      name);
+      FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
       auto e = new Value();
       attributes->Add(name, e);
       if (Is(':')) {
@@ -1159,6 +1198,7 @@ StructDef *Parser::LookupCreateStruct(const std::string &name,
     }
   }
   if (!struct_def && create_if_new) {
+    FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
     struct_def = new StructDef();
     if (definition) {
       structs_.Add(qualified_name, struct_def);
@@ -1173,6 +1213,7 @@ StructDef *Parser::LookupCreateStruct(const std::string &name,
       // TODO: maybe safer to use special namespace?
       structs_.Add(name, struct_def);
       struct_def->name = name;
+      FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
       struct_def->defined_namespace = new Namespace();
       namespaces_.insert(namespaces_.begin(), struct_def->defined_namespace);
     }
@@ -1185,6 +1226,7 @@ CheckedError Parser::ParseEnum(bool is_union, EnumDef **dest) {
   NEXT();
   std::string enum_name = attribute_;
   EXPECT(kTokenIdentifier);
+  FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
   auto &enum_def = *new EnumDef();
   enum_def.name = enum_name;
   enum_def.file = file_being_parsed_;
@@ -1219,7 +1261,10 @@ CheckedError Parser::ParseEnum(bool is_union, EnumDef **dest) {
   }
   ECHECK(ParseMetaData(&enum_def.attributes));
   EXPECT('{');
-  if (is_union) enum_def.vals.Add("NONE", new EnumVal("NONE", 0));
+  if (is_union) {
+    FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
+    enum_def.vals.Add("NONE", new EnumVal("NONE", 0));
+  }
   for (;;) {
     if (opts.proto_mode && attribute_ == "option") {
       ECHECK(ParseProtoOption());
@@ -1241,6 +1286,7 @@ CheckedError Parser::ParseEnum(bool is_union, EnumDef **dest) {
       auto value = enum_def.vals.vec.size()
         ? enum_def.vals.vec.back()->value + 1
         : 0;
+      FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
       auto &ev = *new EnumVal(value_name, value);
       if (enum_def.vals.Add(value_name, &ev))
         return Error("enum value already exists: " + value_name);
@@ -1390,6 +1436,7 @@ CheckedError Parser::ParseService() {
   NEXT();
   auto service_name = attribute_;
   EXPECT(kTokenIdentifier);
+  FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
   auto &service_def = *new ServiceDef();
   service_def.name = service_name;
   service_def.file = file_being_parsed_;
@@ -1412,6 +1459,7 @@ CheckedError Parser::ParseService() {
     if (reqtype.base_type != BASE_TYPE_STRUCT || reqtype.struct_def->fixed ||
         resptype.base_type != BASE_TYPE_STRUCT || resptype.struct_def->fixed)
         return Error("rpc request and response types must be tables");
+    FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
     auto &rpc = *new RPCCall();
     rpc.name = rpc_name;
     rpc.request = reqtype.struct_def;
@@ -1453,6 +1501,7 @@ void Parser::MarkGenerated() {
 
 CheckedError Parser::ParseNamespace() {
   NEXT();
+  FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
   auto ns = new Namespace();
   namespaces_.push_back(ns);
   if (token_ != ';') {
@@ -1496,6 +1545,7 @@ CheckedError Parser::ParseProtoDecl() {
       EXPECT(kTokenIdentifier);
       ECHECK(StartStruct(name, &struct_def));
       // Since message definitions can be nested, we create a new namespace.
+      FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
       auto ns = new Namespace();
       // Copy of current namespace.
       *ns = *namespaces_.back();
@@ -1821,6 +1871,7 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
   error_.clear();
   builder_.Clear();
   // Start with a blank namespace just in case this file doesn't have one.
+  FLATBUFFERS_PERF_COUNT(parser_allocations, 1);
   namespaces_.push_back(new Namespace());
   ECHECK(SkipByteOrderMark());
   NEXT();
@@ -2050,7 +2101,8 @@ Offset<reflection::Field> FieldDef::Serialize(FlatBufferBuilder *builder,
                                  deprecated,
                                  required,
                                  key,
-                                 SerializeAttributes(builder, parser));
+                                 SerializeAttributes(builder, parser),
+                                 offset64);
   // TODO: value.constant is almost always "0", we could save quite a bit of
   // space by sharing it. Same for common values of value.type.
 }
@@ -2127,6 +2179,8 @@ std::string Parser::ConformTo(const Parser &base) {
           return "defaults differ for field: " + field.name;
         if (!EqualByName(field.value.type, field_base->value.type))
           return "types differ for field: " + field.name;
+        if (field.offset64 != field_base->offset64)
+          return "offset sizes differ for field: " + field.name;
       } else {
         // Doesn't have to exist, deleting fields is fine.
         // But we should check if there is a field that has the same offset
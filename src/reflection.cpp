@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <unordered_map>
+
 #include "flatbuffers/reflection.h"
 #include "flatbuffers/util.h"
 
@@ -231,6 +233,12 @@ class ResizeContext {
         auto offsetloc = tableloc + offset;
         if (DagCheck(offsetloc))
           continue;  // This offset already visited.
+        if (fielddef.offset64()) {
+          // A vector of scalars or structs, nothing to recurse into.
+          Straddle<uoffset64_t, 1>(offsetloc,
+            offsetloc + ReadScalar<uoffset64_t>(offsetloc), offsetloc);
+          continue;
+        }
         auto ref = offsetloc + ReadScalar<uoffset_t>(offsetloc);
         Straddle<uoffset_t, 1>(offsetloc, ref, offsetloc);
         // Recurse.
@@ -355,19 +363,130 @@ void CopyInline(FlatBufferBuilder &fbb, const reflection::Field &fielddef,
   fbb.TrackField(fielddef.offset(), fbb.GetSize());
 }
 
-Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
+// Where tables and vectors of the source buffer went in the builder, so
+// that objects referred to more than once are copied once.
+typedef std::unordered_map<const void *, uoffset_t> CopiedObjects;
+
+static Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
+                                       const reflection::Schema &schema,
+                                       const reflection::Object &objectdef,
+                                       const Table &table,
+                                       bool use_string_pooling,
+                                       CopiedObjects *copied);
+
+static uoffset_t CopyVector(FlatBufferBuilder &fbb,
+                            const reflection::Schema &schema,
+                            const reflection::Field &fielddef,
+                            const Vector<Offset<Table>> *vec,
+                            bool use_string_pooling, CopiedObjects *copied) {
+  if (copied) {
+    auto it = copied->find(vec);
+    if (it != copied->end()) return it->second;
+  }
+  uoffset_t offset = 0;
+  auto element_base_type = fielddef.type()->element();
+  auto elemobjectdef = element_base_type == reflection::Obj
+                       ? schema.objects()->Get(fielddef.type()->index())
+                       : nullptr;
+  switch (element_base_type) {
+    case reflection::String: {
+      std::vector<Offset<const String *>> elements(vec->size());
+      auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
+      for (uoffset_t i = 0; i < vec_s->size(); i++) {
+        elements[i] = use_string_pooling
+                      ? fbb.CreateSharedString(vec_s->Get(i)).o
+                      : fbb.CreateString(vec_s->Get(i)).o;
+      }
+      offset = fbb.CreateVector(elements).o;
+      break;
+    }
+    case reflection::Obj: {
+      if (!elemobjectdef->is_struct()) {
+        std::vector<Offset<const Table *>> elements(vec->size());
+        for (uoffset_t i = 0; i < vec->size(); i++) {
+          elements[i] = CopyTable(fbb, schema, *elemobjectdef, *vec->Get(i),
+                                  use_string_pooling, copied);
+        }
+        offset = fbb.CreateVector(elements).o;
+        break;
+      }
+      // FALL-THRU:
+    }
+    default: {  // Scalars and structs.
+      auto element_size = GetTypeSize(element_base_type);
+      if (elemobjectdef && elemobjectdef->is_struct())
+        element_size = elemobjectdef->bytesize();
+      fbb.StartVector(vec->size(), element_size);
+      fbb.PushBytes(vec->Data(), element_size * vec->size());
+      offset = fbb.EndVector(vec->size());
+      break;
+    }
+  }
+  if (copied) (*copied)[vec] = offset;
+  return offset;
+}
+
+// Vectors of fields with the `offset64` attribute only hold scalars or
+// structs, so are copied as is.
+static uoffset64_t CopyVector64(FlatBufferBuilder &fbb,
                                 const reflection::Schema &schema,
-                                const reflection::Object &objectdef,
-                                const Table &table,
-                                bool use_string_pooling) {
+                                const reflection::Field &fielddef,
+                                const Vector64<uint8_t> *vec) {
+  auto element_base_type = fielddef.type()->element();
+  auto element_size = GetTypeSizeInline(element_base_type,
+                                        fielddef.type()->index(), schema);
+  auto alignment = element_base_type == reflection::Obj
+    ? static_cast<size_t>(schema.objects()->Get(fielddef.type()->index())->
+                            minalign())
+    : element_size;
+  auto len = static_cast<size_t>(vec->size());
+  uint8_t *buf;
+  auto offset = fbb.CreateUninitializedVector64(len, element_size, alignment,
+                                                &buf);
+  if (len) memcpy(buf, vec->Data(), len * element_size);
+  return offset;
+}
+
+// The alignment of a field inside a table. Adding the fields with the largest
+// alignment first, like the generated Create functions do, needs the least
+// padding.
+static size_t FieldAlignment(const reflection::Schema &schema,
+                             const reflection::Field &fielddef) {
+  if (fielddef.offset64()) return sizeof(uoffset64_t);
+  auto base_type = fielddef.type()->base_type();
+  if (base_type == reflection::Obj) {
+    auto &objectdef = *schema.objects()->Get(fielddef.type()->index());
+    return objectdef.is_struct() ? static_cast<size_t>(objectdef.minalign())
+                                 : sizeof(uoffset_t);
+  }
+  return GetTypeSize(base_type);  // Strings, vectors and unions: an offset.
+}
+
+static Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
+                                       const reflection::Schema &schema,
+                                       const reflection::Object &objectdef,
+                                       const Table &table,
+                                       bool use_string_pooling,
+                                       CopiedObjects *copied) {
+  if (copied) {
+    auto it = copied->find(&table);
+    if (it != copied->end()) return it->second;
+  }
   // Before we can construct the table, we have to first generate any
-  // subobjects, and collect their offsets.
-  std::vector<uoffset_t> offsets;
+  // subobjects, and collect their offsets, by field.
   auto fielddefs = objectdef.fields();
+  std::vector<uoffset64_t> offsets(fielddefs->size());
+  std::vector<uoffset_t> present;  // Field indices.
   for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
     auto &fielddef = **it;
     // Skip if field is not present in the source.
     if (!table.CheckField(fielddef.offset())) continue;
+    present.push_back(static_cast<uoffset_t>(it - fielddefs->begin()));
+    if (fielddef.offset64()) {
+      offsets[it - fielddefs->begin()] = CopyVector64(fbb, schema, fielddef,
+        table.GetPointer64<const Vector64<uint8_t> *>(fielddef.offset()));
+      continue;
+    }
     uoffset_t offset = 0;
     switch (fielddef.type()->base_type()) {
       case reflection::String: {
@@ -380,74 +499,49 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
         auto &subobjectdef = *schema.objects()->Get(fielddef.type()->index());
         if (!subobjectdef.is_struct()) {
           offset = CopyTable(fbb, schema, subobjectdef,
-                             *GetFieldT(table, fielddef)).o;
+                             *GetFieldT(table, fielddef), use_string_pooling,
+                             copied).o;
         }
         break;
       }
       case reflection::Union: {
         auto &subobjectdef = GetUnionType(schema, objectdef, fielddef, table);
         offset = CopyTable(fbb, schema, subobjectdef,
-                           *GetFieldT(table, fielddef)).o;
+                           *GetFieldT(table, fielddef), use_string_pooling,
+                           copied).o;
         break;
       }
       case reflection::Vector: {
         auto vec = table.GetPointer<const Vector<Offset<Table>> *>(
                                                              fielddef.offset());
-        auto element_base_type = fielddef.type()->element();
-        auto elemobjectdef = element_base_type == reflection::Obj
-                             ? schema.objects()->Get(fielddef.type()->index())
-                             : nullptr;
-        switch (element_base_type) {
-          case reflection::String: {
-            std::vector<Offset<const String *>> elements(vec->size());
-            auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
-            for (uoffset_t i = 0; i < vec_s->size(); i++) {
-              elements[i] = use_string_pooling
-                            ? fbb.CreateSharedString(vec_s->Get(i)).o
-                            : fbb.CreateString(vec_s->Get(i)).o;
-            }
-            offset = fbb.CreateVector(elements).o;
-            break;
-          }
-          case reflection::Obj: {
-            if (!elemobjectdef->is_struct()) {
-              std::vector<Offset<const Table *>> elements(vec->size());
-              for (uoffset_t i = 0; i < vec->size(); i++) {
-                elements[i] =
-                  CopyTable(fbb, schema, *elemobjectdef, *vec->Get(i));
-              }
-              offset = fbb.CreateVector(elements).o;
-              break;
-            }
-            // FALL-THRU:
-          }
-          default: {  // Scalars and structs.
-            auto element_size = GetTypeSize(element_base_type);
-            if (elemobjectdef && elemobjectdef->is_struct())
-              element_size = elemobjectdef->bytesize();
-            fbb.StartVector(element_size, vec->size());
-            fbb.PushBytes(vec->Data(), element_size * vec->size());
-            offset = fbb.EndVector(vec->size());
-            break;
-          }
-        }
+        offset = CopyVector(fbb, schema, fielddef, vec, use_string_pooling,
+                            copied);
         break;
       }
       default:  // Scalars.
         break;
     }
-    if (offset) {
-      offsets.push_back(offset);
-    }
+    offsets[it - fielddefs->begin()] = offset;
   }
   // Now we can build the actual table from either offsets or scalar data.
+  // The fields of structs stay in place, those of tables go largest first.
+  if (!objectdef.is_struct()) {
+    std::stable_sort(present.begin(), present.end(),
+                     [&](uoffset_t a, uoffset_t b) {
+      return FieldAlignment(schema, *fielddefs->Get(a)) >
+             FieldAlignment(schema, *fielddefs->Get(b));
+    });
+  }
   auto start = objectdef.is_struct()
                  ? fbb.StartStruct(objectdef.minalign())
                  : fbb.StartTable();
-  size_t offset_idx = 0;
-  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
-    auto &fielddef = **it;
-    if (!table.CheckField(fielddef.offset())) continue;
+  for (auto it = present.begin(); it != present.end(); ++it) {
+    auto &fielddef = *fielddefs->Get(*it);
+    auto offset = offsets[*it];
+    if (fielddef.offset64()) {
+      fbb.AddOffset(fielddef.offset(), Offset64<void>(offset));
+      continue;
+    }
     auto base_type = fielddef.type()->base_type();
     switch (base_type) {
       case reflection::Obj: {
@@ -462,7 +556,8 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
       case reflection::Union:
       case reflection::String:
       case reflection::Vector:
-        fbb.AddOffset(fielddef.offset(), Offset<void>(offsets[offset_idx++]));
+        fbb.AddOffset(fielddef.offset(),
+                      Offset<void>(static_cast<uoffset_t>(offset)));
         break;
       default: { // Scalars.
         auto size = GetTypeSize(base_type);
@@ -471,13 +566,268 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
       }
     }
   }
-  assert(offset_idx == offsets.size());
+  uoffset_t offset;
   if (objectdef.is_struct()) {
     fbb.ClearOffsets();
-    return fbb.EndStruct();
+    offset = fbb.EndStruct();
+  } else {
+    offset = fbb.EndTable(start, static_cast<voffset_t>(fielddefs->size()));
+  }
+  if (copied) (*copied)[&table] = offset;
+  return offset;
+}
+
+Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
+                                const reflection::Schema &schema,
+                                const reflection::Object &objectdef,
+                                const Table &table,
+                                bool use_string_pooling) {
+  return CopyTable(fbb, schema, objectdef, table, use_string_pooling, nullptr);
+}
+
+void CompactBuffer(FlatBufferBuilder &fbb, const reflection::Schema &schema,
+                   const uint8_t *flatbuf,
+                   const reflection::Object *root_table) {
+  if (!root_table) root_table = schema.root_table();
+  CopiedObjects copied;
+  auto root = CopyTable(fbb, schema, *root_table, *GetAnyRoot(flatbuf), true,
+                        &copied);
+  auto file_ident = schema.file_ident();
+  if (file_ident && file_ident->size() &&
+      BufferHasIdentifier(flatbuf, file_ident->c_str())) {
+    fbb.Finish(root, file_ident->c_str());
   } else {
-    return fbb.EndTable(start, static_cast<voffset_t>(fielddefs->size()));
+    fbb.Finish(root);
+  }
+}
+
+void CompactBuffer(const reflection::Schema &schema,
+                   std::vector<uint8_t> *flatbuf,
+                   const reflection::Object *root_table) {
+  FlatBufferBuilder fbb(static_cast<uoffset_t>(
+    (flatbuf->size() + sizeof(largest_scalar_t) - 1) &
+    ~(sizeof(largest_scalar_t) - 1)));
+  CompactBuffer(fbb, schema, flatbuf->data(), root_table);
+  flatbuf->assign(fbb.GetBufferPointer(),
+                  fbb.GetBufferPointer() + fbb.GetSize());
+}
+
+// Like the Verify() methods generated for tables, guided by the schema.
+static bool VerifyObject(Verifier &verifier, const reflection::Schema &schema,
+                         const reflection::Object &objectdef,
+                         const Table *table);
+
+// Verifies the bytes a field takes up in its table, or that it is absent
+// only when not required.
+static bool VerifyInline(Verifier &verifier, const Table &table,
+                         const reflection::Field &fielddef, size_t size) {
+  auto field_offset = table.GetOptionalFieldOffset(fielddef.offset());
+  if (!field_offset) return verifier.Check(!fielddef.required());
+  return verifier.Verify(reinterpret_cast<const uint8_t *>(&table) +
+                         field_offset, size);
+}
+
+static bool VerifyVectorField(Verifier &verifier,
+                              const reflection::Schema &schema,
+                              const reflection::Field &fielddef,
+                              const Table &table) {
+  auto element = fielddef.type()->element();
+  auto elem_size = GetTypeSizeInline(element, fielddef.type()->index(),
+                                     schema);
+  if (fielddef.offset64()) {
+    if (!table.VerifyOffset64(verifier, fielddef.offset(),
+                              fielddef.required())) {
+      return false;
+    }
+    auto vec = table.GetPointer64<const uint8_t *>(fielddef.offset());
+    if (!vec) return true;
+    if (!verifier.Verify<uoffset64_t>(vec)) return false;
+    auto size = ReadScalar<uoffset64_t>(vec);
+    // Protect against the byte size overflowing.
+    return verifier.Check(size <= FLATBUFFERS_MAX_64_BUFFER_SIZE / elem_size) &&
+           verifier.Verify(vec, sizeof(size) +
+                                static_cast<size_t>(size) * elem_size);
+  }
+  if (!VerifyInline(verifier, table, fielddef, sizeof(uoffset_t)))
+    return false;
+  auto vec = table.GetPointer<const uint8_t *>(fielddef.offset());
+  if (!vec) return true;
+  const uint8_t *end;
+  if (!verifier.VerifyVector(vec, elem_size, &end)) return false;
+  switch (element) {
+    case reflection::String:
+      return verifier.VerifyVectorOfStrings(
+               reinterpret_cast<const Vector<Offset<String>> *>(vec));
+    case reflection::Obj: {
+      auto &elemdef = *schema.objects()->Get(fielddef.type()->index());
+      if (elemdef.is_struct()) return true;
+      auto tables = reinterpret_cast<const Vector<Offset<Table>> *>(vec);
+      for (uoffset_t i = 0; i < tables->size(); i++) {
+        if (!VerifyObject(verifier, schema, elemdef, tables->Get(i)))
+          return false;
+      }
+      return true;
+    }
+    case reflection::Union:
+      return verifier.Check(false);  // Not in schemas this version accepts.
+    default:  // Scalars.
+      return true;
+  }
+}
+
+static bool VerifyObject(Verifier &verifier, const reflection::Schema &schema,
+                         const reflection::Object &objectdef,
+                         const Table *table) {
+  if (!table->VerifyTableStart(verifier)) return false;
+  auto fielddefs = objectdef.fields();
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    auto base_type = fielddef.type()->base_type();
+    switch (base_type) {
+      case reflection::String: {
+        if (!VerifyInline(verifier, *table, fielddef, sizeof(uoffset_t)) ||
+            !verifier.Verify(GetFieldS(*table, fielddef))) {
+          return false;
+        }
+        break;
+      }
+      case reflection::Vector: {
+        if (!VerifyVectorField(verifier, schema, fielddef, *table))
+          return false;
+        break;
+      }
+      case reflection::Obj: {
+        auto &subobjectdef = *schema.objects()->Get(fielddef.type()->index());
+        if (subobjectdef.is_struct()) {
+          if (!VerifyInline(verifier, *table, fielddef,
+                            subobjectdef.bytesize())) {
+            return false;
+          }
+          break;
+        }
+        if (!VerifyInline(verifier, *table, fielddef, sizeof(uoffset_t)))
+          return false;
+        auto subtable = GetFieldT(*table, fielddef);
+        if (subtable && !VerifyObject(verifier, schema, subobjectdef, subtable))
+          return false;
+        break;
+      }
+      case reflection::Union: {
+        if (!VerifyInline(verifier, *table, fielddef, sizeof(uoffset_t)))
+          return false;
+        auto subtable = GetFieldT(*table, fielddef);
+        if (!subtable) break;
+        // Fields are sorted by name, so the type field comes later.
+        auto type_field = fielddefs->LookupByKey(
+            (fielddef.name()->str() + UnionTypeFieldSuffix()).c_str());
+        if (!verifier.Check(type_field != nullptr) ||
+            !VerifyInline(verifier, *table, *type_field, sizeof(uint8_t))) {
+          return false;
+        }
+        auto union_type = GetFieldI<uint8_t>(*table, *type_field);
+        if (!union_type) break;  // NONE: the value is ignored.
+        auto enumval = schema.enums()->Get(fielddef.type()->index())->
+                         values()->LookupByKey(union_type);
+        if (!verifier.Check(enumval && enumval->object()) ||
+            !VerifyObject(verifier, schema, *enumval->object(), subtable)) {
+          return false;
+        }
+        break;
+      }
+      default: {  // Scalars.
+        auto field_offset = table->GetOptionalFieldOffset(fielddef.offset());
+        if (field_offset &&
+            !verifier.Verify(reinterpret_cast<const uint8_t *>(table) +
+                             field_offset, GetTypeSize(base_type))) {
+          return false;
+        }
+        break;
+      }
+    }
+  }
+  return verifier.EndTable();
+}
+
+bool VerifyAnyBuffer(const reflection::Schema &schema, const uint8_t *buf,
+                     size_t length, const reflection::Object *root_table,
+                     size_t max_depth, size_t max_tables) {
+  if (!root_table) root_table = schema.root_table();
+  Verifier verifier(buf, length, max_depth, max_tables);
+  return verifier.Verify<uoffset_t>(buf) &&
+         VerifyObject(verifier, schema, *root_table, GetAnyRoot(buf));
+}
+
+size_t EstimatePackedSize(const reflection::Schema &schema,
+                          const reflection::Object &objectdef,
+                          const Table &table) {
+  auto fielddefs = objectdef.fields();
+  // The vtable, the vtable offset and its padding, followed by every field
+  // with the padding in front of it.
+  size_t size = sizeof(uoffset_t) + sizeof(voffset_t) * fielddefs->size() +
+                sizeof(soffset_t) + sizeof(soffset_t) - 1;
+  for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+    auto &fielddef = **it;
+    if (!table.CheckField(fielddef.offset())) continue;
+    switch (fielddef.type()->base_type()) {
+      case reflection::String:
+        size += sizeof(uoffset_t) + sizeof(uoffset_t) - 1 +
+                EstimateStringSize(GetFieldS(table, fielddef)->size());
+        break;
+      case reflection::Obj: {
+        auto &subobjectdef = *schema.objects()->Get(fielddef.type()->index());
+        if (subobjectdef.is_struct()) {
+          size += subobjectdef.bytesize() + subobjectdef.minalign() - 1;
+          break;
+        }
+        size += sizeof(uoffset_t) + sizeof(uoffset_t) - 1 +
+                EstimatePackedSize(schema, subobjectdef,
+                                   *GetFieldT(table, fielddef));
+        break;
+      }
+      case reflection::Union: {
+        auto &subobjectdef = GetUnionType(schema, objectdef, fielddef, table);
+        size += sizeof(uoffset_t) + sizeof(uoffset_t) - 1 +
+                EstimatePackedSize(schema, subobjectdef,
+                                   *GetFieldT(table, fielddef));
+        break;
+      }
+      case reflection::Vector: {
+        // These don't go in the builder's buffer until Finish().
+        if (fielddef.offset64()) {
+          size += sizeof(uoffset64_t) + sizeof(uoffset64_t) - 1;
+          break;
+        }
+        auto vec = table.GetPointer<const Vector<Offset<Table>> *>(
+                                                             fielddef.offset());
+        auto element_base_type = fielddef.type()->element();
+        auto elemobjectdef = element_base_type == reflection::Obj
+                             ? schema.objects()->Get(fielddef.type()->index())
+                             : nullptr;
+        auto element_size = GetTypeSizeInline(element_base_type,
+                                              fielddef.type()->index(),
+                                              schema);
+        size += sizeof(uoffset_t) + sizeof(uoffset_t) - 1 +
+                flatbuffers::EstimateVectorSize(vec->size(), element_size);
+        if (element_base_type == reflection::String) {
+          auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
+          for (uoffset_t i = 0; i < vec_s->size(); i++) {
+            size += EstimateStringSize(vec_s->Get(i)->size());
+          }
+        } else if (elemobjectdef && !elemobjectdef->is_struct()) {
+          for (uoffset_t i = 0; i < vec->size(); i++) {
+            size += EstimatePackedSize(schema, *elemobjectdef, *vec->Get(i));
+          }
+        }
+        break;
+      }
+      default: {  // Scalars.
+        auto type_size = GetTypeSize(fielddef.type()->base_type());
+        size += type_size + type_size - 1;
+        break;
+      }
+    }
   }
+  return size;
 }
 
 }  // namespace flatbuffers
@@ -16,6 +16,13 @@
 
 #include "flatbuffers/util.h"
 
+#if defined(__unix__) || defined(__APPLE__)
+  #define FLATBUFFERS_MMAP_POSIX
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
 namespace flatbuffers {
 
 bool FileExistsRaw(const char *name) {
@@ -69,6 +76,108 @@ bool DirExists(const char *name) {
   return (file_info.st_mode & FLATBUFFERS_S_IFDIR) != 0;
 }
 
+MappedBuffer &MappedBuffer::operator=(MappedBuffer &&other) {
+  if (this != &other) {
+    Unmap();
+    contents_.swap(other.contents_);
+    data_ = other.data_;
+    size_ = other.size_;
+    // Short strings live inside the object, so they may have moved.
+    if (!contents_.empty()) data_ = reinterpret_cast<const uint8_t *>(
+                                      contents_.data());
+    other.data_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+bool MappedBuffer::Map(const char *name, Advice advice) {
+  Unmap();
+  if (DirExists(name)) return false;
+  #if defined(FLATBUFFERS_MMAP_POSIX)
+    auto fd = open(name, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat file_info;
+    if (fstat(fd, &file_info) != 0) {
+      close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(file_info.st_size);
+    if (size_) {
+      auto data = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+      if (data == MAP_FAILED) {
+        size_ = 0;
+        close(fd);
+        return false;
+      }
+      data_ = reinterpret_cast<const uint8_t *>(data);
+    }
+    close(fd);  // The mapping stays valid.
+  #elif defined(_WIN32)
+    auto file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+      CloseHandle(file);
+      return false;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_) {
+      auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                        nullptr);
+      auto data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                          : nullptr;
+      // The view keeps the mapping alive.
+      if (mapping) CloseHandle(mapping);
+      if (!data) {
+        size_ = 0;
+        CloseHandle(file);
+        return false;
+      }
+      data_ = reinterpret_cast<const uint8_t *>(data);
+    }
+    CloseHandle(file);
+  #else
+    if (!LoadFileRaw(name, true, &contents_)) return false;
+    data_ = reinterpret_cast<const uint8_t *>(contents_.data());
+    size_ = contents_.size();
+  #endif
+  Advise(advice);
+  return true;
+}
+
+bool MappedBuffer::Advise(Advice advice, size_t offset, size_t len) {
+  if (offset >= size_) return true;
+  len = std::min(len, size_ - offset);
+  #if defined(FLATBUFFERS_MMAP_POSIX)
+    static const int advice_flags[] = {
+      MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED
+    };
+    // madvise wants a page aligned start.
+    auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto start = reinterpret_cast<uintptr_t>(data_) + offset;
+    auto aligned_start = start & ~(page_size - 1);
+    return madvise(reinterpret_cast<void *>(aligned_start),
+                   len + (start - aligned_start), advice_flags[advice]) == 0;
+  #else
+    (void)advice;
+    return true;
+  #endif
+}
+
+void MappedBuffer::Unmap() {
+  #if defined(FLATBUFFERS_MMAP_POSIX)
+    if (data_) munmap(const_cast<uint8_t *>(data_), size_);
+  #elif defined(_WIN32)
+    if (data_) UnmapViewOfFile(data_);
+  #else
+    contents_.clear();
+  #endif
+  data_ = nullptr;
+  size_ = 0;
+}
+
 LoadFileFunction SetLoadFileFunction(LoadFileFunction load_file_function) {
   LoadFileFunction previous_function = g_load_file_function;
   g_load_file_function = load_file_function ? load_file_function : LoadFileRaw;
@@ -0,0 +1,1557 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_MONSTERTEST_MYGAME_EXAMPLE_H_
+#define FLATBUFFERS_GENERATED_MONSTERTEST_MYGAME_EXAMPLE_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/arena.h"
+
+namespace MyGame {
+namespace Example2 {
+
+struct Monster;
+struct MonsterT;
+
+}  // namespace Example2
+
+namespace Example {
+
+struct Test;
+
+struct TestSimpleTableWithEnum;
+struct TestSimpleTableWithEnumT;
+
+struct Vec3;
+
+struct Stat;
+struct StatT;
+
+struct Monster;
+struct MonsterT;
+
+enum Color {
+  Color_Red = 1,
+  Color_Green = 2,
+  Color_Blue = 8,
+  Color_NONE = 0,
+  Color_ANY = 11
+};
+
+inline const char **EnumNamesColor() {
+  static const char *names[] = { "Red", "Green", "", "", "", "", "", "Blue", nullptr };
+  return names;
+}
+
+inline const char *EnumNameColor(Color e) { return EnumNamesColor()[static_cast<int>(e) - static_cast<int>(Color_Red)]; }
+
+enum Any {
+  Any_NONE = 0,
+  Any_Monster = 1,
+  Any_TestSimpleTableWithEnum = 2,
+  Any_MyGame_Example2_Monster = 3,
+  Any_MIN = Any_NONE,
+  Any_MAX = Any_MyGame_Example2_Monster
+};
+
+struct AnyUnion {
+  Any type;
+
+  flatbuffers::NativeTable *table;
+  AnyUnion() : type(Any_NONE), table(nullptr) {}
+  AnyUnion(const AnyUnion &);
+  AnyUnion &operator=(const AnyUnion &);
+  AnyUnion(AnyUnion &&u) FLATBUFFERS_NOEXCEPT :
+    type(Any_NONE), table(nullptr)
+    { std::swap(type, u.type); std::swap(table, u.table); }
+  AnyUnion &operator=(AnyUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(table, u.table); return *this; }
+  ~AnyUnion();
+  void Reset();
+
+  void UnPack(const void *union_obj, Any _t);
+  flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  size_t EstimatePackedSize() const;
+
+  MonsterT *AsMonster() { return type == Any_Monster ? reinterpret_cast<MonsterT *>(table) : nullptr; }
+  AnyUnion &operator=(const MonsterT &_o);
+  TestSimpleTableWithEnumT *AsTestSimpleTableWithEnum() { return type == Any_TestSimpleTableWithEnum ? reinterpret_cast<TestSimpleTableWithEnumT *>(table) : nullptr; }
+  AnyUnion &operator=(const TestSimpleTableWithEnumT &_o);
+  MyGame::Example2::MonsterT *AsMyGame_Example2_Monster() { return type == Any_MyGame_Example2_Monster ? reinterpret_cast<MyGame::Example2::MonsterT *>(table) : nullptr; }
+  AnyUnion &operator=(const MyGame::Example2::MonsterT &_o);
+};
+
+inline const char **EnumNamesAny() {
+  static const char *names[] = { "NONE", "Monster", "TestSimpleTableWithEnum", "MyGame_Example2_Monster", nullptr };
+  return names;
+}
+
+inline const char *EnumNameAny(Any e) { return EnumNamesAny()[static_cast<int>(e)]; }
+
+inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, Any type);
+
+inline flatbuffers::Offset<void> CopyAny(flatbuffers::FlatBufferBuilder &_fbb, const void *union_obj, Any type);
+
+MANUALLY_ALIGNED_STRUCT(2) Test FLATBUFFERS_FINAL_CLASS {
+ private:
+  int16_t a_;
+  int8_t b_;
+  int8_t __padding0;
+
+ public:
+  Test() { memset(this, 0, sizeof(Test)); }
+  Test(const Test &_o) { memcpy(this, &_o, sizeof(Test)); }
+  Test(int16_t _a, int8_t _b)
+    : a_(flatbuffers::EndianScalar(_a)), b_(flatbuffers::EndianScalar(_b)), __padding0(0) { (void)__padding0; }
+
+  int16_t a() const { return flatbuffers::EndianScalar(a_); }
+  void mutate_a(int16_t _a) { flatbuffers::WriteScalar(&a_, _a); }
+  int8_t b() const { return flatbuffers::EndianScalar(b_); }
+  void mutate_b(int8_t _b) { flatbuffers::WriteScalar(&b_, _b); }
+};
+STRUCT_END(Test, 4);
+
+MANUALLY_ALIGNED_STRUCT(16) Vec3 FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+  int32_t __padding0;
+  double test1_;
+  int8_t test2_;
+  int8_t __padding1;
+  Test test3_;
+  int16_t __padding2;
+
+ public:
+  Vec3() { memset(this, 0, sizeof(Vec3)); }
+  Vec3(const Vec3 &_o) { memcpy(this, &_o, sizeof(Vec3)); }
+  Vec3(float _x, float _y, float _z, double _test1, Color _test2, const Test &_test3)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)), z_(flatbuffers::EndianScalar(_z)), __padding0(0), test1_(flatbuffers::EndianScalar(_test1)), test2_(flatbuffers::EndianScalar(static_cast<int8_t>(_test2))), __padding1(0), test3_(_test3), __padding2(0) { (void)__padding0; (void)__padding1; (void)__padding2; }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  void mutate_x(float _x) { flatbuffers::WriteScalar(&x_, _x); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  void mutate_y(float _y) { flatbuffers::WriteScalar(&y_, _y); }
+  float z() const { return flatbuffers::EndianScalar(z_); }
+  void mutate_z(float _z) { flatbuffers::WriteScalar(&z_, _z); }
+  double test1() const { return flatbuffers::EndianScalar(test1_); }
+  void mutate_test1(double _test1) { flatbuffers::WriteScalar(&test1_, _test1); }
+  Color test2() const { return static_cast<Color>(flatbuffers::EndianScalar(test2_)); }
+  void mutate_test2(Color _test2) { flatbuffers::WriteScalar(&test2_, static_cast<int8_t>(_test2)); }
+  const Test &test3() const { return test3_; }
+  Test &mutable_test3() { return test3_; }
+};
+STRUCT_END(Vec3, 32);
+
+}  // namespace Example
+
+namespace Example2 {
+
+struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+};
+
+struct MonsterT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Monster *object);
+  inline MonsterT& operator=(const Monster *object) { UnPack(object); return *this;}
+  explicit MonsterT(const Monster *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<MonsterT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<MonsterT>()); }
+
+  MonsterT() {}
+
+};
+
+struct MonsterLazyT {
+  explicit MonsterLazyT(const Monster *source = nullptr)
+    : source_(source) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Monster *source() const { return source_; }
+
+ private:
+  const Monster *source_;
+};
+
+struct MonsterBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  MonsterBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  MonsterBuilder &operator=(const MonsterBuilder &);
+  flatbuffers::Offset<Monster> Finish() {
+    auto o = flatbuffers::Offset<Monster>(fbb_.EndTable(start_, 0));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb) {
+  MonsterBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o);
+
+}  // namespace Example2
+
+namespace Example {
+
+struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_COLOR = 4
+  };
+  Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2)); }
+  bool mutate_color(Color _color) { return SetField(VT_COLOR, static_cast<int8_t>(_color)); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int8_t>(verifier, VT_COLOR) &&
+           verifier.EndTable();
+  }
+};
+
+struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const TestSimpleTableWithEnum *object);
+  inline TestSimpleTableWithEnumT& operator=(const TestSimpleTableWithEnum *object) { UnPack(object); return *this;}
+  explicit TestSimpleTableWithEnumT(const TestSimpleTableWithEnum *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<TestSimpleTableWithEnumT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<TestSimpleTableWithEnumT>()); }
+
+  Color color;
+  TestSimpleTableWithEnumT()
+    : color(Color_Green) {}
+
+};
+
+struct TestSimpleTableWithEnumLazyT {
+  explicit TestSimpleTableWithEnumLazyT(const TestSimpleTableWithEnum *source = nullptr)
+    : source_(source), color_(Color_Green) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const TestSimpleTableWithEnum *source() const { return source_; }
+
+  Color &color();
+
+ private:
+  const TestSimpleTableWithEnum *source_;
+  flatbuffers::LazyField<Color> color_;
+};
+
+struct TestSimpleTableWithEnumBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_color(Color color) { fbb_.AddElement<int8_t>(TestSimpleTableWithEnum::VT_COLOR, static_cast<int8_t>(color), 2); }
+  TestSimpleTableWithEnumBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  TestSimpleTableWithEnumBuilder &operator=(const TestSimpleTableWithEnumBuilder &);
+  flatbuffers::Offset<TestSimpleTableWithEnum> Finish() {
+    auto o = flatbuffers::Offset<TestSimpleTableWithEnum>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb,
+    Color color = Color_Green) {
+  TestSimpleTableWithEnumBuilder builder_(_fbb);
+  builder_.add_color(color);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CopyTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnum *_o);
+
+struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ID = 4,
+    VT_VAL = 6,
+    VT_COUNT = 8
+  };
+  const flatbuffers::String *id() const { return GetPointer<const flatbuffers::String *>(VT_ID); }
+  flatbuffers::String *mutable_id() { return GetPointer<flatbuffers::String *>(VT_ID); }
+  int64_t val() const { return GetField<int64_t>(VT_VAL, 0); }
+  bool mutate_val(int64_t _val) { return SetField(VT_VAL, _val); }
+  uint16_t count() const { return GetField<uint16_t>(VT_COUNT, 0); }
+  bool mutate_count(uint16_t _count) { return SetField(VT_COUNT, _count); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_ID) &&
+           verifier.Verify(id()) &&
+           VerifyField<int64_t>(verifier, VT_VAL) &&
+           VerifyField<uint16_t>(verifier, VT_COUNT) &&
+           verifier.EndTable();
+  }
+};
+
+struct StatT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Stat *object);
+  inline StatT& operator=(const Stat *object) { UnPack(object); return *this;}
+  explicit StatT(const Stat *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<StatT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<StatT>()); }
+
+  flatbuffers::arena_string id;
+  int64_t val;
+  uint16_t count;
+  StatT()
+    : val(0)
+    , count(0) {}
+
+};
+
+struct StatLazyT {
+  explicit StatLazyT(const Stat *source = nullptr)
+    : source_(source), val_(0), count_(0) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Stat *source() const { return source_; }
+
+  flatbuffers::arena_string &id();
+  int64_t &val();
+  uint16_t &count();
+
+ private:
+  const Stat *source_;
+  flatbuffers::LazyField<flatbuffers::arena_string> id_;
+  flatbuffers::LazyField<int64_t> val_;
+  flatbuffers::LazyField<uint16_t> count_;
+};
+
+struct StatBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) { fbb_.AddOffset(Stat::VT_ID, id); }
+  void add_val(int64_t val) { fbb_.AddElement<int64_t>(Stat::VT_VAL, val, 0); }
+  void add_count(uint16_t count) { fbb_.AddElement<uint16_t>(Stat::VT_COUNT, count, 0); }
+  StatBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  StatBuilder &operator=(const StatBuilder &);
+  flatbuffers::Offset<Stat> Finish() {
+    auto o = flatbuffers::Offset<Stat>(fbb_.EndTable(start_, 3));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    int64_t val = 0,
+    uint16_t count = 0) {
+  StatBuilder builder_(_fbb);
+  builder_.add_val(val);
+  builder_.add_id(id);
+  builder_.add_count(count);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Stat> CreateStatDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    int64_t val = 0,
+    uint16_t count = 0) {
+  return CreateStat(_fbb, id ? _fbb.CreateString(id) : 0, val, count);
+}
+
+inline flatbuffers::Offset<Stat> CopyStat(flatbuffers::FlatBufferBuilder &_fbb, const Stat *_o);
+
+/// an example documentation comment: monster object
+struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_POS = 4,
+    VT_MANA = 6,
+    VT_HP = 8,
+    VT_NAME = 10,
+    VT_INVENTORY = 14,
+    VT_COLOR = 16,
+    VT_TEST_TYPE = 18,
+    VT_TEST = 20,
+    VT_TEST4 = 22,
+    VT_TESTARRAYOFSTRING = 24,
+    VT_TESTARRAYOFTABLES = 26,
+    VT_ENEMY = 28,
+    VT_TESTNESTEDFLATBUFFER = 30,
+    VT_TESTEMPTY = 32,
+    VT_TESTBOOL = 34,
+    VT_TESTHASHS32_FNV1 = 36,
+    VT_TESTHASHU32_FNV1 = 38,
+    VT_TESTHASHS64_FNV1 = 40,
+    VT_TESTHASHU64_FNV1 = 42,
+    VT_TESTHASHS32_FNV1A = 44,
+    VT_TESTHASHU32_FNV1A = 46,
+    VT_TESTHASHS64_FNV1A = 48,
+    VT_TESTHASHU64_FNV1A = 50,
+    VT_TESTARRAYOFBOOLS = 52,
+    VT_TESTF = 54,
+    VT_TESTF2 = 56,
+    VT_TESTF3 = 58,
+    VT_TESTARRAYOFSTRING2 = 60
+  };
+  const Vec3 *pos() const { return GetStruct<const Vec3 *>(VT_POS); }
+  Vec3 *mutable_pos() { return GetStruct<Vec3 *>(VT_POS); }
+  int16_t mana() const { return GetField<int16_t>(VT_MANA, 150); }
+  bool mutate_mana(int16_t _mana) { return SetField(VT_MANA, _mana); }
+  int16_t hp() const { return GetField<int16_t>(VT_HP, 100); }
+  bool mutate_hp(int16_t _hp) { return SetField(VT_HP, _hp); }
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  flatbuffers::String *mutable_name() { return GetPointer<flatbuffers::String *>(VT_NAME); }
+  bool KeyCompareLessThan(const Monster *o) const { return *name() < *o->name(); }
+  int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  const flatbuffers::Vector<uint8_t> *inventory() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
+  flatbuffers::Vector<uint8_t> *mutable_inventory() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
+  Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8)); }
+  bool mutate_color(Color _color) { return SetField(VT_COLOR, static_cast<int8_t>(_color)); }
+  Any test_type() const { return static_cast<Any>(GetField<uint8_t>(VT_TEST_TYPE, 0)); }
+  bool mutate_test_type(Any _test_type) { return SetField(VT_TEST_TYPE, static_cast<uint8_t>(_test_type)); }
+  const void *test() const { return GetPointer<const void *>(VT_TEST); }
+  void *mutable_test() { return GetPointer<void *>(VT_TEST); }
+  const flatbuffers::Vector<const Test *> *test4() const { return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4); }
+  flatbuffers::Vector<const Test *> *mutable_test4() { return GetPointer<flatbuffers::Vector<const Test *> *>(VT_TEST4); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING); }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_testarrayofstring() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING); }
+  /// an example documentation comment: this will end up in the generated code
+  /// multiline too
+  const flatbuffers::Vector<flatbuffers::Offset<Monster>> *testarrayoftables() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(VT_TESTARRAYOFTABLES); }
+  flatbuffers::Vector<flatbuffers::Offset<Monster>> *mutable_testarrayoftables() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(VT_TESTARRAYOFTABLES); }
+  const Monster *enemy() const { return GetPointer<const Monster *>(VT_ENEMY); }
+  Monster *mutable_enemy() { return GetPointer<Monster *>(VT_ENEMY); }
+  const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER); }
+  flatbuffers::Vector<uint8_t> *mutable_testnestedflatbuffer() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER); }
+  const MyGame::Example::Monster *testnestedflatbuffer_nested_root() const { return flatbuffers::GetRoot<MyGame::Example::Monster>(testnestedflatbuffer()->Data()); }
+  const Stat *testempty() const { return GetPointer<const Stat *>(VT_TESTEMPTY); }
+  Stat *mutable_testempty() { return GetPointer<Stat *>(VT_TESTEMPTY); }
+  bool testbool() const { return GetField<uint8_t>(VT_TESTBOOL, 0) != 0; }
+  bool mutate_testbool(bool _testbool) { return SetField(VT_TESTBOOL, static_cast<uint8_t>(_testbool)); }
+  int32_t testhashs32_fnv1() const { return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0); }
+  bool mutate_testhashs32_fnv1(int32_t _testhashs32_fnv1) { return SetField(VT_TESTHASHS32_FNV1, _testhashs32_fnv1); }
+  uint32_t testhashu32_fnv1() const { return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0); }
+  bool mutate_testhashu32_fnv1(uint32_t _testhashu32_fnv1) { return SetField(VT_TESTHASHU32_FNV1, _testhashu32_fnv1); }
+  int64_t testhashs64_fnv1() const { return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0); }
+  bool mutate_testhashs64_fnv1(int64_t _testhashs64_fnv1) { return SetField(VT_TESTHASHS64_FNV1, _testhashs64_fnv1); }
+  uint64_t testhashu64_fnv1() const { return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0); }
+  bool mutate_testhashu64_fnv1(uint64_t _testhashu64_fnv1) { return SetField(VT_TESTHASHU64_FNV1, _testhashu64_fnv1); }
+  int32_t testhashs32_fnv1a() const { return GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0); }
+  bool mutate_testhashs32_fnv1a(int32_t _testhashs32_fnv1a) { return SetField(VT_TESTHASHS32_FNV1A, _testhashs32_fnv1a); }
+  uint32_t testhashu32_fnv1a() const { return GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0); }
+  bool mutate_testhashu32_fnv1a(uint32_t _testhashu32_fnv1a) { return SetField(VT_TESTHASHU32_FNV1A, _testhashu32_fnv1a); }
+  int64_t testhashs64_fnv1a() const { return GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0); }
+  bool mutate_testhashs64_fnv1a(int64_t _testhashs64_fnv1a) { return SetField(VT_TESTHASHS64_FNV1A, _testhashs64_fnv1a); }
+  uint64_t testhashu64_fnv1a() const { return GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0); }
+  bool mutate_testhashu64_fnv1a(uint64_t _testhashu64_fnv1a) { return SetField(VT_TESTHASHU64_FNV1A, _testhashu64_fnv1a); }
+  const flatbuffers::Vector<uint8_t> *testarrayofbools() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS); }
+  flatbuffers::Vector<uint8_t> *mutable_testarrayofbools() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS); }
+  float testf() const { return GetField<float>(VT_TESTF, 3.14159f); }
+  bool mutate_testf(float _testf) { return SetField(VT_TESTF, _testf); }
+  float testf2() const { return GetField<float>(VT_TESTF2, 3.0f); }
+  bool mutate_testf2(float _testf2) { return SetField(VT_TESTF2, _testf2); }
+  float testf3() const { return GetField<float>(VT_TESTF3, 0.0f); }
+  bool mutate_testf3(float _testf3) { return SetField(VT_TESTF3, _testf3); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2); }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_testarrayofstring2() { return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<Vec3>(verifier, VT_POS) &&
+           VerifyField<int16_t>(verifier, VT_MANA) &&
+           VerifyField<int16_t>(verifier, VT_HP) &&
+           VerifyFieldRequired<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_INVENTORY) &&
+           verifier.Verify(inventory()) &&
+           VerifyField<int8_t>(verifier, VT_COLOR) &&
+           VerifyField<uint8_t>(verifier, VT_TEST_TYPE) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TEST) &&
+           VerifyAny(verifier, test(), test_type()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TEST4) &&
+           verifier.Verify(test4()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTARRAYOFSTRING) &&
+           verifier.Verify(testarrayofstring()) &&
+           verifier.VerifyVectorOfStrings(testarrayofstring()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTARRAYOFTABLES) &&
+           verifier.Verify(testarrayoftables()) &&
+           verifier.VerifyVectorOfTables(testarrayoftables()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_ENEMY) &&
+           verifier.VerifyTable(enemy()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTNESTEDFLATBUFFER) &&
+           verifier.Verify(testnestedflatbuffer()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTEMPTY) &&
+           verifier.VerifyTable(testempty()) &&
+           VerifyField<uint8_t>(verifier, VT_TESTBOOL) &&
+           VerifyField<int32_t>(verifier, VT_TESTHASHS32_FNV1) &&
+           VerifyField<uint32_t>(verifier, VT_TESTHASHU32_FNV1) &&
+           VerifyField<int64_t>(verifier, VT_TESTHASHS64_FNV1) &&
+           VerifyField<uint64_t>(verifier, VT_TESTHASHU64_FNV1) &&
+           VerifyField<int32_t>(verifier, VT_TESTHASHS32_FNV1A) &&
+           VerifyField<uint32_t>(verifier, VT_TESTHASHU32_FNV1A) &&
+           VerifyField<int64_t>(verifier, VT_TESTHASHS64_FNV1A) &&
+           VerifyField<uint64_t>(verifier, VT_TESTHASHU64_FNV1A) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTARRAYOFBOOLS) &&
+           verifier.Verify(testarrayofbools()) &&
+           VerifyField<float>(verifier, VT_TESTF) &&
+           VerifyField<float>(verifier, VT_TESTF2) &&
+           VerifyField<float>(verifier, VT_TESTF3) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TESTARRAYOFSTRING2) &&
+           verifier.Verify(testarrayofstring2()) &&
+           verifier.VerifyVectorOfStrings(testarrayofstring2()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MonsterT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Monster *object);
+  inline MonsterT& operator=(const Monster *object) { UnPack(object); return *this;}
+  explicit MonsterT(const Monster *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<MonsterT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<MonsterT>()); }
+
+  flatbuffers::OptionalStruct<Vec3> pos;
+  int16_t mana;
+  int16_t hp;
+  flatbuffers::arena_string name;
+  std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> inventory;
+  Color color;
+  AnyUnion test;
+  std::vector<Test, flatbuffers::arena_allocator<Test>> test4;
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> testarrayofstring;
+  std::vector<MonsterT, flatbuffers::arena_allocator<MonsterT>> testarrayoftables;
+  flatbuffers::OptionalTable<MonsterT, Monster, flatbuffers::arena_allocator<MonsterT>> enemy;
+  std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> testnestedflatbuffer;
+  flatbuffers::OptionalTable<StatT, Stat, flatbuffers::arena_allocator<StatT>> testempty;
+  bool testbool;
+  int32_t testhashs32_fnv1;
+  uint32_t testhashu32_fnv1;
+  int64_t testhashs64_fnv1;
+  uint64_t testhashu64_fnv1;
+  int32_t testhashs32_fnv1a;
+  uint32_t testhashu32_fnv1a;
+  int64_t testhashs64_fnv1a;
+  uint64_t testhashu64_fnv1a;
+  std::vector<bool, flatbuffers::arena_allocator<bool>> testarrayofbools;
+  float testf;
+  float testf2;
+  float testf3;
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> testarrayofstring2;
+  MonsterT()
+    : mana(150)
+    , hp(100)
+    , color(Color_Blue)
+    , testbool(false)
+    , testhashs32_fnv1(0)
+    , testhashu32_fnv1(0)
+    , testhashs64_fnv1(0)
+    , testhashu64_fnv1(0)
+    , testhashs32_fnv1a(0)
+    , testhashu32_fnv1a(0)
+    , testhashs64_fnv1a(0)
+    , testhashu64_fnv1a(0)
+    , testf(3.14159f)
+    , testf2(3.0f)
+    , testf3(0.0f) {}
+
+};
+
+struct MonsterLazyT {
+  explicit MonsterLazyT(const Monster *source = nullptr)
+    : source_(source), mana_(150), hp_(100), color_(Color_Blue), testbool_(false), testhashs32_fnv1_(0), testhashu32_fnv1_(0), testhashs64_fnv1_(0), testhashu64_fnv1_(0), testhashs32_fnv1a_(0), testhashu32_fnv1a_(0), testhashs64_fnv1a_(0), testhashu64_fnv1a_(0), testf_(3.14159f), testf2_(3.0f), testf3_(0.0f) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Monster *source() const { return source_; }
+
+  flatbuffers::OptionalStruct<Vec3> &pos();
+  int16_t &mana();
+  int16_t &hp();
+  flatbuffers::arena_string &name();
+  std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> &inventory();
+  Color &color();
+  AnyUnion &test();
+  std::vector<Test, flatbuffers::arena_allocator<Test>> &test4();
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> &testarrayofstring();
+  std::vector<MonsterT, flatbuffers::arena_allocator<MonsterT>> &testarrayoftables();
+  flatbuffers::OptionalTable<MonsterT, Monster, flatbuffers::arena_allocator<MonsterT>> &enemy();
+  std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> &testnestedflatbuffer();
+  flatbuffers::OptionalTable<StatT, Stat, flatbuffers::arena_allocator<StatT>> &testempty();
+  bool &testbool();
+  int32_t &testhashs32_fnv1();
+  uint32_t &testhashu32_fnv1();
+  int64_t &testhashs64_fnv1();
+  uint64_t &testhashu64_fnv1();
+  int32_t &testhashs32_fnv1a();
+  uint32_t &testhashu32_fnv1a();
+  int64_t &testhashs64_fnv1a();
+  uint64_t &testhashu64_fnv1a();
+  std::vector<bool, flatbuffers::arena_allocator<bool>> &testarrayofbools();
+  float &testf();
+  float &testf2();
+  float &testf3();
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> &testarrayofstring2();
+
+ private:
+  const Monster *source_;
+  flatbuffers::LazyField<flatbuffers::OptionalStruct<Vec3>> pos_;
+  flatbuffers::LazyField<int16_t> mana_;
+  flatbuffers::LazyField<int16_t> hp_;
+  flatbuffers::LazyField<flatbuffers::arena_string> name_;
+  flatbuffers::LazyField<std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>>> inventory_;
+  flatbuffers::LazyField<Color> color_;
+  flatbuffers::LazyField<AnyUnion> test_;
+  flatbuffers::LazyField<std::vector<Test, flatbuffers::arena_allocator<Test>>> test4_;
+  flatbuffers::LazyField<std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>>> testarrayofstring_;
+  flatbuffers::LazyField<std::vector<MonsterT, flatbuffers::arena_allocator<MonsterT>>> testarrayoftables_;
+  flatbuffers::LazyField<flatbuffers::OptionalTable<MonsterT, Monster, flatbuffers::arena_allocator<MonsterT>>> enemy_;
+  flatbuffers::LazyField<std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>>> testnestedflatbuffer_;
+  flatbuffers::LazyField<flatbuffers::OptionalTable<StatT, Stat, flatbuffers::arena_allocator<StatT>>> testempty_;
+  flatbuffers::LazyField<bool> testbool_;
+  flatbuffers::LazyField<int32_t> testhashs32_fnv1_;
+  flatbuffers::LazyField<uint32_t> testhashu32_fnv1_;
+  flatbuffers::LazyField<int64_t> testhashs64_fnv1_;
+  flatbuffers::LazyField<uint64_t> testhashu64_fnv1_;
+  flatbuffers::LazyField<int32_t> testhashs32_fnv1a_;
+  flatbuffers::LazyField<uint32_t> testhashu32_fnv1a_;
+  flatbuffers::LazyField<int64_t> testhashs64_fnv1a_;
+  flatbuffers::LazyField<uint64_t> testhashu64_fnv1a_;
+  flatbuffers::LazyField<std::vector<bool, flatbuffers::arena_allocator<bool>>> testarrayofbools_;
+  flatbuffers::LazyField<float> testf_;
+  flatbuffers::LazyField<float> testf2_;
+  flatbuffers::LazyField<float> testf3_;
+  flatbuffers::LazyField<std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>>> testarrayofstring2_;
+};
+
+struct MonsterBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_pos(const Vec3 *pos) { fbb_.AddStruct(Monster::VT_POS, pos); }
+  void add_mana(int16_t mana) { fbb_.AddElement<int16_t>(Monster::VT_MANA, mana, 150); }
+  void add_hp(int16_t hp) { fbb_.AddElement<int16_t>(Monster::VT_HP, hp, 100); }
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Monster::VT_NAME, name); }
+  void add_inventory(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory) { fbb_.AddOffset(Monster::VT_INVENTORY, inventory); }
+  void add_color(Color color) { fbb_.AddElement<int8_t>(Monster::VT_COLOR, static_cast<int8_t>(color), 8); }
+  void add_test_type(Any test_type) { fbb_.AddElement<uint8_t>(Monster::VT_TEST_TYPE, static_cast<uint8_t>(test_type), 0); }
+  void add_test(flatbuffers::Offset<void> test) { fbb_.AddOffset(Monster::VT_TEST, test); }
+  void add_test4(flatbuffers::Offset<flatbuffers::Vector<const Test *>> test4) { fbb_.AddOffset(Monster::VT_TEST4, test4); }
+  void add_testarrayofstring(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring) { fbb_.AddOffset(Monster::VT_TESTARRAYOFSTRING, testarrayofstring); }
+  void add_testarrayoftables(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>> testarrayoftables) { fbb_.AddOffset(Monster::VT_TESTARRAYOFTABLES, testarrayoftables); }
+  void add_enemy(flatbuffers::Offset<Monster> enemy) { fbb_.AddOffset(Monster::VT_ENEMY, enemy); }
+  void add_testnestedflatbuffer(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testnestedflatbuffer) { fbb_.AddOffset(Monster::VT_TESTNESTEDFLATBUFFER, testnestedflatbuffer); }
+  void add_testempty(flatbuffers::Offset<Stat> testempty) { fbb_.AddOffset(Monster::VT_TESTEMPTY, testempty); }
+  void add_testbool(bool testbool) { fbb_.AddElement<uint8_t>(Monster::VT_TESTBOOL, static_cast<uint8_t>(testbool), 0); }
+  void add_testhashs32_fnv1(int32_t testhashs32_fnv1) { fbb_.AddElement<int32_t>(Monster::VT_TESTHASHS32_FNV1, testhashs32_fnv1, 0); }
+  void add_testhashu32_fnv1(uint32_t testhashu32_fnv1) { fbb_.AddElement<uint32_t>(Monster::VT_TESTHASHU32_FNV1, testhashu32_fnv1, 0); }
+  void add_testhashs64_fnv1(int64_t testhashs64_fnv1) { fbb_.AddElement<int64_t>(Monster::VT_TESTHASHS64_FNV1, testhashs64_fnv1, 0); }
+  void add_testhashu64_fnv1(uint64_t testhashu64_fnv1) { fbb_.AddElement<uint64_t>(Monster::VT_TESTHASHU64_FNV1, testhashu64_fnv1, 0); }
+  void add_testhashs32_fnv1a(int32_t testhashs32_fnv1a) { fbb_.AddElement<int32_t>(Monster::VT_TESTHASHS32_FNV1A, testhashs32_fnv1a, 0); }
+  void add_testhashu32_fnv1a(uint32_t testhashu32_fnv1a) { fbb_.AddElement<uint32_t>(Monster::VT_TESTHASHU32_FNV1A, testhashu32_fnv1a, 0); }
+  void add_testhashs64_fnv1a(int64_t testhashs64_fnv1a) { fbb_.AddElement<int64_t>(Monster::VT_TESTHASHS64_FNV1A, testhashs64_fnv1a, 0); }
+  void add_testhashu64_fnv1a(uint64_t testhashu64_fnv1a) { fbb_.AddElement<uint64_t>(Monster::VT_TESTHASHU64_FNV1A, testhashu64_fnv1a, 0); }
+  void add_testarrayofbools(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testarrayofbools) { fbb_.AddOffset(Monster::VT_TESTARRAYOFBOOLS, testarrayofbools); }
+  void add_testf(float testf) { fbb_.AddElement<float>(Monster::VT_TESTF, testf, 3.14159f); }
+  void add_testf2(float testf2) { fbb_.AddElement<float>(Monster::VT_TESTF2, testf2, 3.0f); }
+  void add_testf3(float testf3) { fbb_.AddElement<float>(Monster::VT_TESTF3, testf3, 0.0f); }
+  void add_testarrayofstring2(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring2) { fbb_.AddOffset(Monster::VT_TESTARRAYOFSTRING2, testarrayofstring2); }
+  MonsterBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  MonsterBuilder &operator=(const MonsterBuilder &);
+  flatbuffers::Offset<Monster> Finish() {
+    auto o = flatbuffers::Offset<Monster>(fbb_.EndTable(start_, 29));
+    fbb_.Required(o, Monster::VT_NAME);  // name
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb,
+    const Vec3 *pos = 0,
+    int16_t mana = 150,
+    int16_t hp = 100,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory = 0,
+    Color color = Color_Blue,
+    Any test_type = Any_NONE,
+    flatbuffers::Offset<void> test = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Test *>> test4 = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>> testarrayoftables = 0,
+    flatbuffers::Offset<Monster> enemy = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testnestedflatbuffer = 0,
+    flatbuffers::Offset<Stat> testempty = 0,
+    bool testbool = false,
+    int32_t testhashs32_fnv1 = 0,
+    uint32_t testhashu32_fnv1 = 0,
+    int64_t testhashs64_fnv1 = 0,
+    uint64_t testhashu64_fnv1 = 0,
+    int32_t testhashs32_fnv1a = 0,
+    uint32_t testhashu32_fnv1a = 0,
+    int64_t testhashs64_fnv1a = 0,
+    uint64_t testhashu64_fnv1a = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testarrayofbools = 0,
+    float testf = 3.14159f,
+    float testf2 = 3.0f,
+    float testf3 = 0.0f,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring2 = 0) {
+  MonsterBuilder builder_(_fbb);
+  builder_.add_testhashu64_fnv1a(testhashu64_fnv1a);
+  builder_.add_testhashs64_fnv1a(testhashs64_fnv1a);
+  builder_.add_testhashu64_fnv1(testhashu64_fnv1);
+  builder_.add_testhashs64_fnv1(testhashs64_fnv1);
+  builder_.add_testarrayofstring2(testarrayofstring2);
+  builder_.add_testf3(testf3);
+  builder_.add_testf2(testf2);
+  builder_.add_testf(testf);
+  builder_.add_testarrayofbools(testarrayofbools);
+  builder_.add_testhashu32_fnv1a(testhashu32_fnv1a);
+  builder_.add_testhashs32_fnv1a(testhashs32_fnv1a);
+  builder_.add_testhashu32_fnv1(testhashu32_fnv1);
+  builder_.add_testhashs32_fnv1(testhashs32_fnv1);
+  builder_.add_testempty(testempty);
+  builder_.add_testnestedflatbuffer(testnestedflatbuffer);
+  builder_.add_enemy(enemy);
+  builder_.add_testarrayoftables(testarrayoftables);
+  builder_.add_testarrayofstring(testarrayofstring);
+  builder_.add_test4(test4);
+  builder_.add_test(test);
+  builder_.add_inventory(inventory);
+  builder_.add_name(name);
+  builder_.add_pos(pos);
+  builder_.add_hp(hp);
+  builder_.add_mana(mana);
+  builder_.add_testbool(testbool);
+  builder_.add_test_type(test_type);
+  builder_.add_color(color);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Monster> CreateMonsterDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const Vec3 *pos = 0,
+    int16_t mana = 150,
+    int16_t hp = 100,
+    const char *name = nullptr,
+    const std::vector<uint8_t> *inventory = nullptr,
+    Color color = Color_Blue,
+    Any test_type = Any_NONE,
+    flatbuffers::Offset<void> test = 0,
+    const std::vector<const Test *> *test4 = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring = nullptr,
+    const std::vector<flatbuffers::Offset<Monster>> *testarrayoftables = nullptr,
+    flatbuffers::Offset<Monster> enemy = 0,
+    const std::vector<uint8_t> *testnestedflatbuffer = nullptr,
+    flatbuffers::Offset<Stat> testempty = 0,
+    bool testbool = false,
+    int32_t testhashs32_fnv1 = 0,
+    uint32_t testhashu32_fnv1 = 0,
+    int64_t testhashs64_fnv1 = 0,
+    uint64_t testhashu64_fnv1 = 0,
+    int32_t testhashs32_fnv1a = 0,
+    uint32_t testhashu32_fnv1a = 0,
+    int64_t testhashs64_fnv1a = 0,
+    uint64_t testhashu64_fnv1a = 0,
+    const std::vector<uint8_t> *testarrayofbools = nullptr,
+    float testf = 3.14159f,
+    float testf2 = 3.0f,
+    float testf3 = 0.0f,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2 = nullptr) {
+  return CreateMonster(_fbb, pos, mana, hp, name ? _fbb.CreateString(name) : 0, inventory ? _fbb.CreateVector<uint8_t>(*inventory) : 0, color, test_type, test, test4 ? _fbb.CreateVector<const Test *>(*test4) : 0, testarrayofstring ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*testarrayofstring) : 0, testarrayoftables ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(*testarrayoftables) : 0, enemy, testnestedflatbuffer ? _fbb.CreateVector<uint8_t>(*testnestedflatbuffer) : 0, testempty, testbool, testhashs32_fnv1, testhashu32_fnv1, testhashs64_fnv1, testhashu64_fnv1, testhashs32_fnv1a, testhashu32_fnv1a, testhashs64_fnv1a, testhashu64_fnv1a, testarrayofbools ? _fbb.CreateVector<uint8_t>(*testarrayofbools) : 0, testf, testf2, testf3, testarrayofstring2 ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*testarrayofstring2) : 0);
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o);
+
+}  // namespace Example
+
+namespace Example2 {
+
+inline void MonsterT::UnPack(const Monster *_o) {
+  (void)_o;
+}
+
+inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb);
+}
+
+inline size_t MonsterT::EstimatePackedSize() const {
+  size_t _size = 11;
+  return _size;
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o) {
+  (void)_o;
+  return CreateMonster(_fbb);
+}
+
+inline flatbuffers::Offset<Monster> MonsterLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb);
+}
+
+}  // namespace Example2
+
+namespace Example {
+
+inline void TestSimpleTableWithEnumT::UnPack(const TestSimpleTableWithEnum *_o) {
+  color = _o->color();
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnumT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateTestSimpleTableWithEnum(_fbb,
+    color);
+}
+
+inline size_t TestSimpleTableWithEnumT::EstimatePackedSize() const {
+  size_t _size = 14;
+  return _size;
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CopyTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnum *_o) {
+  return CreateTestSimpleTableWithEnum(_fbb,
+    _o->color());
+}
+
+inline Color &TestSimpleTableWithEnumLazyT::color() {
+  if (!color_.loaded) {
+    color_.loaded = true;
+    if (source_) {
+      color_.value = source_->color();
+    }
+  }
+  return color_.value;
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnumLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateTestSimpleTableWithEnum(_fbb,
+    !source_ || color_.loaded ? (color_.value) : (source_->color()));
+}
+
+inline void StatT::UnPack(const Stat *_o) {
+  if (_o->id()) id.assign(_o->id()->c_str(), _o->id()->size()); else id.clear();
+  val = _o->val();
+  count = _o->count();
+}
+
+inline flatbuffers::Offset<Stat> StatT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateStat(_fbb,
+    id.size() ? _fbb.CreateString(id) : 0,
+    val,
+    count);
+}
+
+inline size_t StatT::EstimatePackedSize() const {
+  size_t _size = 37;
+  if (id.size()) _size += flatbuffers::EstimateStringSize(id.size());
+  return _size;
+}
+
+inline flatbuffers::Offset<Stat> CopyStat(flatbuffers::FlatBufferBuilder &_fbb, const Stat *_o) {
+  return CreateStat(_fbb,
+    _o->id() ? _fbb.CreateString(_o->id()) : 0,
+    _o->val(),
+    _o->count());
+}
+
+inline flatbuffers::arena_string &StatLazyT::id() {
+  if (!id_.loaded) {
+    id_.loaded = true;
+    if (source_) {
+      if (source_->id()) id_.value.assign(source_->id()->c_str(), source_->id()->size()); else id_.value.clear();
+    }
+  }
+  return id_.value;
+}
+
+inline int64_t &StatLazyT::val() {
+  if (!val_.loaded) {
+    val_.loaded = true;
+    if (source_) {
+      val_.value = source_->val();
+    }
+  }
+  return val_.value;
+}
+
+inline uint16_t &StatLazyT::count() {
+  if (!count_.loaded) {
+    count_.loaded = true;
+    if (source_) {
+      count_.value = source_->count();
+    }
+  }
+  return count_.value;
+}
+
+inline flatbuffers::Offset<Stat> StatLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateStat(_fbb,
+    !source_ || id_.loaded ? (id_.value.size() ? _fbb.CreateString(id_.value) : 0) : (source_->id() ? _fbb.CreateString(source_->id()) : 0),
+    !source_ || val_.loaded ? (val_.value) : (source_->val()),
+    !source_ || count_.loaded ? (count_.value) : (source_->count()));
+}
+
+inline void MonsterT::UnPack(const Monster *_o) {
+  pos = _o->pos();
+  mana = _o->mana();
+  hp = _o->hp();
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
+  if (_o->inventory()) {
+    inventory.resize(_o->inventory()->size());
+    auto _e = inventory.begin();
+    for (auto it = _o->inventory()->begin(), __end = _o->inventory()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    inventory.clear();
+  }
+  color = _o->color();
+  test.UnPack(_o->test(), _o->test_type());
+  if (_o->test4()) {
+    test4.clear();
+    for (auto it = _o->test4()->begin(), __end = _o->test4()->end(); it != __end; ++it)
+      test4.push_back(*(*it));
+  } else {
+    test4.clear();
+  }
+  if (_o->testarrayofstring()) {
+    testarrayofstring.resize(_o->testarrayofstring()->size());
+    auto _e = testarrayofstring.begin();
+    for (auto it = _o->testarrayofstring()->begin(), __end = _o->testarrayofstring()->end(); it != __end; ++it, ++_e)
+      (*_e).assign((*it)->c_str(), (*it)->size());
+  } else {
+    testarrayofstring.clear();
+  }
+  if (_o->testarrayoftables()) {
+    testarrayoftables.resize(_o->testarrayoftables()->size());
+    auto _e = testarrayoftables.begin();
+    for (auto it = _o->testarrayoftables()->begin(), __end = _o->testarrayoftables()->end(); it != __end; ++it, ++_e)
+      (*_e).UnPack((*it));
+  } else {
+    testarrayoftables.clear();
+  }
+  enemy = _o->enemy();
+  if (_o->testnestedflatbuffer()) {
+    testnestedflatbuffer.resize(_o->testnestedflatbuffer()->size());
+    auto _e = testnestedflatbuffer.begin();
+    for (auto it = _o->testnestedflatbuffer()->begin(), __end = _o->testnestedflatbuffer()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    testnestedflatbuffer.clear();
+  }
+  testempty = _o->testempty();
+  testbool = _o->testbool();
+  testhashs32_fnv1 = _o->testhashs32_fnv1();
+  testhashu32_fnv1 = _o->testhashu32_fnv1();
+  testhashs64_fnv1 = _o->testhashs64_fnv1();
+  testhashu64_fnv1 = _o->testhashu64_fnv1();
+  testhashs32_fnv1a = _o->testhashs32_fnv1a();
+  testhashu32_fnv1a = _o->testhashu32_fnv1a();
+  testhashs64_fnv1a = _o->testhashs64_fnv1a();
+  testhashu64_fnv1a = _o->testhashu64_fnv1a();
+  if (_o->testarrayofbools()) {
+    testarrayofbools.resize(_o->testarrayofbools()->size());
+    auto _e = testarrayofbools.begin();
+    for (auto it = _o->testarrayofbools()->begin(), __end = _o->testarrayofbools()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it) != 0;
+  } else {
+    testarrayofbools.clear();
+  }
+  testf = _o->testf();
+  testf2 = _o->testf2();
+  testf3 = _o->testf3();
+  if (_o->testarrayofstring2()) {
+    testarrayofstring2.resize(_o->testarrayofstring2()->size());
+    auto _e = testarrayofstring2.begin();
+    for (auto it = _o->testarrayofstring2()->begin(), __end = _o->testarrayofstring2()->end(); it != __end; ++it, ++_e)
+      (*_e).assign((*it)->c_str(), (*it)->size());
+  } else {
+    testarrayofstring2.clear();
+  }
+}
+
+inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb,
+    pos.get(),
+    mana,
+    hp,
+    name.size() ? _fbb.CreateString(name) : 0,
+    inventory.size() ? _fbb.CreateVector(inventory) : 0,
+    color,
+    test.type,
+    test.Pack(_fbb),
+    test4.size() ? _fbb.CreateVectorOfStructs(test4) : 0,
+    testarrayofstring.size() ? _fbb.CreateVectorOfStrings(testarrayofstring) : 0,
+    testarrayoftables.size() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(testarrayoftables.size(), [&](size_t i) { return testarrayoftables[i].Pack(_fbb); }) : 0,
+    enemy ? enemy->Pack(_fbb) : 0,
+    testnestedflatbuffer.size() ? _fbb.CreateVector(testnestedflatbuffer) : 0,
+    testempty ? testempty->Pack(_fbb) : 0,
+    testbool,
+    testhashs32_fnv1,
+    testhashu32_fnv1,
+    testhashs64_fnv1,
+    testhashu64_fnv1,
+    testhashs32_fnv1a,
+    testhashu32_fnv1a,
+    testhashs64_fnv1a,
+    testhashu64_fnv1a,
+    testarrayofbools.size() ? _fbb.CreateVector(testarrayofbools) : 0,
+    testf,
+    testf2,
+    testf3,
+    testarrayofstring2.size() ? _fbb.CreateVectorOfStrings(testarrayofstring2) : 0);
+}
+
+inline size_t MonsterT::EstimatePackedSize() const {
+  size_t _size = 225;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (inventory.size()) {
+    _size += flatbuffers::EstimateVectorSize(inventory.size(), 1);
+  }
+  _size += test.EstimatePackedSize();
+  if (test4.size()) {
+    _size += flatbuffers::EstimateVectorSize(test4.size(), 4);
+  }
+  if (testarrayofstring.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofstring.size(), 4);
+    for (auto it = testarrayofstring.begin(); it != testarrayofstring.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  if (testarrayoftables.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayoftables.size(), 4);
+    for (auto it = testarrayoftables.begin(); it != testarrayoftables.end(); ++it)
+      _size += it->EstimatePackedSize();
+  }
+  if (enemy) _size += enemy->EstimatePackedSize();
+  if (testnestedflatbuffer.size()) {
+    _size += flatbuffers::EstimateVectorSize(testnestedflatbuffer.size(), 1);
+  }
+  if (testempty) _size += testempty->EstimatePackedSize();
+  if (testarrayofbools.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofbools.size(), 1);
+  }
+  if (testarrayofstring2.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofstring2.size(), 4);
+    for (auto it = testarrayofstring2.begin(); it != testarrayofstring2.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  return _size;
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o) {
+  return CreateMonster(_fbb,
+    _o->pos(),
+    _o->mana(),
+    _o->hp(),
+    _o->name() ? _fbb.CreateString(_o->name()) : 0,
+    _o->inventory() ? _fbb.CreateVectorCopy(_o->inventory()) : 0,
+    _o->color(),
+    _o->test_type(),
+    CopyAny(_fbb, _o->test(), _o->test_type()),
+    _o->test4() ? _fbb.CreateVectorCopy(_o->test4()) : 0,
+    _o->testarrayofstring() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(_o->testarrayofstring()->size(), [&](size_t i) { return _fbb.CreateString(_o->testarrayofstring()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0,
+    _o->testarrayoftables() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(_o->testarrayoftables()->size(), [&](size_t i) { return CopyMonster(_fbb, _o->testarrayoftables()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0,
+    _o->enemy() ? CopyMonster(_fbb, _o->enemy()) : 0,
+    _o->testnestedflatbuffer() ? _fbb.CreateVectorCopy(_o->testnestedflatbuffer()) : 0,
+    _o->testempty() ? CopyStat(_fbb, _o->testempty()) : 0,
+    _o->testbool(),
+    _o->testhashs32_fnv1(),
+    _o->testhashu32_fnv1(),
+    _o->testhashs64_fnv1(),
+    _o->testhashu64_fnv1(),
+    _o->testhashs32_fnv1a(),
+    _o->testhashu32_fnv1a(),
+    _o->testhashs64_fnv1a(),
+    _o->testhashu64_fnv1a(),
+    _o->testarrayofbools() ? _fbb.CreateVectorCopy(_o->testarrayofbools()) : 0,
+    _o->testf(),
+    _o->testf2(),
+    _o->testf3(),
+    _o->testarrayofstring2() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(_o->testarrayofstring2()->size(), [&](size_t i) { return _fbb.CreateString(_o->testarrayofstring2()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0);
+}
+
+inline flatbuffers::OptionalStruct<Vec3> &MonsterLazyT::pos() {
+  if (!pos_.loaded) {
+    pos_.loaded = true;
+    if (source_) {
+      pos_.value = source_->pos();
+    }
+  }
+  return pos_.value;
+}
+
+inline int16_t &MonsterLazyT::mana() {
+  if (!mana_.loaded) {
+    mana_.loaded = true;
+    if (source_) {
+      mana_.value = source_->mana();
+    }
+  }
+  return mana_.value;
+}
+
+inline int16_t &MonsterLazyT::hp() {
+  if (!hp_.loaded) {
+    hp_.loaded = true;
+    if (source_) {
+      hp_.value = source_->hp();
+    }
+  }
+  return hp_.value;
+}
+
+inline flatbuffers::arena_string &MonsterLazyT::name() {
+  if (!name_.loaded) {
+    name_.loaded = true;
+    if (source_) {
+      if (source_->name()) name_.value.assign(source_->name()->c_str(), source_->name()->size()); else name_.value.clear();
+    }
+  }
+  return name_.value;
+}
+
+inline std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> &MonsterLazyT::inventory() {
+  if (!inventory_.loaded) {
+    inventory_.loaded = true;
+    if (source_) {
+      if (source_->inventory()) {
+        inventory_.value.resize(source_->inventory()->size());
+        auto _e = inventory_.value.begin();
+        for (auto it = source_->inventory()->begin(), __end = source_->inventory()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        inventory_.value.clear();
+      }
+    }
+  }
+  return inventory_.value;
+}
+
+inline Color &MonsterLazyT::color() {
+  if (!color_.loaded) {
+    color_.loaded = true;
+    if (source_) {
+      color_.value = source_->color();
+    }
+  }
+  return color_.value;
+}
+
+inline AnyUnion &MonsterLazyT::test() {
+  if (!test_.loaded) {
+    test_.loaded = true;
+    if (source_) {
+      test_.value.UnPack(source_->test(), source_->test_type());
+    }
+  }
+  return test_.value;
+}
+
+inline std::vector<Test, flatbuffers::arena_allocator<Test>> &MonsterLazyT::test4() {
+  if (!test4_.loaded) {
+    test4_.loaded = true;
+    if (source_) {
+      if (source_->test4()) {
+        test4_.value.clear();
+        for (auto it = source_->test4()->begin(), __end = source_->test4()->end(); it != __end; ++it)
+          test4_.value.push_back(*(*it));
+      } else {
+        test4_.value.clear();
+      }
+    }
+  }
+  return test4_.value;
+}
+
+inline std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> &MonsterLazyT::testarrayofstring() {
+  if (!testarrayofstring_.loaded) {
+    testarrayofstring_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofstring()) {
+        testarrayofstring_.value.resize(source_->testarrayofstring()->size());
+        auto _e = testarrayofstring_.value.begin();
+        for (auto it = source_->testarrayofstring()->begin(), __end = source_->testarrayofstring()->end(); it != __end; ++it, ++_e)
+          (*_e).assign((*it)->c_str(), (*it)->size());
+      } else {
+        testarrayofstring_.value.clear();
+      }
+    }
+  }
+  return testarrayofstring_.value;
+}
+
+inline std::vector<MonsterT, flatbuffers::arena_allocator<MonsterT>> &MonsterLazyT::testarrayoftables() {
+  if (!testarrayoftables_.loaded) {
+    testarrayoftables_.loaded = true;
+    if (source_) {
+      if (source_->testarrayoftables()) {
+        testarrayoftables_.value.resize(source_->testarrayoftables()->size());
+        auto _e = testarrayoftables_.value.begin();
+        for (auto it = source_->testarrayoftables()->begin(), __end = source_->testarrayoftables()->end(); it != __end; ++it, ++_e)
+          (*_e).UnPack((*it));
+      } else {
+        testarrayoftables_.value.clear();
+      }
+    }
+  }
+  return testarrayoftables_.value;
+}
+
+inline flatbuffers::OptionalTable<MonsterT, Monster, flatbuffers::arena_allocator<MonsterT>> &MonsterLazyT::enemy() {
+  if (!enemy_.loaded) {
+    enemy_.loaded = true;
+    if (source_) {
+      enemy_.value = source_->enemy();
+    }
+  }
+  return enemy_.value;
+}
+
+inline std::vector<uint8_t, flatbuffers::arena_allocator<uint8_t>> &MonsterLazyT::testnestedflatbuffer() {
+  if (!testnestedflatbuffer_.loaded) {
+    testnestedflatbuffer_.loaded = true;
+    if (source_) {
+      if (source_->testnestedflatbuffer()) {
+        testnestedflatbuffer_.value.resize(source_->testnestedflatbuffer()->size());
+        auto _e = testnestedflatbuffer_.value.begin();
+        for (auto it = source_->testnestedflatbuffer()->begin(), __end = source_->testnestedflatbuffer()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        testnestedflatbuffer_.value.clear();
+      }
+    }
+  }
+  return testnestedflatbuffer_.value;
+}
+
+inline flatbuffers::OptionalTable<StatT, Stat, flatbuffers::arena_allocator<StatT>> &MonsterLazyT::testempty() {
+  if (!testempty_.loaded) {
+    testempty_.loaded = true;
+    if (source_) {
+      testempty_.value = source_->testempty();
+    }
+  }
+  return testempty_.value;
+}
+
+inline bool &MonsterLazyT::testbool() {
+  if (!testbool_.loaded) {
+    testbool_.loaded = true;
+    if (source_) {
+      testbool_.value = source_->testbool();
+    }
+  }
+  return testbool_.value;
+}
+
+inline int32_t &MonsterLazyT::testhashs32_fnv1() {
+  if (!testhashs32_fnv1_.loaded) {
+    testhashs32_fnv1_.loaded = true;
+    if (source_) {
+      testhashs32_fnv1_.value = source_->testhashs32_fnv1();
+    }
+  }
+  return testhashs32_fnv1_.value;
+}
+
+inline uint32_t &MonsterLazyT::testhashu32_fnv1() {
+  if (!testhashu32_fnv1_.loaded) {
+    testhashu32_fnv1_.loaded = true;
+    if (source_) {
+      testhashu32_fnv1_.value = source_->testhashu32_fnv1();
+    }
+  }
+  return testhashu32_fnv1_.value;
+}
+
+inline int64_t &MonsterLazyT::testhashs64_fnv1() {
+  if (!testhashs64_fnv1_.loaded) {
+    testhashs64_fnv1_.loaded = true;
+    if (source_) {
+      testhashs64_fnv1_.value = source_->testhashs64_fnv1();
+    }
+  }
+  return testhashs64_fnv1_.value;
+}
+
+inline uint64_t &MonsterLazyT::testhashu64_fnv1() {
+  if (!testhashu64_fnv1_.loaded) {
+    testhashu64_fnv1_.loaded = true;
+    if (source_) {
+      testhashu64_fnv1_.value = source_->testhashu64_fnv1();
+    }
+  }
+  return testhashu64_fnv1_.value;
+}
+
+inline int32_t &MonsterLazyT::testhashs32_fnv1a() {
+  if (!testhashs32_fnv1a_.loaded) {
+    testhashs32_fnv1a_.loaded = true;
+    if (source_) {
+      testhashs32_fnv1a_.value = source_->testhashs32_fnv1a();
+    }
+  }
+  return testhashs32_fnv1a_.value;
+}
+
+inline uint32_t &MonsterLazyT::testhashu32_fnv1a() {
+  if (!testhashu32_fnv1a_.loaded) {
+    testhashu32_fnv1a_.loaded = true;
+    if (source_) {
+      testhashu32_fnv1a_.value = source_->testhashu32_fnv1a();
+    }
+  }
+  return testhashu32_fnv1a_.value;
+}
+
+inline int64_t &MonsterLazyT::testhashs64_fnv1a() {
+  if (!testhashs64_fnv1a_.loaded) {
+    testhashs64_fnv1a_.loaded = true;
+    if (source_) {
+      testhashs64_fnv1a_.value = source_->testhashs64_fnv1a();
+    }
+  }
+  return testhashs64_fnv1a_.value;
+}
+
+inline uint64_t &MonsterLazyT::testhashu64_fnv1a() {
+  if (!testhashu64_fnv1a_.loaded) {
+    testhashu64_fnv1a_.loaded = true;
+    if (source_) {
+      testhashu64_fnv1a_.value = source_->testhashu64_fnv1a();
+    }
+  }
+  return testhashu64_fnv1a_.value;
+}
+
+inline std::vector<bool, flatbuffers::arena_allocator<bool>> &MonsterLazyT::testarrayofbools() {
+  if (!testarrayofbools_.loaded) {
+    testarrayofbools_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofbools()) {
+        testarrayofbools_.value.resize(source_->testarrayofbools()->size());
+        auto _e = testarrayofbools_.value.begin();
+        for (auto it = source_->testarrayofbools()->begin(), __end = source_->testarrayofbools()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it) != 0;
+      } else {
+        testarrayofbools_.value.clear();
+      }
+    }
+  }
+  return testarrayofbools_.value;
+}
+
+inline float &MonsterLazyT::testf() {
+  if (!testf_.loaded) {
+    testf_.loaded = true;
+    if (source_) {
+      testf_.value = source_->testf();
+    }
+  }
+  return testf_.value;
+}
+
+inline float &MonsterLazyT::testf2() {
+  if (!testf2_.loaded) {
+    testf2_.loaded = true;
+    if (source_) {
+      testf2_.value = source_->testf2();
+    }
+  }
+  return testf2_.value;
+}
+
+inline float &MonsterLazyT::testf3() {
+  if (!testf3_.loaded) {
+    testf3_.loaded = true;
+    if (source_) {
+      testf3_.value = source_->testf3();
+    }
+  }
+  return testf3_.value;
+}
+
+inline std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> &MonsterLazyT::testarrayofstring2() {
+  if (!testarrayofstring2_.loaded) {
+    testarrayofstring2_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofstring2()) {
+        testarrayofstring2_.value.resize(source_->testarrayofstring2()->size());
+        auto _e = testarrayofstring2_.value.begin();
+        for (auto it = source_->testarrayofstring2()->begin(), __end = source_->testarrayofstring2()->end(); it != __end; ++it, ++_e)
+          (*_e).assign((*it)->c_str(), (*it)->size());
+      } else {
+        testarrayofstring2_.value.clear();
+      }
+    }
+  }
+  return testarrayofstring2_.value;
+}
+
+inline flatbuffers::Offset<Monster> MonsterLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb,
+    !source_ || pos_.loaded ? (pos_.value.get()) : (source_->pos()),
+    !source_ || mana_.loaded ? (mana_.value) : (source_->mana()),
+    !source_ || hp_.loaded ? (hp_.value) : (source_->hp()),
+    !source_ || name_.loaded ? (name_.value.size() ? _fbb.CreateString(name_.value) : 0) : (source_->name() ? _fbb.CreateString(source_->name()) : 0),
+    !source_ || inventory_.loaded ? (inventory_.value.size() ? _fbb.CreateVector(inventory_.value) : 0) : (source_->inventory() ? _fbb.CreateVectorCopy(source_->inventory()) : 0),
+    !source_ || color_.loaded ? (color_.value) : (source_->color()),
+    !source_ || test_.loaded ? (test_.value.type) : (source_->test_type()),
+    !source_ || test_.loaded ? (test_.value.Pack(_fbb)) : (CopyAny(_fbb, source_->test(), source_->test_type())),
+    !source_ || test4_.loaded ? (test4_.value.size() ? _fbb.CreateVectorOfStructs(test4_.value) : 0) : (source_->test4() ? _fbb.CreateVectorCopy(source_->test4()) : 0),
+    !source_ || testarrayofstring_.loaded ? (testarrayofstring_.value.size() ? _fbb.CreateVectorOfStrings(testarrayofstring_.value) : 0) : (source_->testarrayofstring() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(source_->testarrayofstring()->size(), [&](size_t i) { return _fbb.CreateString(source_->testarrayofstring()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0),
+    !source_ || testarrayoftables_.loaded ? (testarrayoftables_.value.size() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(testarrayoftables_.value.size(), [&](size_t i) { return testarrayoftables_.value[i].Pack(_fbb); }) : 0) : (source_->testarrayoftables() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(source_->testarrayoftables()->size(), [&](size_t i) { return CopyMonster(_fbb, source_->testarrayoftables()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0),
+    !source_ || enemy_.loaded ? (enemy_.value ? enemy_.value->Pack(_fbb) : 0) : (source_->enemy() ? CopyMonster(_fbb, source_->enemy()) : 0),
+    !source_ || testnestedflatbuffer_.loaded ? (testnestedflatbuffer_.value.size() ? _fbb.CreateVector(testnestedflatbuffer_.value) : 0) : (source_->testnestedflatbuffer() ? _fbb.CreateVectorCopy(source_->testnestedflatbuffer()) : 0),
+    !source_ || testempty_.loaded ? (testempty_.value ? testempty_.value->Pack(_fbb) : 0) : (source_->testempty() ? CopyStat(_fbb, source_->testempty()) : 0),
+    !source_ || testbool_.loaded ? (testbool_.value) : (source_->testbool()),
+    !source_ || testhashs32_fnv1_.loaded ? (testhashs32_fnv1_.value) : (source_->testhashs32_fnv1()),
+    !source_ || testhashu32_fnv1_.loaded ? (testhashu32_fnv1_.value) : (source_->testhashu32_fnv1()),
+    !source_ || testhashs64_fnv1_.loaded ? (testhashs64_fnv1_.value) : (source_->testhashs64_fnv1()),
+    !source_ || testhashu64_fnv1_.loaded ? (testhashu64_fnv1_.value) : (source_->testhashu64_fnv1()),
+    !source_ || testhashs32_fnv1a_.loaded ? (testhashs32_fnv1a_.value) : (source_->testhashs32_fnv1a()),
+    !source_ || testhashu32_fnv1a_.loaded ? (testhashu32_fnv1a_.value) : (source_->testhashu32_fnv1a()),
+    !source_ || testhashs64_fnv1a_.loaded ? (testhashs64_fnv1a_.value) : (source_->testhashs64_fnv1a()),
+    !source_ || testhashu64_fnv1a_.loaded ? (testhashu64_fnv1a_.value) : (source_->testhashu64_fnv1a()),
+    !source_ || testarrayofbools_.loaded ? (testarrayofbools_.value.size() ? _fbb.CreateVector(testarrayofbools_.value) : 0) : (source_->testarrayofbools() ? _fbb.CreateVectorCopy(source_->testarrayofbools()) : 0),
+    !source_ || testf_.loaded ? (testf_.value) : (source_->testf()),
+    !source_ || testf2_.loaded ? (testf2_.value) : (source_->testf2()),
+    !source_ || testf3_.loaded ? (testf3_.value) : (source_->testf3()),
+    !source_ || testarrayofstring2_.loaded ? (testarrayofstring2_.value.size() ? _fbb.CreateVectorOfStrings(testarrayofstring2_.value) : 0) : (source_->testarrayofstring2() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(source_->testarrayofstring2()->size(), [&](size_t i) { return _fbb.CreateString(source_->testarrayofstring2()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0));
+}
+
+inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, Any type) {
+  switch (type) {
+    case Any_NONE: return true;
+    case Any_Monster: return verifier.VerifyTable(reinterpret_cast<const Monster *>(union_obj));
+    case Any_TestSimpleTableWithEnum: return verifier.VerifyTable(reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj));
+    case Any_MyGame_Example2_Monster: return verifier.VerifyTable(reinterpret_cast<const MyGame::Example2::Monster *>(union_obj));
+    default: return false;
+  }
+}
+
+inline flatbuffers::Offset<void> CopyAny(flatbuffers::FlatBufferBuilder &_fbb, const void *union_obj, Any type) {
+  switch (type) {
+    case Any_Monster: return CopyMonster(_fbb, reinterpret_cast<const Monster *>(union_obj)).Union();
+    case Any_TestSimpleTableWithEnum: return CopyTestSimpleTableWithEnum(_fbb, reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj)).Union();
+    case Any_MyGame_Example2_Monster: return MyGame::Example2::CopyMonster(_fbb, reinterpret_cast<const MyGame::Example2::Monster *>(union_obj)).Union();
+    default: return 0;
+  }
+}
+
+inline void AnyUnion::UnPack(const void *union_obj, Any _t) {
+  if (union_obj && _t == type) {
+    switch (_t) {
+      case Any_Monster: static_cast<MonsterT *>(table)->UnPack(reinterpret_cast<const Monster *>(union_obj)); return;
+      case Any_TestSimpleTableWithEnum: static_cast<TestSimpleTableWithEnumT *>(table)->UnPack(reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj)); return;
+      case Any_MyGame_Example2_Monster: static_cast<MyGame::Example2::MonsterT *>(table)->UnPack(reinterpret_cast<const MyGame::Example2::Monster *>(union_obj)); return;
+      default: break;
+    }
+  }
+  Reset();
+  type = _t;
+  if (!union_obj) { table = nullptr; type = Any_NONE; return; }
+  switch (_t) {
+    case Any_NONE: table = nullptr; break;
+    case Any_Monster: table = new MonsterT(reinterpret_cast<const Monster *>(union_obj)); break;
+    case Any_TestSimpleTableWithEnum: table = new TestSimpleTableWithEnumT(reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj)); break;
+    case Any_MyGame_Example2_Monster: table = new MyGame::Example2::MonsterT(reinterpret_cast<const MyGame::Example2::Monster *>(union_obj)); break;
+    default: table = nullptr; type = Any_NONE;
+  }
+}
+
+inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  switch (type) {
+    case Any_NONE: return 0;
+    case Any_Monster: return static_cast<const MonsterT *>(table)->Pack(_fbb).Union();
+    case Any_TestSimpleTableWithEnum: return static_cast<const TestSimpleTableWithEnumT *>(table)->Pack(_fbb).Union();
+    case Any_MyGame_Example2_Monster: return static_cast<const MyGame::Example2::MonsterT *>(table)->Pack(_fbb).Union();
+    default: return 0;
+  }
+}
+
+inline size_t AnyUnion::EstimatePackedSize() const {
+  switch (type) {
+    case Any_Monster: return static_cast<const MonsterT *>(table)->EstimatePackedSize();
+    case Any_TestSimpleTableWithEnum: return static_cast<const TestSimpleTableWithEnumT *>(table)->EstimatePackedSize();
+    case Any_MyGame_Example2_Monster: return static_cast<const MyGame::Example2::MonsterT *>(table)->EstimatePackedSize();
+    default: return 0;
+  }
+}
+
+inline AnyUnion::AnyUnion(const AnyUnion &other) : type(Any_NONE), table(nullptr) { *this = other; }
+inline AnyUnion& AnyUnion::operator=(const AnyUnion &other) {
+  Reset();
+  type = other.type;
+  switch (other.type) {
+    case Any_Monster: table = new MonsterT(*(static_cast<MonsterT *>(other.table))); break;
+    case Any_TestSimpleTableWithEnum: table = new TestSimpleTableWithEnumT(*(static_cast<TestSimpleTableWithEnumT *>(other.table))); break;
+    case Any_MyGame_Example2_Monster: table = new MyGame::Example2::MonsterT(*(static_cast<MyGame::Example2::MonsterT *>(other.table))); break;
+    default:
+      type = Any_NONE;
+      table = nullptr;
+      break;
+  }
+  return *this;
+}
+
+inline AnyUnion::~AnyUnion() { Reset(); }
+
+inline void AnyUnion::Reset() {
+  switch (type) {
+    case Any_Monster: delete static_cast<MonsterT *>(table); break;
+    case Any_TestSimpleTableWithEnum: delete static_cast<TestSimpleTableWithEnumT *>(table); break;
+    case Any_MyGame_Example2_Monster: delete static_cast<MyGame::Example2::MonsterT *>(table); break;
+    default: assert(!table); break;
+  }
+  table = nullptr;
+  type = Any_NONE;
+}
+
+inline AnyUnion& AnyUnion::operator=(const MonsterT &_o) {
+  Reset();
+  type = Any_Monster;
+  table = new MonsterT(_o);
+  return *this;
+}
+inline AnyUnion& AnyUnion::operator=(const TestSimpleTableWithEnumT &_o) {
+  Reset();
+  type = Any_TestSimpleTableWithEnum;
+  table = new TestSimpleTableWithEnumT(_o);
+  return *this;
+}
+inline AnyUnion& AnyUnion::operator=(const MyGame::Example2::MonsterT &_o) {
+  Reset();
+  type = Any_MyGame_Example2_Monster;
+  table = new MyGame::Example2::MonsterT(_o);
+  return *this;
+}
+
+inline const MyGame::Example::Monster *GetMonster(const void *buf) { return flatbuffers::GetRoot<MyGame::Example::Monster>(buf); }
+
+inline const MyGame::Example::Monster *GetSizePrefixedMonster(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Example::Monster>(buf); }
+
+inline Monster *GetMutableMonster(void *buf) { return flatbuffers::GetMutableRoot<Monster>(buf); }
+
+inline const char *MonsterIdentifier() { return "MONS"; }
+
+inline bool MonsterBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, MonsterIdentifier()); }
+
+inline bool VerifyMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Example::Monster>(MonsterIdentifier()); }
+
+inline bool VerifySizePrefixedMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Example::Monster>(MonsterIdentifier()); }
+
+inline const char *MonsterExtension() { return "mon"; }
+
+inline void FinishMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.Finish(root, MonsterIdentifier()); }
+
+inline void FinishSizePrefixedMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.FinishSizePrefixed(root, MonsterIdentifier()); }
+
+}  // namespace Example
+}  // namespace MyGame
+
+#endif  // FLATBUFFERS_GENERATED_MONSTERTEST_MYGAME_EXAMPLE_H_
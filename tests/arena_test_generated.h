@@ -0,0 +1,454 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_ARENATEST_ARENATEST_H_
+#define FLATBUFFERS_GENERATED_ARENATEST_ARENATEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/arena.h"
+
+namespace ArenaTest {
+
+struct Vec2;
+
+struct Leaf;
+struct LeafT;
+
+struct Node;
+struct NodeT;
+
+enum Payload {
+  Payload_NONE = 0,
+  Payload_Leaf = 1,
+  Payload_MIN = Payload_NONE,
+  Payload_MAX = Payload_Leaf
+};
+
+struct PayloadUnion {
+  Payload type;
+
+  flatbuffers::NativeTable *table;
+  PayloadUnion() : type(Payload_NONE), table(nullptr) {}
+  PayloadUnion(const PayloadUnion &);
+  PayloadUnion &operator=(const PayloadUnion &);
+  PayloadUnion(PayloadUnion &&u) FLATBUFFERS_NOEXCEPT :
+    type(Payload_NONE), table(nullptr)
+    { std::swap(type, u.type); std::swap(table, u.table); }
+  PayloadUnion &operator=(PayloadUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(table, u.table); return *this; }
+  ~PayloadUnion();
+  void Reset();
+
+  void UnPack(const void *union_obj, Payload _t);
+  flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  size_t EstimatePackedSize() const;
+
+  LeafT *AsLeaf() { return type == Payload_Leaf ? reinterpret_cast<LeafT *>(table) : nullptr; }
+  PayloadUnion &operator=(const LeafT &_o);
+};
+
+inline const char **EnumNamesPayload() {
+  static const char *names[] = { "NONE", "Leaf", nullptr };
+  return names;
+}
+
+inline const char *EnumNamePayload(Payload e) { return EnumNamesPayload()[static_cast<int>(e)]; }
+
+inline bool VerifyPayload(flatbuffers::Verifier &verifier, const void *union_obj, Payload type);
+
+MANUALLY_ALIGNED_STRUCT(4) Vec2 FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  Vec2() { memset(this, 0, sizeof(Vec2)); }
+  Vec2(const Vec2 &_o) { memcpy(this, &_o, sizeof(Vec2)); }
+  Vec2(float _x, float _y)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  void mutate_x(float _x) { flatbuffers::WriteScalar(&x_, _x); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  void mutate_y(float _y) { flatbuffers::WriteScalar(&y_, _y); }
+};
+STRUCT_END(Vec2, 8);
+
+struct Leaf FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_VALUE = 4
+  };
+  int32_t value() const { return GetField<int32_t>(VT_VALUE, 0); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_VALUE) &&
+           verifier.EndTable();
+  }
+};
+
+struct LeafT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Leaf> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Leaf *object);
+  inline LeafT& operator=(const Leaf *object) { UnPack(object); return *this;}
+  explicit LeafT(const Leaf *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<LeafT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<LeafT>()); }
+
+  int32_t value;
+  LeafT()
+    : value(0) {}
+
+};
+
+struct LeafBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_value(int32_t value) { fbb_.AddElement<int32_t>(Leaf::VT_VALUE, value, 0); }
+  LeafBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  LeafBuilder &operator=(const LeafBuilder &);
+  flatbuffers::Offset<Leaf> Finish() {
+    auto o = flatbuffers::Offset<Leaf>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Leaf> CreateLeaf(flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t value = 0) {
+  if (_fbb.ForcingDefaults() || (value != 0)) {
+    // All fields are present, so the layout is known.
+    static const flatbuffers::voffset_t offsets_[] = { 4 };
+    auto start_ = _fbb.StartTable();
+    auto table_ = _fbb.PushPrecomputedTable(8, 4);
+    flatbuffers::WriteScalar<int32_t>(table_ + 4, value);
+    return flatbuffers::Offset<Leaf>(_fbb.EndPrecomputedTable(start_, offsets_, 1));
+  }
+  LeafBuilder builder_(_fbb);
+  builder_.add_value(value);
+  return builder_.Finish();
+}
+
+struct Node FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NAME = 4,
+    VT_POS = 6,
+    VT_VALUES = 8,
+    VT_FLAGS = 10,
+    VT_TAGS = 12,
+    VT_POINTS = 14,
+    VT_CHILDREN = 16,
+    VT_FIRST = 18,
+    VT_PAYLOAD_TYPE = 20,
+    VT_PAYLOAD = 22
+  };
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  const Vec2 *pos() const { return GetStruct<const Vec2 *>(VT_POS); }
+  const flatbuffers::Vector<int32_t> *values() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_VALUES); }
+  const flatbuffers::Vector<uint8_t> *flags() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLAGS); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS); }
+  const flatbuffers::Vector<const Vec2 *> *points() const { return GetPointer<const flatbuffers::Vector<const Vec2 *> *>(VT_POINTS); }
+  const flatbuffers::Vector<flatbuffers::Offset<Node>> *children() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Node>> *>(VT_CHILDREN); }
+  const Node *first() const { return GetPointer<const Node *>(VT_FIRST); }
+  Payload payload_type() const { return static_cast<Payload>(GetField<uint8_t>(VT_PAYLOAD_TYPE, 0)); }
+  const void *payload() const { return GetPointer<const void *>(VT_PAYLOAD); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyField<Vec2>(verifier, VT_POS) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_VALUES) &&
+           verifier.Verify(values()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_FLAGS) &&
+           verifier.Verify(flags()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TAGS) &&
+           verifier.Verify(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_POINTS) &&
+           verifier.Verify(points()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_CHILDREN) &&
+           verifier.Verify(children()) &&
+           verifier.VerifyVectorOfTables(children()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_FIRST) &&
+           verifier.VerifyTable(first()) &&
+           VerifyField<uint8_t>(verifier, VT_PAYLOAD_TYPE) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_PAYLOAD) &&
+           VerifyPayload(verifier, payload(), payload_type()) &&
+           verifier.EndTable();
+  }
+};
+
+struct NodeT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Node> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Node *object);
+  inline NodeT& operator=(const Node *object) { UnPack(object); return *this;}
+  explicit NodeT(const Node *object) { UnPack(object); }
+
+  static void *operator new(size_t _size) { return flatbuffers::ArenaAllocate(_size, flatbuffers::AlignOf<NodeT>()); }
+  static void operator delete(void *_p) { flatbuffers::ArenaDeallocate(_p, flatbuffers::AlignOf<NodeT>()); }
+
+  flatbuffers::arena_string name;
+  flatbuffers::OptionalStruct<Vec2> pos;
+  std::vector<int32_t, flatbuffers::arena_allocator<int32_t>> values;
+  std::vector<bool, flatbuffers::arena_allocator<bool>> flags;
+  std::vector<flatbuffers::arena_string, flatbuffers::arena_allocator<flatbuffers::arena_string>> tags;
+  std::vector<Vec2, flatbuffers::arena_allocator<Vec2>> points;
+  std::vector<NodeT, flatbuffers::arena_allocator<NodeT>> children;
+  flatbuffers::OptionalTable<NodeT, Node, flatbuffers::arena_allocator<NodeT>> first;
+  PayloadUnion payload;
+  NodeT() {}
+
+};
+
+struct NodeBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Node::VT_NAME, name); }
+  void add_pos(const Vec2 *pos) { fbb_.AddStruct(Node::VT_POS, pos); }
+  void add_values(flatbuffers::Offset<flatbuffers::Vector<int32_t>> values) { fbb_.AddOffset(Node::VT_VALUES, values); }
+  void add_flags(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags) { fbb_.AddOffset(Node::VT_FLAGS, flags); }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) { fbb_.AddOffset(Node::VT_TAGS, tags); }
+  void add_points(flatbuffers::Offset<flatbuffers::Vector<const Vec2 *>> points) { fbb_.AddOffset(Node::VT_POINTS, points); }
+  void add_children(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Node>>> children) { fbb_.AddOffset(Node::VT_CHILDREN, children); }
+  void add_first(flatbuffers::Offset<Node> first) { fbb_.AddOffset(Node::VT_FIRST, first); }
+  void add_payload_type(Payload payload_type) { fbb_.AddElement<uint8_t>(Node::VT_PAYLOAD_TYPE, static_cast<uint8_t>(payload_type), 0); }
+  void add_payload(flatbuffers::Offset<void> payload) { fbb_.AddOffset(Node::VT_PAYLOAD, payload); }
+  NodeBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  NodeBuilder &operator=(const NodeBuilder &);
+  flatbuffers::Offset<Node> Finish() {
+    auto o = flatbuffers::Offset<Node>(fbb_.EndTable(start_, 10));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    const Vec2 *pos = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> values = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Vec2 *>> points = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Node>>> children = 0,
+    flatbuffers::Offset<Node> first = 0,
+    Payload payload_type = Payload_NONE,
+    flatbuffers::Offset<void> payload = 0) {
+  NodeBuilder builder_(_fbb);
+  builder_.add_payload(payload);
+  builder_.add_first(first);
+  builder_.add_children(children);
+  builder_.add_points(points);
+  builder_.add_tags(tags);
+  builder_.add_flags(flags);
+  builder_.add_values(values);
+  builder_.add_pos(pos);
+  builder_.add_name(name);
+  builder_.add_payload_type(payload_type);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Node> CreateNodeDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const Vec2 *pos = 0,
+    const std::vector<int32_t> *values = nullptr,
+    const std::vector<uint8_t> *flags = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr,
+    const std::vector<const Vec2 *> *points = nullptr,
+    const std::vector<flatbuffers::Offset<Node>> *children = nullptr,
+    flatbuffers::Offset<Node> first = 0,
+    Payload payload_type = Payload_NONE,
+    flatbuffers::Offset<void> payload = 0) {
+  return CreateNode(_fbb, name ? _fbb.CreateString(name) : 0, pos, values ? _fbb.CreateVector<int32_t>(*values) : 0, flags ? _fbb.CreateVector<uint8_t>(*flags) : 0, tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0, points ? _fbb.CreateVector<const Vec2 *>(*points) : 0, children ? _fbb.CreateVector<flatbuffers::Offset<Node>>(*children) : 0, first, payload_type, payload);
+}
+
+inline void LeafT::UnPack(const Leaf *_o) {
+  value = _o->value();
+}
+
+inline flatbuffers::Offset<Leaf> LeafT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateLeaf(_fbb,
+    value);
+}
+
+inline size_t LeafT::EstimatePackedSize() const {
+  size_t _size = 17;
+  return _size;
+}
+
+inline void NodeT::UnPack(const Node *_o) {
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
+  pos = _o->pos();
+  if (_o->values()) {
+    values.resize(_o->values()->size());
+    auto _e = values.begin();
+    for (auto it = _o->values()->begin(), __end = _o->values()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    values.clear();
+  }
+  if (_o->flags()) {
+    flags.resize(_o->flags()->size());
+    auto _e = flags.begin();
+    for (auto it = _o->flags()->begin(), __end = _o->flags()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it) != 0;
+  } else {
+    flags.clear();
+  }
+  if (_o->tags()) {
+    tags.resize(_o->tags()->size());
+    auto _e = tags.begin();
+    for (auto it = _o->tags()->begin(), __end = _o->tags()->end(); it != __end; ++it, ++_e)
+      (*_e).assign((*it)->c_str(), (*it)->size());
+  } else {
+    tags.clear();
+  }
+  if (_o->points()) {
+    points.clear();
+    for (auto it = _o->points()->begin(), __end = _o->points()->end(); it != __end; ++it)
+      points.push_back(*(*it));
+  } else {
+    points.clear();
+  }
+  if (_o->children()) {
+    children.resize(_o->children()->size());
+    auto _e = children.begin();
+    for (auto it = _o->children()->begin(), __end = _o->children()->end(); it != __end; ++it, ++_e)
+      (*_e).UnPack((*it));
+  } else {
+    children.clear();
+  }
+  first = _o->first();
+  payload.UnPack(_o->payload(), _o->payload_type());
+}
+
+inline flatbuffers::Offset<Node> NodeT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateNode(_fbb,
+    name.size() ? _fbb.CreateString(name) : 0,
+    pos.get(),
+    values.size() ? _fbb.CreateVector(values) : 0,
+    flags.size() ? _fbb.CreateVector(flags) : 0,
+    tags.size() ? _fbb.CreateVectorOfStrings(tags) : 0,
+    points.size() ? _fbb.CreateVectorOfStructs(points) : 0,
+    children.size() ? _fbb.CreateVector<flatbuffers::Offset<Node>>(children.size(), [&](size_t i) { return children[i].Pack(_fbb); }) : 0,
+    first ? first->Pack(_fbb) : 0,
+    payload.type,
+    payload.Pack(_fbb));
+}
+
+inline size_t NodeT::EstimatePackedSize() const {
+  size_t _size = 75;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (values.size()) {
+    _size += flatbuffers::EstimateVectorSize(values.size(), 4);
+  }
+  if (flags.size()) {
+    _size += flatbuffers::EstimateVectorSize(flags.size(), 1);
+  }
+  if (tags.size()) {
+    _size += flatbuffers::EstimateVectorSize(tags.size(), 4);
+    for (auto it = tags.begin(); it != tags.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  if (points.size()) {
+    _size += flatbuffers::EstimateVectorSize(points.size(), 8);
+  }
+  if (children.size()) {
+    _size += flatbuffers::EstimateVectorSize(children.size(), 4);
+    for (auto it = children.begin(); it != children.end(); ++it)
+      _size += it->EstimatePackedSize();
+  }
+  if (first) _size += first->EstimatePackedSize();
+  _size += payload.EstimatePackedSize();
+  return _size;
+}
+
+inline bool VerifyPayload(flatbuffers::Verifier &verifier, const void *union_obj, Payload type) {
+  switch (type) {
+    case Payload_NONE: return true;
+    case Payload_Leaf: return verifier.VerifyTable(reinterpret_cast<const Leaf *>(union_obj));
+    default: return false;
+  }
+}
+
+inline void PayloadUnion::UnPack(const void *union_obj, Payload _t) {
+  if (union_obj && _t == type) {
+    switch (_t) {
+      case Payload_Leaf: static_cast<LeafT *>(table)->UnPack(reinterpret_cast<const Leaf *>(union_obj)); return;
+      default: break;
+    }
+  }
+  Reset();
+  type = _t;
+  if (!union_obj) { table = nullptr; type = Payload_NONE; return; }
+  switch (_t) {
+    case Payload_NONE: table = nullptr; break;
+    case Payload_Leaf: table = new LeafT(reinterpret_cast<const Leaf *>(union_obj)); break;
+    default: table = nullptr; type = Payload_NONE;
+  }
+}
+
+inline flatbuffers::Offset<void> PayloadUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  switch (type) {
+    case Payload_NONE: return 0;
+    case Payload_Leaf: return static_cast<const LeafT *>(table)->Pack(_fbb).Union();
+    default: return 0;
+  }
+}
+
+inline size_t PayloadUnion::EstimatePackedSize() const {
+  switch (type) {
+    case Payload_Leaf: return static_cast<const LeafT *>(table)->EstimatePackedSize();
+    default: return 0;
+  }
+}
+
+inline PayloadUnion::PayloadUnion(const PayloadUnion &other) : type(Payload_NONE), table(nullptr) { *this = other; }
+inline PayloadUnion& PayloadUnion::operator=(const PayloadUnion &other) {
+  Reset();
+  type = other.type;
+  switch (other.type) {
+    case Payload_Leaf: table = new LeafT(*(static_cast<LeafT *>(other.table))); break;
+    default:
+      type = Payload_NONE;
+      table = nullptr;
+      break;
+  }
+  return *this;
+}
+
+inline PayloadUnion::~PayloadUnion() { Reset(); }
+
+inline void PayloadUnion::Reset() {
+  switch (type) {
+    case Payload_Leaf: delete static_cast<LeafT *>(table); break;
+    default: assert(!table); break;
+  }
+  table = nullptr;
+  type = Payload_NONE;
+}
+
+inline PayloadUnion& PayloadUnion::operator=(const LeafT &_o) {
+  Reset();
+  type = Payload_Leaf;
+  table = new LeafT(_o);
+  return *this;
+}
+
+inline const ArenaTest::Node *GetNode(const void *buf) { return flatbuffers::GetRoot<ArenaTest::Node>(buf); }
+
+inline const ArenaTest::Node *GetSizePrefixedNode(const void *buf) { return flatbuffers::GetSizePrefixedRoot<ArenaTest::Node>(buf); }
+
+inline bool VerifyNodeBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<ArenaTest::Node>(nullptr); }
+
+inline bool VerifySizePrefixedNodeBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<ArenaTest::Node>(nullptr); }
+
+inline void FinishNodeBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<ArenaTest::Node> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedNodeBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<ArenaTest::Node> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace ArenaTest
+
+#endif  // FLATBUFFERS_GENERATED_ARENATEST_ARENATEST_H_
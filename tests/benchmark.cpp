@@ -0,0 +1,354 @@
+/*
+ * Copyright 2016 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Micro benchmarks of the C++ runtime. These are not run as part of the
+// tests, run them by hand from the build directory:
+//
+//   ./flatbenchmark [scale]
+//
+// The flatbenchmark_scalar binary is the same, built with FLATBUFFERS_NO_SIMD,
+// so the two can be compared. So is flatbenchmark_arena, built with
+// FLATBUFFERS_BENCHMARK_ARENA, which uses object API types generated with
+// --object-api-arena.
+
+#include <chrono>
+#include <cstdio>
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/util.h"
+#include "flatbuffers/work_stealing_pool.h"
+
+#ifdef FLATBUFFERS_BENCHMARK_ARENA
+  #include "arena/monster_test_generated.h"
+#else
+  #include "monster_test_generated.h"
+#endif
+#include "key_index_test_generated.h"
+#include "fixed_layout_test_generated.h"
+
+using namespace MyGame::Example;
+
+// Runs f until at least a second has passed, and returns the average time of
+// a run in seconds.
+template<typename F> double TimeIt(F f) {
+  auto start = std::chrono::steady_clock::now();
+  size_t runs = 0;
+  double elapsed;
+  do {
+    f();
+    runs++;
+    elapsed = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+  } while (elapsed < 1.0);
+  return elapsed / runs;
+}
+
+void Report(const char *name, size_t bytes, double seconds) {
+  printf("%-32s %10.3f ms %10.1f MB/s\n", name, seconds * 1000,
+         bytes / seconds / (1024 * 1024));
+}
+
+// tests/monsterdata_test.mon scaled up: a root monster with `scale` copies of
+// it, each also holding a few dozen extra strings.
+void ScaledMonster(const std::string &mon, int scale, MonsterT *root_ptr) {
+  typedef decltype(MonsterT::name) NativeString;
+  auto &root = *root_ptr;
+  root.name = "ScaledMonster";
+  for (int i = 0; i < scale; i++) {
+    MonsterT copy(GetMonster(mon.data()));
+    copy.name += flatbuffers::NumToString(i).c_str();
+    for (int j = 0; j < 48; j++) {
+      NativeString str(static_cast<size_t>(j), 'a' + j % 26);
+      str += "caf\xC3\xA9";
+      copy.testarrayofstring.push_back(str);
+    }
+    root.testarrayoftables.push_back(std::move(copy));
+  }
+}
+
+// Packs the scaled monster into a builder that grows as needed, against one
+// that reserves the estimated size up front.
+void PackBenchmark(const MonsterT &root, size_t size) {
+  Report("Pack", size, TimeIt([&]() {
+    flatbuffers::FlatBufferBuilder fbb;
+    FinishMonsterBuffer(fbb, root.Pack(fbb));
+  }));
+  Report("Pack (Reserve)", size, TimeIt([&]() {
+    flatbuffers::FlatBufferBuilder fbb;
+    fbb.Reserve(root.EstimatePackedSize());
+    FinishMonsterBuffer(fbb, root.Pack(fbb));
+  }));
+}
+
+// Unpacks the scaled monster, on the heap, and for flatbenchmark_arena also
+// from an arena, which is reset instead of destroying the objects.
+void UnPackBenchmark(const flatbuffers::FlatBufferBuilder &fbb) {
+  auto monster = GetMonster(fbb.GetBufferPointer());
+  Report("UnPack", fbb.GetSize(), TimeIt([&]() {
+    MonsterT root(monster);
+  }));
+  MonsterT reused(monster);
+  Report("UnPack (reuse)", fbb.GetSize(), TimeIt([&]() {
+    reused.UnPack(monster);
+  }));
+  #ifdef FLATBUFFERS_BENCHMARK_ARENA
+    flatbuffers::Arena arena;
+    Report("UnPack (Arena)", fbb.GetSize(), TimeIt([&]() {
+      {
+        flatbuffers::ArenaScope scope(&arena);
+        new MonsterT(monster);
+      }
+      arena.Reset();
+    }));
+  #endif
+}
+
+// Forwards the scaled monster with its name changed, unpacking all of it
+// against unpacking it lazily, which copies the rest as is.
+void ForwardBenchmark(const flatbuffers::FlatBufferBuilder &fbb) {
+  auto monster = GetMonster(fbb.GetBufferPointer());
+  Report("UnPack, edit, Pack", fbb.GetSize(), TimeIt([&]() {
+    MonsterT root(monster);
+    root.name = "Forwarded";
+    flatbuffers::FlatBufferBuilder out;
+    FinishMonsterBuffer(out, root.Pack(out));
+  }));
+  Report("UnPack, edit, Pack (lazy)", fbb.GetSize(), TimeIt([&]() {
+    MonsterLazyT root(monster);
+    root.name() = "Forwarded";
+    flatbuffers::FlatBufferBuilder out;
+    FinishMonsterBuffer(out, root.Pack(out));
+  }));
+}
+
+void VerifierBenchmark(const flatbuffers::FlatBufferBuilder &fbb) {
+  auto buf = fbb.GetBufferPointer();
+  auto size = fbb.GetSize();
+  bool ok = true;
+  Report("Verifier", size, TimeIt([&]() {
+    flatbuffers::Verifier verifier(buf, size);
+    ok &= VerifyMonsterBuffer(verifier);
+  }));
+  Report("Verifier (UTF-8)", size, TimeIt([&]() {
+    flatbuffers::Verifier verifier(buf, size, 64, 1000000, true);
+    ok &= VerifyMonsterBuffer(verifier);
+  }));
+  flatbuffers::WorkStealingPool pool;
+  char name[64];
+  snprintf(name, sizeof(name), "Verifier (%u threads)",
+           static_cast<unsigned>(pool.Concurrency()));
+  Report(name, size, TimeIt([&]() {
+    flatbuffers::Verifier verifier(buf, size);
+    verifier.SetTaskRunner(&pool);
+    ok &= VerifyMonsterBuffer(verifier);
+  }));
+  if (!ok) printf("verification failed!\n");
+}
+
+// How LookupByKey used to work, for comparison.
+template<typename T, typename K> const T *BsearchLookup(
+    const flatbuffers::Vector<flatbuffers::Offset<T>> *vec, K key) {
+  auto result = bsearch(&key, vec->Data(), vec->size(),
+                        sizeof(flatbuffers::uoffset_t),
+                        [](const void *a, const void *b) {
+    auto table = flatbuffers::IndirectHelper<flatbuffers::Offset<T>>::Read(
+                   reinterpret_cast<const uint8_t *>(b), 0);
+    return -table->KeyCompareWithValue(*reinterpret_cast<const K *>(a));
+  });
+  return result ? flatbuffers::IndirectHelper<flatbuffers::Offset<T>>::Read(
+                    reinterpret_cast<const uint8_t *>(result), 0)
+                : nullptr;
+}
+
+void LookupBenchmark(size_t num_entries) {
+  using namespace KeyIndexTest;
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Entry>> entries;
+  for (size_t i = 0; i < num_entries; i++) {
+    entries.push_back(CreateEntry(fbb, i * 7));
+  }
+  auto vec = fbb.CreateVectorOfSortedTables(&entries);
+  auto index = fbb.CreateKeyIndex(entries);
+  fbb.Finish(CreateCatalog(fbb, vec, index));
+  auto catalog = flatbuffers::GetRoot<Catalog>(fbb.GetBufferPointer());
+
+  const size_t kLookups = 100000;
+  std::vector<uint64_t> keys;
+  uint64_t lcg = 1;
+  for (size_t i = 0; i < kLookups; i++) {
+    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+    keys.push_back((lcg >> 33) % (num_entries * 7));  // 1 in 7 is a hit.
+  }
+  size_t found = 0;
+  auto report = [&](const char *name, double seconds) {
+    printf("%-32s %10.1f ns/lookup\n", name, seconds * 1e9 / kLookups);
+  };
+  printf("%u entries:\n", static_cast<unsigned>(num_entries));
+  report("  std::bsearch", TimeIt([&]() {
+    for (auto it = keys.begin(); it != keys.end(); ++it)
+      found += BsearchLookup(catalog->entries(), *it) != nullptr;
+  }));
+  report("  LookupByKey", TimeIt([&]() {
+    for (auto it = keys.begin(); it != keys.end(); ++it)
+      found += catalog->entries()->LookupByKey(*it) != nullptr;
+  }));
+  report("  LookupByKeyIndex", TimeIt([&]() {
+    for (auto it = keys.begin(); it != keys.end(); ++it)
+      found += catalog->entries()->LookupByKeyIndex(catalog->entries_index(),
+                                                    *it) != nullptr;
+  }));
+  if (!found) printf("nothing found!\n");
+}
+
+// Builds tables of only scalars and structs, which CreateSprite writes in one
+// go, against doing the same with SpriteBuilder, as CreateSprite used to.
+void CreateTableBenchmark() {
+  namespace fl = FixedLayoutTest;
+  const int kTables = 100000;
+  flatbuffers::FlatBufferBuilder fbb(kTables * 128);
+  fl::Vec3 pos(1, 2, 3);
+  fl::Ability ability(7, 9);
+  auto report = [&](const char *name, double seconds) {
+    printf("%-32s %10.1f ns/table %10.1f MB/s\n", name,
+           seconds * 1e9 / kTables, fbb.GetSize() / seconds / (1024 * 1024));
+  };
+  printf("%d Sprite tables:\n", kTables);
+  report("  SpriteBuilder", TimeIt([&]() {
+    fbb.Clear();
+    for (int i = 0; i < kTables; i++) {
+      fl::SpriteBuilder sb(fbb);
+      sb.add_testhashu64_fnv1(4);
+      sb.add_testhashs64_fnv1(-3);
+      sb.add_id(i + 1);
+      sb.add_ability(&ability);
+      sb.add_testf2(6.5f);
+      sb.add_testf(5.5f);
+      sb.add_testhashu32_fnv1(2);
+      sb.add_testhashs32_fnv1(-1);
+      sb.add_pos(&pos);
+      sb.add_hp(80);
+      sb.add_mana(200);
+      sb.add_testbool(true);
+      sb.add_color(fl::Color_Red);
+      sb.Finish();
+    }
+  }));
+  report("  CreateSprite", TimeIt([&]() {
+    fbb.Clear();
+    for (int i = 0; i < kTables; i++) {
+      fl::CreateSprite(fbb, &pos, 200, 80, fl::Color_Red, i + 1, -1, 2, -3, 4,
+                       5.5f, 6.5f, true, &ability);
+    }
+  }));
+}
+
+// How CreateVectorOfSortedTables used to sort, for comparison.
+template<typename T> void ComparatorSort(flatbuffers::FlatBufferBuilder &fbb,
+                                         std::vector<flatbuffers::Offset<T>> *v) {
+  auto end = fbb.GetCurrentBufferPointer() + fbb.GetSize();
+  std::sort(v->begin(), v->end(),
+            [&](flatbuffers::Offset<T> a, flatbuffers::Offset<T> b) {
+    return reinterpret_cast<const T *>(end - a.o)->KeyCompareLessThan(
+             reinterpret_cast<const T *>(end - b.o));
+  });
+}
+
+template<typename T> void SortBenchmark(
+    const char *name, flatbuffers::FlatBufferBuilder &fbb,
+    const std::vector<flatbuffers::Offset<T>> &tables) {
+  std::vector<flatbuffers::Offset<T>> v;
+  auto report = [&](const char *how, double seconds) {
+    printf("  %-30s %10.1f ms\n", how, seconds * 1000);
+  };
+  printf("%u tables with %s keys:\n", static_cast<unsigned>(tables.size()),
+         name);
+  report("std::sort", TimeIt([&]() {
+    v = tables;
+    ComparatorSort(fbb, &v);
+  }));
+  fbb.SetTaskRunner(nullptr);
+  report("CreateVectorOfSortedTables", TimeIt([&]() {
+    v = tables;
+    fbb.CreateVectorOfSortedTables(&v);
+  }));
+  flatbuffers::WorkStealingPool pool;
+  fbb.SetTaskRunner(&pool);
+  char how[64];
+  snprintf(how, sizeof(how), "  (%u threads)",
+           static_cast<unsigned>(pool.Concurrency()));
+  report(how, TimeIt([&]() {
+    v = tables;
+    fbb.CreateVectorOfSortedTables(&v);
+  }));
+  fbb.SetTaskRunner(nullptr);
+}
+
+void SortBenchmarks(size_t num_tables) {
+  uint64_t lcg = 1;
+  auto rand = [&]() {
+    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+    return lcg >> 11;
+  };
+  {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<KeyIndexTest::Entry>> entries;
+    for (size_t i = 0; i < num_tables; i++) {
+      entries.push_back(KeyIndexTest::CreateEntry(fbb, rand()));
+    }
+    SortBenchmark("ulong", fbb, entries);
+  }
+  {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    for (size_t i = 0; i < num_tables; i++) {
+      auto name = "monster" + flatbuffers::NumToString(rand() % num_tables);
+      monsters.push_back(CreateMonster(fbb, nullptr, 0, 0,
+                                       fbb.CreateString(name)));
+    }
+    SortBenchmark("string", fbb, monsters);
+  }
+}
+
+int main(int argc, const char *argv[]) {
+  int scale = argc > 1 ? atoi(argv[1]) : 10000;
+  std::string mon;
+  if (!flatbuffers::LoadFile("tests/monsterdata_test.mon", true, &mon)) {
+    printf("run from the build directory, which has a copy of tests/\n");
+    return 1;
+  }
+  #if defined(FLATBUFFERS_AVX2)
+    printf("SIMD: AVX2\n");
+  #elif defined(FLATBUFFERS_SSE2)
+    printf("SIMD: SSE2\n");
+  #else
+    printf("SIMD: none\n");
+  #endif
+
+  MonsterT root;
+  ScaledMonster(mon, scale, &root);
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishMonsterBuffer(fbb, root.Pack(fbb));
+  printf("monsterdata_test.mon x %d: %u bytes\n", scale, fbb.GetSize());
+  VerifierBenchmark(fbb);
+  PackBenchmark(root, fbb.GetSize());
+  UnPackBenchmark(fbb);
+  ForwardBenchmark(fbb);
+  LookupBenchmark(1000);
+  LookupBenchmark(1000000);
+  SortBenchmarks(1000000);
+  CreateTableBenchmark();
+  return 0;
+}
@@ -0,0 +1,266 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_FIXEDLAYOUTTEST_FIXEDLAYOUTTEST_H_
+#define FLATBUFFERS_GENERATED_FIXEDLAYOUTTEST_FIXEDLAYOUTTEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace FixedLayoutTest {
+
+struct Vec3;
+
+struct Ability;
+
+struct Sprite;
+
+struct Quat;
+
+struct Pose;
+
+enum Color {
+  Color_Red = 1,
+  Color_Green = 2,
+  Color_Blue = 3,
+  Color_MIN = Color_Red,
+  Color_MAX = Color_Blue
+};
+
+inline const char **EnumNamesColor() {
+  static const char *names[] = { "Red", "Green", "Blue", nullptr };
+  return names;
+}
+
+inline const char *EnumNameColor(Color e) { return EnumNamesColor()[static_cast<int>(e) - static_cast<int>(Color_Red)]; }
+
+MANUALLY_ALIGNED_STRUCT(4) Vec3 FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  Vec3() { memset(this, 0, sizeof(Vec3)); }
+  Vec3(const Vec3 &_o) { memcpy(this, &_o, sizeof(Vec3)); }
+  Vec3(float _x, float _y, float _z)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)), z_(flatbuffers::EndianScalar(_z)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  float z() const { return flatbuffers::EndianScalar(z_); }
+};
+STRUCT_END(Vec3, 12);
+
+MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t id_;
+  uint8_t distance_;
+  int8_t __padding0;
+  int16_t __padding1;
+
+ public:
+  Ability() { memset(this, 0, sizeof(Ability)); }
+  Ability(const Ability &_o) { memcpy(this, &_o, sizeof(Ability)); }
+  Ability(uint32_t _id, uint8_t _distance)
+    : id_(flatbuffers::EndianScalar(_id)), distance_(flatbuffers::EndianScalar(_distance)), __padding0(0), __padding1(0) { (void)__padding0; (void)__padding1; }
+
+  uint32_t id() const { return flatbuffers::EndianScalar(id_); }
+  uint8_t distance() const { return flatbuffers::EndianScalar(distance_); }
+};
+STRUCT_END(Ability, 8);
+
+MANUALLY_ALIGNED_STRUCT(16) Quat FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+  float w_;
+
+ public:
+  Quat() { memset(this, 0, sizeof(Quat)); }
+  Quat(const Quat &_o) { memcpy(this, &_o, sizeof(Quat)); }
+  Quat(float _x, float _y, float _z, float _w)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)), z_(flatbuffers::EndianScalar(_z)), w_(flatbuffers::EndianScalar(_w)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  float z() const { return flatbuffers::EndianScalar(z_); }
+  float w() const { return flatbuffers::EndianScalar(w_); }
+};
+STRUCT_END(Quat, 16);
+
+struct Sprite FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_POS = 4,
+    VT_MANA = 6,
+    VT_HP = 8,
+    VT_COLOR = 12,
+    VT_ID = 14,
+    VT_TESTHASHS32_FNV1 = 16,
+    VT_TESTHASHU32_FNV1 = 18,
+    VT_TESTHASHS64_FNV1 = 20,
+    VT_TESTHASHU64_FNV1 = 22,
+    VT_TESTF = 24,
+    VT_TESTF2 = 26,
+    VT_TESTBOOL = 28,
+    VT_ABILITY = 30
+  };
+  const Vec3 *pos() const { return GetStruct<const Vec3 *>(VT_POS); }
+  int16_t mana() const { return GetField<int16_t>(VT_MANA, 150); }
+  int16_t hp() const { return GetField<int16_t>(VT_HP, 100); }
+  Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 3)); }
+  uint64_t id() const { return GetField<uint64_t>(VT_ID, 0); }
+  int32_t testhashs32_fnv1() const { return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0); }
+  uint32_t testhashu32_fnv1() const { return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0); }
+  int64_t testhashs64_fnv1() const { return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0); }
+  uint64_t testhashu64_fnv1() const { return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0); }
+  float testf() const { return GetField<float>(VT_TESTF, 3.14159f); }
+  float testf2() const { return GetField<float>(VT_TESTF2, 3.0f); }
+  bool testbool() const { return GetField<uint8_t>(VT_TESTBOOL, 0) != 0; }
+  const Ability *ability() const { return GetStruct<const Ability *>(VT_ABILITY); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<Vec3>(verifier, VT_POS) &&
+           VerifyField<int16_t>(verifier, VT_MANA) &&
+           VerifyField<int16_t>(verifier, VT_HP) &&
+           VerifyField<int8_t>(verifier, VT_COLOR) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           VerifyField<int32_t>(verifier, VT_TESTHASHS32_FNV1) &&
+           VerifyField<uint32_t>(verifier, VT_TESTHASHU32_FNV1) &&
+           VerifyField<int64_t>(verifier, VT_TESTHASHS64_FNV1) &&
+           VerifyField<uint64_t>(verifier, VT_TESTHASHU64_FNV1) &&
+           VerifyField<float>(verifier, VT_TESTF) &&
+           VerifyField<float>(verifier, VT_TESTF2) &&
+           VerifyField<uint8_t>(verifier, VT_TESTBOOL) &&
+           VerifyField<Ability>(verifier, VT_ABILITY) &&
+           verifier.EndTable();
+  }
+};
+
+struct SpriteBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_pos(const Vec3 *pos) { fbb_.AddStruct(Sprite::VT_POS, pos); }
+  void add_mana(int16_t mana) { fbb_.AddElement<int16_t>(Sprite::VT_MANA, mana, 150); }
+  void add_hp(int16_t hp) { fbb_.AddElement<int16_t>(Sprite::VT_HP, hp, 100); }
+  void add_color(Color color) { fbb_.AddElement<int8_t>(Sprite::VT_COLOR, static_cast<int8_t>(color), 3); }
+  void add_id(uint64_t id) { fbb_.AddElement<uint64_t>(Sprite::VT_ID, id, 0); }
+  void add_testhashs32_fnv1(int32_t testhashs32_fnv1) { fbb_.AddElement<int32_t>(Sprite::VT_TESTHASHS32_FNV1, testhashs32_fnv1, 0); }
+  void add_testhashu32_fnv1(uint32_t testhashu32_fnv1) { fbb_.AddElement<uint32_t>(Sprite::VT_TESTHASHU32_FNV1, testhashu32_fnv1, 0); }
+  void add_testhashs64_fnv1(int64_t testhashs64_fnv1) { fbb_.AddElement<int64_t>(Sprite::VT_TESTHASHS64_FNV1, testhashs64_fnv1, 0); }
+  void add_testhashu64_fnv1(uint64_t testhashu64_fnv1) { fbb_.AddElement<uint64_t>(Sprite::VT_TESTHASHU64_FNV1, testhashu64_fnv1, 0); }
+  void add_testf(float testf) { fbb_.AddElement<float>(Sprite::VT_TESTF, testf, 3.14159f); }
+  void add_testf2(float testf2) { fbb_.AddElement<float>(Sprite::VT_TESTF2, testf2, 3.0f); }
+  void add_testbool(bool testbool) { fbb_.AddElement<uint8_t>(Sprite::VT_TESTBOOL, static_cast<uint8_t>(testbool), 0); }
+  void add_ability(const Ability *ability) { fbb_.AddStruct(Sprite::VT_ABILITY, ability); }
+  SpriteBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  SpriteBuilder &operator=(const SpriteBuilder &);
+  flatbuffers::Offset<Sprite> Finish() {
+    auto o = flatbuffers::Offset<Sprite>(fbb_.EndTable(start_, 14));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Sprite> CreateSprite(flatbuffers::FlatBufferBuilder &_fbb,
+    const Vec3 *pos = 0,
+    int16_t mana = 150,
+    int16_t hp = 100,
+    Color color = Color_Blue,
+    uint64_t id = 0,
+    int32_t testhashs32_fnv1 = 0,
+    uint32_t testhashu32_fnv1 = 0,
+    int64_t testhashs64_fnv1 = 0,
+    uint64_t testhashu64_fnv1 = 0,
+    float testf = 3.14159f,
+    float testf2 = 3.0f,
+    bool testbool = false,
+    const Ability *ability = 0) {
+  if (ability && pos &&
+      (_fbb.ForcingDefaults() || (testhashu64_fnv1 != 0 && testhashs64_fnv1 != 0 && id != 0 && testf2 != 3.0f && testf != 3.14159f && testhashu32_fnv1 != 0 && testhashs32_fnv1 != 0 && hp != 100 && mana != 150 && static_cast<uint8_t>(testbool) != 0 && static_cast<int8_t>(color) != 3))) {
+    // All fields are present, so the layout is known.
+    static const flatbuffers::voffset_t offsets_[] = { 12, 8, 10, 0, 6, 48, 24, 28, 56, 64, 32, 36, 7, 40 };
+    auto start_ = _fbb.StartTable();
+    auto table_ = _fbb.PushPrecomputedTable(72, 8);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 64, testhashu64_fnv1);
+    flatbuffers::WriteScalar<int64_t>(table_ + 56, testhashs64_fnv1);
+    flatbuffers::WriteScalar<uint64_t>(table_ + 48, id);
+    memcpy(table_ + 40, ability, sizeof(Ability));
+    flatbuffers::WriteScalar<float>(table_ + 36, testf2);
+    flatbuffers::WriteScalar<float>(table_ + 32, testf);
+    flatbuffers::WriteScalar<uint32_t>(table_ + 28, testhashu32_fnv1);
+    flatbuffers::WriteScalar<int32_t>(table_ + 24, testhashs32_fnv1);
+    memcpy(table_ + 12, pos, sizeof(Vec3));
+    flatbuffers::WriteScalar<int16_t>(table_ + 10, hp);
+    flatbuffers::WriteScalar<int16_t>(table_ + 8, mana);
+    flatbuffers::WriteScalar<uint8_t>(table_ + 7, static_cast<uint8_t>(testbool));
+    flatbuffers::WriteScalar<int8_t>(table_ + 6, static_cast<int8_t>(color));
+    return flatbuffers::Offset<Sprite>(_fbb.EndPrecomputedTable(start_, offsets_, 14));
+  }
+  SpriteBuilder builder_(_fbb);
+  builder_.add_testhashu64_fnv1(testhashu64_fnv1);
+  builder_.add_testhashs64_fnv1(testhashs64_fnv1);
+  builder_.add_id(id);
+  builder_.add_ability(ability);
+  builder_.add_testf2(testf2);
+  builder_.add_testf(testf);
+  builder_.add_testhashu32_fnv1(testhashu32_fnv1);
+  builder_.add_testhashs32_fnv1(testhashs32_fnv1);
+  builder_.add_pos(pos);
+  builder_.add_hp(hp);
+  builder_.add_mana(mana);
+  builder_.add_testbool(testbool);
+  builder_.add_color(color);
+  return builder_.Finish();
+}
+
+struct Pose FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_TIME = 4,
+    VT_ROTATION = 6
+  };
+  uint64_t time() const { return GetField<uint64_t>(VT_TIME, 0); }
+  const Quat *rotation() const { return GetStruct<const Quat *>(VT_ROTATION); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_TIME) &&
+           VerifyField<Quat>(verifier, VT_ROTATION) &&
+           verifier.EndTable();
+  }
+};
+
+struct PoseBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_time(uint64_t time) { fbb_.AddElement<uint64_t>(Pose::VT_TIME, time, 0); }
+  void add_rotation(const Quat *rotation) { fbb_.AddStruct(Pose::VT_ROTATION, rotation); }
+  PoseBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  PoseBuilder &operator=(const PoseBuilder &);
+  flatbuffers::Offset<Pose> Finish() {
+    auto o = flatbuffers::Offset<Pose>(fbb_.EndTable(start_, 2));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Pose> CreatePose(flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t time = 0,
+    const Quat *rotation = 0) {
+  PoseBuilder builder_(_fbb);
+  builder_.add_time(time);
+  builder_.add_rotation(rotation);
+  return builder_.Finish();
+}
+
+inline const FixedLayoutTest::Sprite *GetSprite(const void *buf) { return flatbuffers::GetRoot<FixedLayoutTest::Sprite>(buf); }
+
+inline const FixedLayoutTest::Sprite *GetSizePrefixedSprite(const void *buf) { return flatbuffers::GetSizePrefixedRoot<FixedLayoutTest::Sprite>(buf); }
+
+inline bool VerifySpriteBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<FixedLayoutTest::Sprite>(nullptr); }
+
+inline bool VerifySizePrefixedSpriteBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<FixedLayoutTest::Sprite>(nullptr); }
+
+inline void FinishSpriteBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<FixedLayoutTest::Sprite> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedSpriteBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<FixedLayoutTest::Sprite> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace FixedLayoutTest
+
+#endif  // FLATBUFFERS_GENERATED_FIXEDLAYOUTTEST_FIXEDLAYOUTTEST_H_
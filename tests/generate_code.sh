@@ -14,9 +14,14 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-../flatc --cpp --java --csharp --go --binary --python --js --php --grpc --gen-mutable --gen-object-api --no-includes monster_test.fbs monsterdata_test.json
+../flatc --cpp --java --csharp --go --binary --python --js --php --grpc --gen-mutable --gen-object-api --object-api-lazy --no-includes monster_test.fbs monsterdata_test.json
 ../flatc --cpp --java --csharp --go --binary --python --js --php --gen-mutable -o namespace_test namespace_test/namespace_test1.fbs namespace_test/namespace_test2.fbs
 ../flatc --binary --schema monster_test.fbs
+../flatc --cpp key_index_test.fbs fixed_layout_test.fbs
+../flatc --cpp --gen-object-api --object-api-lazy offset64_test.fbs
+../flatc --cpp --gen-object-api --object-api-arena arena_test.fbs
+../flatc --cpp --gen-object-api --cpp-framework qt5 qt5_test.fbs
+../flatc --cpp --gen-mutable --gen-object-api --object-api-arena --object-api-lazy --no-includes -o arena monster_test.fbs
 cd ../samples
 ../flatc --cpp --gen-mutable --gen-object-api monster.fbs
 cd ../reflection
@@ -0,0 +1,246 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_KEYINDEXTEST_KEYINDEXTEST_H_
+#define FLATBUFFERS_GENERATED_KEYINDEXTEST_KEYINDEXTEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace KeyIndexTest {
+
+struct Entry;
+
+struct Event;
+
+struct Change;
+
+struct Reading;
+
+struct Catalog;
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ID = 4,
+    VT_VALUE = 6
+  };
+  uint64_t id() const { return GetField<uint64_t>(VT_ID, 0); }
+  bool KeyCompareLessThan(const Entry *o) const { return id() < o->id(); }
+  int KeyCompareWithValue(uint64_t val) const { return id() < val ? -1 : id() > val; }
+  typedef uint64_t KeyType;
+  KeyType GetKey() const { return GetField<KeyType>(VT_ID, 0); }
+  const flatbuffers::String *value() const { return GetPointer<const flatbuffers::String *>(VT_VALUE); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_ID) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_VALUE) &&
+           verifier.Verify(value()) &&
+           verifier.EndTable();
+  }
+};
+
+struct EntryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(uint64_t id) { fbb_.AddElement<uint64_t>(Entry::VT_ID, id, 0); }
+  void add_value(flatbuffers::Offset<flatbuffers::String> value) { fbb_.AddOffset(Entry::VT_VALUE, value); }
+  EntryBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  EntryBuilder &operator=(const EntryBuilder &);
+  flatbuffers::Offset<Entry> Finish() {
+    auto o = flatbuffers::Offset<Entry>(fbb_.EndTable(start_, 2));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t id = 0,
+    flatbuffers::Offset<flatbuffers::String> value = 0) {
+  EntryBuilder builder_(_fbb);
+  builder_.add_id(id);
+  builder_.add_value(value);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Entry> CreateEntryDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t id = 0,
+    const char *value = nullptr) {
+  return CreateEntry(_fbb, id, value ? _fbb.CreateString(value) : 0);
+}
+
+struct Event FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_AT = 4
+  };
+  int64_t at() const { return GetField<int64_t>(VT_AT, 0); }
+  bool KeyCompareLessThan(const Event *o) const { return at() < o->at(); }
+  int KeyCompareWithValue(int64_t val) const { return at() < val ? -1 : at() > val; }
+  int64_t GetKey() const { return GetField<int64_t>(VT_AT, 0); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int64_t>(verifier, VT_AT) &&
+           verifier.EndTable();
+  }
+};
+
+struct EventBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_at(int64_t at) { fbb_.AddElement<int64_t>(Event::VT_AT, at, 0); }
+  EventBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  EventBuilder &operator=(const EventBuilder &);
+  flatbuffers::Offset<Event> Finish() {
+    auto o = flatbuffers::Offset<Event>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Event> CreateEvent(flatbuffers::FlatBufferBuilder &_fbb,
+    int64_t at = 0) {
+  if (_fbb.ForcingDefaults() || (at != 0)) {
+    // All fields are present, so the layout is known.
+    static const flatbuffers::voffset_t offsets_[] = { 4 };
+    auto start_ = _fbb.StartTable();
+    auto table_ = _fbb.PushPrecomputedTable(12, 8);
+    flatbuffers::WriteScalar<int64_t>(table_ + 4, at);
+    return flatbuffers::Offset<Event>(_fbb.EndPrecomputedTable(start_, offsets_, 1));
+  }
+  EventBuilder builder_(_fbb);
+  builder_.add_at(at);
+  return builder_.Finish();
+}
+
+struct Change FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_DELTA = 4
+  };
+  int16_t delta() const { return GetField<int16_t>(VT_DELTA, 0); }
+  bool KeyCompareLessThan(const Change *o) const { return delta() < o->delta(); }
+  int KeyCompareWithValue(int16_t val) const { return delta() < val ? -1 : delta() > val; }
+  int16_t GetKey() const { return GetField<int16_t>(VT_DELTA, 0); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int16_t>(verifier, VT_DELTA) &&
+           verifier.EndTable();
+  }
+};
+
+struct ChangeBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_delta(int16_t delta) { fbb_.AddElement<int16_t>(Change::VT_DELTA, delta, 0); }
+  ChangeBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  ChangeBuilder &operator=(const ChangeBuilder &);
+  flatbuffers::Offset<Change> Finish() {
+    auto o = flatbuffers::Offset<Change>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Change> CreateChange(flatbuffers::FlatBufferBuilder &_fbb,
+    int16_t delta = 0) {
+  ChangeBuilder builder_(_fbb);
+  builder_.add_delta(delta);
+  return builder_.Finish();
+}
+
+struct Reading FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_VALUE = 4
+  };
+  double value() const { return GetField<double>(VT_VALUE, 0.0); }
+  bool KeyCompareLessThan(const Reading *o) const { return value() < o->value(); }
+  int KeyCompareWithValue(double val) const { return value() < val ? -1 : value() > val; }
+  double GetKey() const { return GetField<double>(VT_VALUE, 0.0); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<double>(verifier, VT_VALUE) &&
+           verifier.EndTable();
+  }
+};
+
+struct ReadingBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_value(double value) { fbb_.AddElement<double>(Reading::VT_VALUE, value, 0.0); }
+  ReadingBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  ReadingBuilder &operator=(const ReadingBuilder &);
+  flatbuffers::Offset<Reading> Finish() {
+    auto o = flatbuffers::Offset<Reading>(fbb_.EndTable(start_, 1));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Reading> CreateReading(flatbuffers::FlatBufferBuilder &_fbb,
+    double value = 0.0) {
+  if (_fbb.ForcingDefaults() || (value != 0.0)) {
+    // All fields are present, so the layout is known.
+    static const flatbuffers::voffset_t offsets_[] = { 4 };
+    auto start_ = _fbb.StartTable();
+    auto table_ = _fbb.PushPrecomputedTable(12, 8);
+    flatbuffers::WriteScalar<double>(table_ + 4, value);
+    return flatbuffers::Offset<Reading>(_fbb.EndPrecomputedTable(start_, offsets_, 1));
+  }
+  ReadingBuilder builder_(_fbb);
+  builder_.add_value(value);
+  return builder_.Finish();
+}
+
+struct Catalog FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ENTRIES = 4,
+    VT_ENTRIES_INDEX = 6
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<Entry>> *entries() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_ENTRIES); }
+  const flatbuffers::Vector<uint64_t> *entries_index() const { return GetPointer<const flatbuffers::Vector<uint64_t> *>(VT_ENTRIES_INDEX); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_ENTRIES) &&
+           verifier.Verify(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_ENTRIES_INDEX) &&
+           verifier.Verify(entries_index()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CatalogBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_entries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries) { fbb_.AddOffset(Catalog::VT_ENTRIES, entries); }
+  void add_entries_index(flatbuffers::Offset<flatbuffers::Vector<uint64_t>> entries_index) { fbb_.AddOffset(Catalog::VT_ENTRIES_INDEX, entries_index); }
+  CatalogBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  CatalogBuilder &operator=(const CatalogBuilder &);
+  flatbuffers::Offset<Catalog> Finish() {
+    auto o = flatbuffers::Offset<Catalog>(fbb_.EndTable(start_, 2));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Catalog> CreateCatalog(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint64_t>> entries_index = 0) {
+  CatalogBuilder builder_(_fbb);
+  builder_.add_entries_index(entries_index);
+  builder_.add_entries(entries);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Catalog> CreateCatalogDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<Entry>> *entries = nullptr,
+    const std::vector<uint64_t> *entries_index = nullptr) {
+  return CreateCatalog(_fbb, entries ? _fbb.CreateVector<flatbuffers::Offset<Entry>>(*entries) : 0, entries_index ? _fbb.CreateVector<uint64_t>(*entries_index) : 0);
+}
+
+inline const KeyIndexTest::Catalog *GetCatalog(const void *buf) { return flatbuffers::GetRoot<KeyIndexTest::Catalog>(buf); }
+
+inline const KeyIndexTest::Catalog *GetSizePrefixedCatalog(const void *buf) { return flatbuffers::GetSizePrefixedRoot<KeyIndexTest::Catalog>(buf); }
+
+inline bool VerifyCatalogBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<KeyIndexTest::Catalog>(nullptr); }
+
+inline bool VerifySizePrefixedCatalogBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<KeyIndexTest::Catalog>(nullptr); }
+
+inline void FinishCatalogBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<KeyIndexTest::Catalog> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedCatalogBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<KeyIndexTest::Catalog> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace KeyIndexTest
+
+#endif  // FLATBUFFERS_GENERATED_KEYINDEXTEST_KEYINDEXTEST_H_
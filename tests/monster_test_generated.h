@@ -59,10 +59,17 @@ struct AnyUnion {
   AnyUnion() : type(Any_NONE), table(nullptr) {}
   AnyUnion(const AnyUnion &);
   AnyUnion &operator=(const AnyUnion &);
+  AnyUnion(AnyUnion &&u) FLATBUFFERS_NOEXCEPT :
+    type(Any_NONE), table(nullptr)
+    { std::swap(type, u.type); std::swap(table, u.table); }
+  AnyUnion &operator=(AnyUnion &&u) FLATBUFFERS_NOEXCEPT
+    { std::swap(type, u.type); std::swap(table, u.table); return *this; }
   ~AnyUnion();
+  void Reset();
 
   void UnPack(const void *union_obj, Any _t);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  size_t EstimatePackedSize() const;
 
   MonsterT *AsMonster() { return type == Any_Monster ? reinterpret_cast<MonsterT *>(table) : nullptr; }
   AnyUnion &operator=(const MonsterT &_o);
@@ -81,6 +88,8 @@ inline const char *EnumNameAny(Any e) { return EnumNamesAny()[static_cast<int>(e
 
 inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, Any type);
 
+inline flatbuffers::Offset<void> CopyAny(flatbuffers::FlatBufferBuilder &_fbb, const void *union_obj, Any type);
+
 MANUALLY_ALIGNED_STRUCT(2) Test FLATBUFFERS_FINAL_CLASS {
  private:
   int16_t a_;
@@ -146,6 +155,9 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
 
 struct MonsterT : public flatbuffers::NativeTable {
   flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const Monster *object);
   inline MonsterT& operator=(const Monster *object) { UnPack(object); return *this;}
   explicit MonsterT(const Monster *object) { UnPack(object); }
@@ -154,6 +166,18 @@ struct MonsterT : public flatbuffers::NativeTable {
 
 };
 
+struct MonsterLazyT {
+  explicit MonsterLazyT(const Monster *source = nullptr)
+    : source_(source) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Monster *source() const { return source_; }
+
+ private:
+  const Monster *source_;
+};
+
 struct MonsterBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
@@ -170,6 +194,8 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o);
+
 }  // namespace Example2
 
 namespace Example {
@@ -189,6 +215,9 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
 
 struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
   flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const TestSimpleTableWithEnum *object);
   inline TestSimpleTableWithEnumT& operator=(const TestSimpleTableWithEnum *object) { UnPack(object); return *this;}
   explicit TestSimpleTableWithEnumT(const TestSimpleTableWithEnum *object) { UnPack(object); }
@@ -199,6 +228,21 @@ struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
 
 };
 
+struct TestSimpleTableWithEnumLazyT {
+  explicit TestSimpleTableWithEnumLazyT(const TestSimpleTableWithEnum *source = nullptr)
+    : source_(source), color_(Color_Green) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const TestSimpleTableWithEnum *source() const { return source_; }
+
+  Color &color();
+
+ private:
+  const TestSimpleTableWithEnum *source_;
+  flatbuffers::LazyField<Color> color_;
+};
+
 struct TestSimpleTableWithEnumBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
@@ -218,6 +262,8 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
   return builder_.Finish();
 }
 
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CopyTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnum *_o);
+
 struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
     VT_ID = 4,
@@ -242,6 +288,9 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
 
 struct StatT : public flatbuffers::NativeTable {
   flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const Stat *object);
   inline StatT& operator=(const Stat *object) { UnPack(object); return *this;}
   explicit StatT(const Stat *object) { UnPack(object); }
@@ -255,6 +304,25 @@ struct StatT : public flatbuffers::NativeTable {
 
 };
 
+struct StatLazyT {
+  explicit StatLazyT(const Stat *source = nullptr)
+    : source_(source), val_(0), count_(0) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Stat *source() const { return source_; }
+
+  std::string &id();
+  int64_t &val();
+  uint16_t &count();
+
+ private:
+  const Stat *source_;
+  flatbuffers::LazyField<std::string> id_;
+  flatbuffers::LazyField<int64_t> val_;
+  flatbuffers::LazyField<uint16_t> count_;
+};
+
 struct StatBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
@@ -287,6 +355,8 @@ inline flatbuffers::Offset<Stat> CreateStatDirect(flatbuffers::FlatBufferBuilder
   return CreateStat(_fbb, id ? _fbb.CreateString(id) : 0, val, count);
 }
 
+inline flatbuffers::Offset<Stat> CopyStat(flatbuffers::FlatBufferBuilder &_fbb, const Stat *_o);
+
 /// an example documentation comment: monster object
 struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum {
@@ -329,6 +399,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::String *mutable_name() { return GetPointer<flatbuffers::String *>(VT_NAME); }
   bool KeyCompareLessThan(const Monster *o) const { return *name() < *o->name(); }
   int KeyCompareWithValue(const char *val) const { return strcmp(name()->c_str(), val); }
+  const flatbuffers::String *GetKey() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
   const flatbuffers::Vector<uint8_t> *inventory() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
   flatbuffers::Vector<uint8_t> *mutable_inventory() { return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INVENTORY); }
   Color color() const { return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8)); }
@@ -430,11 +501,14 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
 
 struct MonsterT : public flatbuffers::NativeTable {
   flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
   void UnPack(const Monster *object);
   inline MonsterT& operator=(const Monster *object) { UnPack(object); return *this;}
   explicit MonsterT(const Monster *object) { UnPack(object); }
 
-  flatbuffers::Optional<Vec3> pos;
+  flatbuffers::OptionalStruct<Vec3> pos;
   int16_t mana;
   int16_t hp;
   std::string name;
@@ -480,6 +554,73 @@ struct MonsterT : public flatbuffers::NativeTable {
 
 };
 
+struct MonsterLazyT {
+  explicit MonsterLazyT(const Monster *source = nullptr)
+    : source_(source), mana_(150), hp_(100), color_(Color_Blue), testbool_(false), testhashs32_fnv1_(0), testhashu32_fnv1_(0), testhashs64_fnv1_(0), testhashu64_fnv1_(0), testhashs32_fnv1a_(0), testhashu32_fnv1a_(0), testhashs64_fnv1a_(0), testhashu64_fnv1a_(0), testf_(3.14159f), testf2_(3.0f), testf3_(0.0f) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Monster *source() const { return source_; }
+
+  flatbuffers::OptionalStruct<Vec3> &pos();
+  int16_t &mana();
+  int16_t &hp();
+  std::string &name();
+  std::vector<uint8_t> &inventory();
+  Color &color();
+  AnyUnion &test();
+  std::vector<Test> &test4();
+  std::vector<std::string> &testarrayofstring();
+  std::vector<MonsterT> &testarrayoftables();
+  flatbuffers::OptionalTable<MonsterT, Monster> &enemy();
+  std::vector<uint8_t> &testnestedflatbuffer();
+  flatbuffers::OptionalTable<StatT, Stat> &testempty();
+  bool &testbool();
+  int32_t &testhashs32_fnv1();
+  uint32_t &testhashu32_fnv1();
+  int64_t &testhashs64_fnv1();
+  uint64_t &testhashu64_fnv1();
+  int32_t &testhashs32_fnv1a();
+  uint32_t &testhashu32_fnv1a();
+  int64_t &testhashs64_fnv1a();
+  uint64_t &testhashu64_fnv1a();
+  std::vector<bool> &testarrayofbools();
+  float &testf();
+  float &testf2();
+  float &testf3();
+  std::vector<std::string> &testarrayofstring2();
+
+ private:
+  const Monster *source_;
+  flatbuffers::LazyField<flatbuffers::OptionalStruct<Vec3>> pos_;
+  flatbuffers::LazyField<int16_t> mana_;
+  flatbuffers::LazyField<int16_t> hp_;
+  flatbuffers::LazyField<std::string> name_;
+  flatbuffers::LazyField<std::vector<uint8_t>> inventory_;
+  flatbuffers::LazyField<Color> color_;
+  flatbuffers::LazyField<AnyUnion> test_;
+  flatbuffers::LazyField<std::vector<Test>> test4_;
+  flatbuffers::LazyField<std::vector<std::string>> testarrayofstring_;
+  flatbuffers::LazyField<std::vector<MonsterT>> testarrayoftables_;
+  flatbuffers::LazyField<flatbuffers::OptionalTable<MonsterT, Monster>> enemy_;
+  flatbuffers::LazyField<std::vector<uint8_t>> testnestedflatbuffer_;
+  flatbuffers::LazyField<flatbuffers::OptionalTable<StatT, Stat>> testempty_;
+  flatbuffers::LazyField<bool> testbool_;
+  flatbuffers::LazyField<int32_t> testhashs32_fnv1_;
+  flatbuffers::LazyField<uint32_t> testhashu32_fnv1_;
+  flatbuffers::LazyField<int64_t> testhashs64_fnv1_;
+  flatbuffers::LazyField<uint64_t> testhashu64_fnv1_;
+  flatbuffers::LazyField<int32_t> testhashs32_fnv1a_;
+  flatbuffers::LazyField<uint32_t> testhashu32_fnv1a_;
+  flatbuffers::LazyField<int64_t> testhashs64_fnv1a_;
+  flatbuffers::LazyField<uint64_t> testhashu64_fnv1a_;
+  flatbuffers::LazyField<std::vector<bool>> testarrayofbools_;
+  flatbuffers::LazyField<float> testf_;
+  flatbuffers::LazyField<float> testf2_;
+  flatbuffers::LazyField<float> testf3_;
+  flatbuffers::LazyField<std::vector<std::string>> testarrayofstring2_;
+};
+
 struct MonsterBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
@@ -613,6 +754,8 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(flatbuffers::FlatBufferB
   return CreateMonster(_fbb, pos, mana, hp, name ? _fbb.CreateString(name) : 0, inventory ? _fbb.CreateVector<uint8_t>(*inventory) : 0, color, test_type, test, test4 ? _fbb.CreateVector<const Test *>(*test4) : 0, testarrayofstring ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*testarrayofstring) : 0, testarrayoftables ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(*testarrayoftables) : 0, enemy, testnestedflatbuffer ? _fbb.CreateVector<uint8_t>(*testnestedflatbuffer) : 0, testempty, testbool, testhashs32_fnv1, testhashu32_fnv1, testhashs64_fnv1, testhashu64_fnv1, testhashs32_fnv1a, testhashu32_fnv1a, testhashs64_fnv1a, testhashu64_fnv1a, testarrayofbools ? _fbb.CreateVector<uint8_t>(*testarrayofbools) : 0, testf, testf2, testf3, testarrayofstring2 ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*testarrayofstring2) : 0);
 }
 
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o);
+
 }  // namespace Example
 
 namespace Example2 {
@@ -625,6 +768,20 @@ inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilde
   return CreateMonster(_fbb);
 }
 
+inline size_t MonsterT::EstimatePackedSize() const {
+  size_t _size = 11;
+  return _size;
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o) {
+  (void)_o;
+  return CreateMonster(_fbb);
+}
+
+inline flatbuffers::Offset<Monster> MonsterLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb);
+}
+
 }  // namespace Example2
 
 namespace Example {
@@ -638,8 +795,33 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnumT::Pa
     color);
 }
 
+inline size_t TestSimpleTableWithEnumT::EstimatePackedSize() const {
+  size_t _size = 14;
+  return _size;
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CopyTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnum *_o) {
+  return CreateTestSimpleTableWithEnum(_fbb,
+    _o->color());
+}
+
+inline Color &TestSimpleTableWithEnumLazyT::color() {
+  if (!color_.loaded) {
+    color_.loaded = true;
+    if (source_) {
+      color_.value = source_->color();
+    }
+  }
+  return color_.value;
+}
+
+inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnumLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateTestSimpleTableWithEnum(_fbb,
+    !source_ || color_.loaded ? (color_.value) : (source_->color()));
+}
+
 inline void StatT::UnPack(const Stat *_o) {
-  id.assign(_o->id()->c_str(), _o->id()->size());
+  if (_o->id()) id.assign(_o->id()->c_str(), _o->id()->size()); else id.clear();
   val = _o->val();
   count = _o->count();
 }
@@ -651,43 +833,102 @@ inline flatbuffers::Offset<Stat> StatT::Pack(flatbuffers::FlatBufferBuilder &_fb
     count);
 }
 
+inline size_t StatT::EstimatePackedSize() const {
+  size_t _size = 37;
+  if (id.size()) _size += flatbuffers::EstimateStringSize(id.size());
+  return _size;
+}
+
+inline flatbuffers::Offset<Stat> CopyStat(flatbuffers::FlatBufferBuilder &_fbb, const Stat *_o) {
+  return CreateStat(_fbb,
+    _o->id() ? _fbb.CreateString(_o->id()) : 0,
+    _o->val(),
+    _o->count());
+}
+
+inline std::string &StatLazyT::id() {
+  if (!id_.loaded) {
+    id_.loaded = true;
+    if (source_) {
+      if (source_->id()) id_.value.assign(source_->id()->c_str(), source_->id()->size()); else id_.value.clear();
+    }
+  }
+  return id_.value;
+}
+
+inline int64_t &StatLazyT::val() {
+  if (!val_.loaded) {
+    val_.loaded = true;
+    if (source_) {
+      val_.value = source_->val();
+    }
+  }
+  return val_.value;
+}
+
+inline uint16_t &StatLazyT::count() {
+  if (!count_.loaded) {
+    count_.loaded = true;
+    if (source_) {
+      count_.value = source_->count();
+    }
+  }
+  return count_.value;
+}
+
+inline flatbuffers::Offset<Stat> StatLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateStat(_fbb,
+    !source_ || id_.loaded ? (id_.value.size() ? _fbb.CreateString(id_.value) : 0) : (source_->id() ? _fbb.CreateString(source_->id()) : 0),
+    !source_ || val_.loaded ? (val_.value) : (source_->val()),
+    !source_ || count_.loaded ? (count_.value) : (source_->count()));
+}
+
 inline void MonsterT::UnPack(const Monster *_o) {
   pos = _o->pos();
   mana = _o->mana();
   hp = _o->hp();
-  name.assign(_o->name()->c_str(), _o->name()->size());
-  inventory.clear();
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
   if (_o->inventory()) {
-    inventory.reserve(_o->inventory()->size());
-    for (auto it = _o->inventory()->begin(), __end = _o->inventory()->end(); it != __end; ++it)
-      inventory.push_back((*it));
+    inventory.resize(_o->inventory()->size());
+    auto _e = inventory.begin();
+    for (auto it = _o->inventory()->begin(), __end = _o->inventory()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    inventory.clear();
   }
   color = _o->color();
   test.UnPack(_o->test(), _o->test_type());
-  test4.clear();
   if (_o->test4()) {
-    test4.reserve(_o->test4()->size());
+    test4.clear();
     for (auto it = _o->test4()->begin(), __end = _o->test4()->end(); it != __end; ++it)
       test4.push_back(*(*it));
+  } else {
+    test4.clear();
   }
-  testarrayofstring.clear();
   if (_o->testarrayofstring()) {
-    testarrayofstring.reserve(_o->testarrayofstring()->size());
-    for (auto it = _o->testarrayofstring()->begin(), __end = _o->testarrayofstring()->end(); it != __end; ++it)
-      testarrayofstring.push_back(std::string((*it)->c_str(), (*it)->size()));
+    testarrayofstring.resize(_o->testarrayofstring()->size());
+    auto _e = testarrayofstring.begin();
+    for (auto it = _o->testarrayofstring()->begin(), __end = _o->testarrayofstring()->end(); it != __end; ++it, ++_e)
+      (*_e).assign((*it)->c_str(), (*it)->size());
+  } else {
+    testarrayofstring.clear();
   }
-  testarrayoftables.clear();
   if (_o->testarrayoftables()) {
-    testarrayoftables.reserve(_o->testarrayoftables()->size());
-    for (auto it = _o->testarrayoftables()->begin(), __end = _o->testarrayoftables()->end(); it != __end; ++it)
-      testarrayoftables.push_back(MonsterT((*it)));
+    testarrayoftables.resize(_o->testarrayoftables()->size());
+    auto _e = testarrayoftables.begin();
+    for (auto it = _o->testarrayoftables()->begin(), __end = _o->testarrayoftables()->end(); it != __end; ++it, ++_e)
+      (*_e).UnPack((*it));
+  } else {
+    testarrayoftables.clear();
   }
   enemy = _o->enemy();
-  testnestedflatbuffer.clear();
   if (_o->testnestedflatbuffer()) {
-    testnestedflatbuffer.reserve(_o->testnestedflatbuffer()->size());
-    for (auto it = _o->testnestedflatbuffer()->begin(), __end = _o->testnestedflatbuffer()->end(); it != __end; ++it)
-      testnestedflatbuffer.push_back((*it));
+    testnestedflatbuffer.resize(_o->testnestedflatbuffer()->size());
+    auto _e = testnestedflatbuffer.begin();
+    for (auto it = _o->testnestedflatbuffer()->begin(), __end = _o->testnestedflatbuffer()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    testnestedflatbuffer.clear();
   }
   testempty = _o->testempty();
   testbool = _o->testbool();
@@ -699,26 +940,30 @@ inline void MonsterT::UnPack(const Monster *_o) {
   testhashu32_fnv1a = _o->testhashu32_fnv1a();
   testhashs64_fnv1a = _o->testhashs64_fnv1a();
   testhashu64_fnv1a = _o->testhashu64_fnv1a();
-  testarrayofbools.clear();
   if (_o->testarrayofbools()) {
-    testarrayofbools.reserve(_o->testarrayofbools()->size());
-    for (auto it = _o->testarrayofbools()->begin(), __end = _o->testarrayofbools()->end(); it != __end; ++it)
-      testarrayofbools.push_back((*it) != 0);
+    testarrayofbools.resize(_o->testarrayofbools()->size());
+    auto _e = testarrayofbools.begin();
+    for (auto it = _o->testarrayofbools()->begin(), __end = _o->testarrayofbools()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it) != 0;
+  } else {
+    testarrayofbools.clear();
   }
   testf = _o->testf();
   testf2 = _o->testf2();
   testf3 = _o->testf3();
-  testarrayofstring2.clear();
   if (_o->testarrayofstring2()) {
-    testarrayofstring2.reserve(_o->testarrayofstring2()->size());
-    for (auto it = _o->testarrayofstring2()->begin(), __end = _o->testarrayofstring2()->end(); it != __end; ++it)
-      testarrayofstring2.push_back(std::string((*it)->c_str(), (*it)->size()));
+    testarrayofstring2.resize(_o->testarrayofstring2()->size());
+    auto _e = testarrayofstring2.begin();
+    for (auto it = _o->testarrayofstring2()->begin(), __end = _o->testarrayofstring2()->end(); it != __end; ++it, ++_e)
+      (*_e).assign((*it)->c_str(), (*it)->size());
+  } else {
+    testarrayofstring2.clear();
   }
 }
 
 inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
   return CreateMonster(_fbb,
-    pos,
+    pos.get(),
     mana,
     hp,
     name.size() ? _fbb.CreateString(name) : 0,
@@ -748,6 +993,424 @@ inline flatbuffers::Offset<Monster> MonsterT::Pack(flatbuffers::FlatBufferBuilde
     testarrayofstring2.size() ? _fbb.CreateVectorOfStrings(testarrayofstring2) : 0);
 }
 
+inline size_t MonsterT::EstimatePackedSize() const {
+  size_t _size = 225;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (inventory.size()) {
+    _size += flatbuffers::EstimateVectorSize(inventory.size(), 1);
+  }
+  _size += test.EstimatePackedSize();
+  if (test4.size()) {
+    _size += flatbuffers::EstimateVectorSize(test4.size(), 4);
+  }
+  if (testarrayofstring.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofstring.size(), 4);
+    for (auto it = testarrayofstring.begin(); it != testarrayofstring.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  if (testarrayoftables.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayoftables.size(), 4);
+    for (auto it = testarrayoftables.begin(); it != testarrayoftables.end(); ++it)
+      _size += it->EstimatePackedSize();
+  }
+  if (enemy) _size += enemy->EstimatePackedSize();
+  if (testnestedflatbuffer.size()) {
+    _size += flatbuffers::EstimateVectorSize(testnestedflatbuffer.size(), 1);
+  }
+  if (testempty) _size += testempty->EstimatePackedSize();
+  if (testarrayofbools.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofbools.size(), 1);
+  }
+  if (testarrayofstring2.size()) {
+    _size += flatbuffers::EstimateVectorSize(testarrayofstring2.size(), 4);
+    for (auto it = testarrayofstring2.begin(); it != testarrayofstring2.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  return _size;
+}
+
+inline flatbuffers::Offset<Monster> CopyMonster(flatbuffers::FlatBufferBuilder &_fbb, const Monster *_o) {
+  return CreateMonster(_fbb,
+    _o->pos(),
+    _o->mana(),
+    _o->hp(),
+    _o->name() ? _fbb.CreateString(_o->name()) : 0,
+    _o->inventory() ? _fbb.CreateVectorCopy(_o->inventory()) : 0,
+    _o->color(),
+    _o->test_type(),
+    CopyAny(_fbb, _o->test(), _o->test_type()),
+    _o->test4() ? _fbb.CreateVectorCopy(_o->test4()) : 0,
+    _o->testarrayofstring() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(_o->testarrayofstring()->size(), [&](size_t i) { return _fbb.CreateString(_o->testarrayofstring()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0,
+    _o->testarrayoftables() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(_o->testarrayoftables()->size(), [&](size_t i) { return CopyMonster(_fbb, _o->testarrayoftables()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0,
+    _o->enemy() ? CopyMonster(_fbb, _o->enemy()) : 0,
+    _o->testnestedflatbuffer() ? _fbb.CreateVectorCopy(_o->testnestedflatbuffer()) : 0,
+    _o->testempty() ? CopyStat(_fbb, _o->testempty()) : 0,
+    _o->testbool(),
+    _o->testhashs32_fnv1(),
+    _o->testhashu32_fnv1(),
+    _o->testhashs64_fnv1(),
+    _o->testhashu64_fnv1(),
+    _o->testhashs32_fnv1a(),
+    _o->testhashu32_fnv1a(),
+    _o->testhashs64_fnv1a(),
+    _o->testhashu64_fnv1a(),
+    _o->testarrayofbools() ? _fbb.CreateVectorCopy(_o->testarrayofbools()) : 0,
+    _o->testf(),
+    _o->testf2(),
+    _o->testf3(),
+    _o->testarrayofstring2() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(_o->testarrayofstring2()->size(), [&](size_t i) { return _fbb.CreateString(_o->testarrayofstring2()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0);
+}
+
+inline flatbuffers::OptionalStruct<Vec3> &MonsterLazyT::pos() {
+  if (!pos_.loaded) {
+    pos_.loaded = true;
+    if (source_) {
+      pos_.value = source_->pos();
+    }
+  }
+  return pos_.value;
+}
+
+inline int16_t &MonsterLazyT::mana() {
+  if (!mana_.loaded) {
+    mana_.loaded = true;
+    if (source_) {
+      mana_.value = source_->mana();
+    }
+  }
+  return mana_.value;
+}
+
+inline int16_t &MonsterLazyT::hp() {
+  if (!hp_.loaded) {
+    hp_.loaded = true;
+    if (source_) {
+      hp_.value = source_->hp();
+    }
+  }
+  return hp_.value;
+}
+
+inline std::string &MonsterLazyT::name() {
+  if (!name_.loaded) {
+    name_.loaded = true;
+    if (source_) {
+      if (source_->name()) name_.value.assign(source_->name()->c_str(), source_->name()->size()); else name_.value.clear();
+    }
+  }
+  return name_.value;
+}
+
+inline std::vector<uint8_t> &MonsterLazyT::inventory() {
+  if (!inventory_.loaded) {
+    inventory_.loaded = true;
+    if (source_) {
+      if (source_->inventory()) {
+        inventory_.value.resize(source_->inventory()->size());
+        auto _e = inventory_.value.begin();
+        for (auto it = source_->inventory()->begin(), __end = source_->inventory()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        inventory_.value.clear();
+      }
+    }
+  }
+  return inventory_.value;
+}
+
+inline Color &MonsterLazyT::color() {
+  if (!color_.loaded) {
+    color_.loaded = true;
+    if (source_) {
+      color_.value = source_->color();
+    }
+  }
+  return color_.value;
+}
+
+inline AnyUnion &MonsterLazyT::test() {
+  if (!test_.loaded) {
+    test_.loaded = true;
+    if (source_) {
+      test_.value.UnPack(source_->test(), source_->test_type());
+    }
+  }
+  return test_.value;
+}
+
+inline std::vector<Test> &MonsterLazyT::test4() {
+  if (!test4_.loaded) {
+    test4_.loaded = true;
+    if (source_) {
+      if (source_->test4()) {
+        test4_.value.clear();
+        for (auto it = source_->test4()->begin(), __end = source_->test4()->end(); it != __end; ++it)
+          test4_.value.push_back(*(*it));
+      } else {
+        test4_.value.clear();
+      }
+    }
+  }
+  return test4_.value;
+}
+
+inline std::vector<std::string> &MonsterLazyT::testarrayofstring() {
+  if (!testarrayofstring_.loaded) {
+    testarrayofstring_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofstring()) {
+        testarrayofstring_.value.resize(source_->testarrayofstring()->size());
+        auto _e = testarrayofstring_.value.begin();
+        for (auto it = source_->testarrayofstring()->begin(), __end = source_->testarrayofstring()->end(); it != __end; ++it, ++_e)
+          (*_e).assign((*it)->c_str(), (*it)->size());
+      } else {
+        testarrayofstring_.value.clear();
+      }
+    }
+  }
+  return testarrayofstring_.value;
+}
+
+inline std::vector<MonsterT> &MonsterLazyT::testarrayoftables() {
+  if (!testarrayoftables_.loaded) {
+    testarrayoftables_.loaded = true;
+    if (source_) {
+      if (source_->testarrayoftables()) {
+        testarrayoftables_.value.resize(source_->testarrayoftables()->size());
+        auto _e = testarrayoftables_.value.begin();
+        for (auto it = source_->testarrayoftables()->begin(), __end = source_->testarrayoftables()->end(); it != __end; ++it, ++_e)
+          (*_e).UnPack((*it));
+      } else {
+        testarrayoftables_.value.clear();
+      }
+    }
+  }
+  return testarrayoftables_.value;
+}
+
+inline flatbuffers::OptionalTable<MonsterT, Monster> &MonsterLazyT::enemy() {
+  if (!enemy_.loaded) {
+    enemy_.loaded = true;
+    if (source_) {
+      enemy_.value = source_->enemy();
+    }
+  }
+  return enemy_.value;
+}
+
+inline std::vector<uint8_t> &MonsterLazyT::testnestedflatbuffer() {
+  if (!testnestedflatbuffer_.loaded) {
+    testnestedflatbuffer_.loaded = true;
+    if (source_) {
+      if (source_->testnestedflatbuffer()) {
+        testnestedflatbuffer_.value.resize(source_->testnestedflatbuffer()->size());
+        auto _e = testnestedflatbuffer_.value.begin();
+        for (auto it = source_->testnestedflatbuffer()->begin(), __end = source_->testnestedflatbuffer()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        testnestedflatbuffer_.value.clear();
+      }
+    }
+  }
+  return testnestedflatbuffer_.value;
+}
+
+inline flatbuffers::OptionalTable<StatT, Stat> &MonsterLazyT::testempty() {
+  if (!testempty_.loaded) {
+    testempty_.loaded = true;
+    if (source_) {
+      testempty_.value = source_->testempty();
+    }
+  }
+  return testempty_.value;
+}
+
+inline bool &MonsterLazyT::testbool() {
+  if (!testbool_.loaded) {
+    testbool_.loaded = true;
+    if (source_) {
+      testbool_.value = source_->testbool();
+    }
+  }
+  return testbool_.value;
+}
+
+inline int32_t &MonsterLazyT::testhashs32_fnv1() {
+  if (!testhashs32_fnv1_.loaded) {
+    testhashs32_fnv1_.loaded = true;
+    if (source_) {
+      testhashs32_fnv1_.value = source_->testhashs32_fnv1();
+    }
+  }
+  return testhashs32_fnv1_.value;
+}
+
+inline uint32_t &MonsterLazyT::testhashu32_fnv1() {
+  if (!testhashu32_fnv1_.loaded) {
+    testhashu32_fnv1_.loaded = true;
+    if (source_) {
+      testhashu32_fnv1_.value = source_->testhashu32_fnv1();
+    }
+  }
+  return testhashu32_fnv1_.value;
+}
+
+inline int64_t &MonsterLazyT::testhashs64_fnv1() {
+  if (!testhashs64_fnv1_.loaded) {
+    testhashs64_fnv1_.loaded = true;
+    if (source_) {
+      testhashs64_fnv1_.value = source_->testhashs64_fnv1();
+    }
+  }
+  return testhashs64_fnv1_.value;
+}
+
+inline uint64_t &MonsterLazyT::testhashu64_fnv1() {
+  if (!testhashu64_fnv1_.loaded) {
+    testhashu64_fnv1_.loaded = true;
+    if (source_) {
+      testhashu64_fnv1_.value = source_->testhashu64_fnv1();
+    }
+  }
+  return testhashu64_fnv1_.value;
+}
+
+inline int32_t &MonsterLazyT::testhashs32_fnv1a() {
+  if (!testhashs32_fnv1a_.loaded) {
+    testhashs32_fnv1a_.loaded = true;
+    if (source_) {
+      testhashs32_fnv1a_.value = source_->testhashs32_fnv1a();
+    }
+  }
+  return testhashs32_fnv1a_.value;
+}
+
+inline uint32_t &MonsterLazyT::testhashu32_fnv1a() {
+  if (!testhashu32_fnv1a_.loaded) {
+    testhashu32_fnv1a_.loaded = true;
+    if (source_) {
+      testhashu32_fnv1a_.value = source_->testhashu32_fnv1a();
+    }
+  }
+  return testhashu32_fnv1a_.value;
+}
+
+inline int64_t &MonsterLazyT::testhashs64_fnv1a() {
+  if (!testhashs64_fnv1a_.loaded) {
+    testhashs64_fnv1a_.loaded = true;
+    if (source_) {
+      testhashs64_fnv1a_.value = source_->testhashs64_fnv1a();
+    }
+  }
+  return testhashs64_fnv1a_.value;
+}
+
+inline uint64_t &MonsterLazyT::testhashu64_fnv1a() {
+  if (!testhashu64_fnv1a_.loaded) {
+    testhashu64_fnv1a_.loaded = true;
+    if (source_) {
+      testhashu64_fnv1a_.value = source_->testhashu64_fnv1a();
+    }
+  }
+  return testhashu64_fnv1a_.value;
+}
+
+inline std::vector<bool> &MonsterLazyT::testarrayofbools() {
+  if (!testarrayofbools_.loaded) {
+    testarrayofbools_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofbools()) {
+        testarrayofbools_.value.resize(source_->testarrayofbools()->size());
+        auto _e = testarrayofbools_.value.begin();
+        for (auto it = source_->testarrayofbools()->begin(), __end = source_->testarrayofbools()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it) != 0;
+      } else {
+        testarrayofbools_.value.clear();
+      }
+    }
+  }
+  return testarrayofbools_.value;
+}
+
+inline float &MonsterLazyT::testf() {
+  if (!testf_.loaded) {
+    testf_.loaded = true;
+    if (source_) {
+      testf_.value = source_->testf();
+    }
+  }
+  return testf_.value;
+}
+
+inline float &MonsterLazyT::testf2() {
+  if (!testf2_.loaded) {
+    testf2_.loaded = true;
+    if (source_) {
+      testf2_.value = source_->testf2();
+    }
+  }
+  return testf2_.value;
+}
+
+inline float &MonsterLazyT::testf3() {
+  if (!testf3_.loaded) {
+    testf3_.loaded = true;
+    if (source_) {
+      testf3_.value = source_->testf3();
+    }
+  }
+  return testf3_.value;
+}
+
+inline std::vector<std::string> &MonsterLazyT::testarrayofstring2() {
+  if (!testarrayofstring2_.loaded) {
+    testarrayofstring2_.loaded = true;
+    if (source_) {
+      if (source_->testarrayofstring2()) {
+        testarrayofstring2_.value.resize(source_->testarrayofstring2()->size());
+        auto _e = testarrayofstring2_.value.begin();
+        for (auto it = source_->testarrayofstring2()->begin(), __end = source_->testarrayofstring2()->end(); it != __end; ++it, ++_e)
+          (*_e).assign((*it)->c_str(), (*it)->size());
+      } else {
+        testarrayofstring2_.value.clear();
+      }
+    }
+  }
+  return testarrayofstring2_.value;
+}
+
+inline flatbuffers::Offset<Monster> MonsterLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateMonster(_fbb,
+    !source_ || pos_.loaded ? (pos_.value.get()) : (source_->pos()),
+    !source_ || mana_.loaded ? (mana_.value) : (source_->mana()),
+    !source_ || hp_.loaded ? (hp_.value) : (source_->hp()),
+    !source_ || name_.loaded ? (name_.value.size() ? _fbb.CreateString(name_.value) : 0) : (source_->name() ? _fbb.CreateString(source_->name()) : 0),
+    !source_ || inventory_.loaded ? (inventory_.value.size() ? _fbb.CreateVector(inventory_.value) : 0) : (source_->inventory() ? _fbb.CreateVectorCopy(source_->inventory()) : 0),
+    !source_ || color_.loaded ? (color_.value) : (source_->color()),
+    !source_ || test_.loaded ? (test_.value.type) : (source_->test_type()),
+    !source_ || test_.loaded ? (test_.value.Pack(_fbb)) : (CopyAny(_fbb, source_->test(), source_->test_type())),
+    !source_ || test4_.loaded ? (test4_.value.size() ? _fbb.CreateVectorOfStructs(test4_.value) : 0) : (source_->test4() ? _fbb.CreateVectorCopy(source_->test4()) : 0),
+    !source_ || testarrayofstring_.loaded ? (testarrayofstring_.value.size() ? _fbb.CreateVectorOfStrings(testarrayofstring_.value) : 0) : (source_->testarrayofstring() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(source_->testarrayofstring()->size(), [&](size_t i) { return _fbb.CreateString(source_->testarrayofstring()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0),
+    !source_ || testarrayoftables_.loaded ? (testarrayoftables_.value.size() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(testarrayoftables_.value.size(), [&](size_t i) { return testarrayoftables_.value[i].Pack(_fbb); }) : 0) : (source_->testarrayoftables() ? _fbb.CreateVector<flatbuffers::Offset<Monster>>(source_->testarrayoftables()->size(), [&](size_t i) { return CopyMonster(_fbb, source_->testarrayoftables()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0),
+    !source_ || enemy_.loaded ? (enemy_.value ? enemy_.value->Pack(_fbb) : 0) : (source_->enemy() ? CopyMonster(_fbb, source_->enemy()) : 0),
+    !source_ || testnestedflatbuffer_.loaded ? (testnestedflatbuffer_.value.size() ? _fbb.CreateVector(testnestedflatbuffer_.value) : 0) : (source_->testnestedflatbuffer() ? _fbb.CreateVectorCopy(source_->testnestedflatbuffer()) : 0),
+    !source_ || testempty_.loaded ? (testempty_.value ? testempty_.value->Pack(_fbb) : 0) : (source_->testempty() ? CopyStat(_fbb, source_->testempty()) : 0),
+    !source_ || testbool_.loaded ? (testbool_.value) : (source_->testbool()),
+    !source_ || testhashs32_fnv1_.loaded ? (testhashs32_fnv1_.value) : (source_->testhashs32_fnv1()),
+    !source_ || testhashu32_fnv1_.loaded ? (testhashu32_fnv1_.value) : (source_->testhashu32_fnv1()),
+    !source_ || testhashs64_fnv1_.loaded ? (testhashs64_fnv1_.value) : (source_->testhashs64_fnv1()),
+    !source_ || testhashu64_fnv1_.loaded ? (testhashu64_fnv1_.value) : (source_->testhashu64_fnv1()),
+    !source_ || testhashs32_fnv1a_.loaded ? (testhashs32_fnv1a_.value) : (source_->testhashs32_fnv1a()),
+    !source_ || testhashu32_fnv1a_.loaded ? (testhashu32_fnv1a_.value) : (source_->testhashu32_fnv1a()),
+    !source_ || testhashs64_fnv1a_.loaded ? (testhashs64_fnv1a_.value) : (source_->testhashs64_fnv1a()),
+    !source_ || testhashu64_fnv1a_.loaded ? (testhashu64_fnv1a_.value) : (source_->testhashu64_fnv1a()),
+    !source_ || testarrayofbools_.loaded ? (testarrayofbools_.value.size() ? _fbb.CreateVector(testarrayofbools_.value) : 0) : (source_->testarrayofbools() ? _fbb.CreateVectorCopy(source_->testarrayofbools()) : 0),
+    !source_ || testf_.loaded ? (testf_.value) : (source_->testf()),
+    !source_ || testf2_.loaded ? (testf2_.value) : (source_->testf2()),
+    !source_ || testf3_.loaded ? (testf3_.value) : (source_->testf3()),
+    !source_ || testarrayofstring2_.loaded ? (testarrayofstring2_.value.size() ? _fbb.CreateVectorOfStrings(testarrayofstring2_.value) : 0) : (source_->testarrayofstring2() ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(source_->testarrayofstring2()->size(), [&](size_t i) { return _fbb.CreateString(source_->testarrayofstring2()->Get(static_cast<flatbuffers::uoffset_t>(i))); }) : 0));
+}
+
 inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, Any type) {
   switch (type) {
     case Any_NONE: return true;
@@ -758,9 +1421,26 @@ inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *union_obj, An
   }
 }
 
+inline flatbuffers::Offset<void> CopyAny(flatbuffers::FlatBufferBuilder &_fbb, const void *union_obj, Any type) {
+  switch (type) {
+    case Any_Monster: return CopyMonster(_fbb, reinterpret_cast<const Monster *>(union_obj)).Union();
+    case Any_TestSimpleTableWithEnum: return CopyTestSimpleTableWithEnum(_fbb, reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj)).Union();
+    case Any_MyGame_Example2_Monster: return MyGame::Example2::CopyMonster(_fbb, reinterpret_cast<const MyGame::Example2::Monster *>(union_obj)).Union();
+    default: return 0;
+  }
+}
+
 inline void AnyUnion::UnPack(const void *union_obj, Any _t) {
+  if (union_obj && _t == type) {
+    switch (_t) {
+      case Any_Monster: static_cast<MonsterT *>(table)->UnPack(reinterpret_cast<const Monster *>(union_obj)); return;
+      case Any_TestSimpleTableWithEnum: static_cast<TestSimpleTableWithEnumT *>(table)->UnPack(reinterpret_cast<const TestSimpleTableWithEnum *>(union_obj)); return;
+      case Any_MyGame_Example2_Monster: static_cast<MyGame::Example2::MonsterT *>(table)->UnPack(reinterpret_cast<const MyGame::Example2::Monster *>(union_obj)); return;
+      default: break;
+    }
+  }
+  Reset();
   type = _t;
-  delete table;
   if (!union_obj) { table = nullptr; type = Any_NONE; return; }
   switch (_t) {
     case Any_NONE: table = nullptr; break;
@@ -781,10 +1461,19 @@ inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &
   }
 }
 
+inline size_t AnyUnion::EstimatePackedSize() const {
+  switch (type) {
+    case Any_Monster: return static_cast<const MonsterT *>(table)->EstimatePackedSize();
+    case Any_TestSimpleTableWithEnum: return static_cast<const TestSimpleTableWithEnumT *>(table)->EstimatePackedSize();
+    case Any_MyGame_Example2_Monster: return static_cast<const MyGame::Example2::MonsterT *>(table)->EstimatePackedSize();
+    default: return 0;
+  }
+}
+
 inline AnyUnion::AnyUnion(const AnyUnion &other) : type(Any_NONE), table(nullptr) { *this = other; }
 inline AnyUnion& AnyUnion::operator=(const AnyUnion &other) {
+  Reset();
   type = other.type;
-  delete table;
   switch (other.type) {
     case Any_Monster: table = new MonsterT(*(static_cast<MonsterT *>(other.table))); break;
     case Any_TestSimpleTableWithEnum: table = new TestSimpleTableWithEnumT(*(static_cast<TestSimpleTableWithEnumT *>(other.table))); break;
@@ -797,36 +1486,42 @@ inline AnyUnion& AnyUnion::operator=(const AnyUnion &other) {
   return *this;
 }
 
-inline AnyUnion::~AnyUnion() {
+inline AnyUnion::~AnyUnion() { Reset(); }
+
+inline void AnyUnion::Reset() {
   switch (type) {
     case Any_Monster: delete static_cast<MonsterT *>(table); break;
     case Any_TestSimpleTableWithEnum: delete static_cast<TestSimpleTableWithEnumT *>(table); break;
     case Any_MyGame_Example2_Monster: delete static_cast<MyGame::Example2::MonsterT *>(table); break;
     default: assert(!table); break;
   }
+  table = nullptr;
+  type = Any_NONE;
 }
 
 inline AnyUnion& AnyUnion::operator=(const MonsterT &_o) {
+  Reset();
   type = Any_Monster;
-  delete table;
   table = new MonsterT(_o);
   return *this;
 }
 inline AnyUnion& AnyUnion::operator=(const TestSimpleTableWithEnumT &_o) {
+  Reset();
   type = Any_TestSimpleTableWithEnum;
-  delete table;
   table = new TestSimpleTableWithEnumT(_o);
   return *this;
 }
 inline AnyUnion& AnyUnion::operator=(const MyGame::Example2::MonsterT &_o) {
+  Reset();
   type = Any_MyGame_Example2_Monster;
-  delete table;
   table = new MyGame::Example2::MonsterT(_o);
   return *this;
 }
 
 inline const MyGame::Example::Monster *GetMonster(const void *buf) { return flatbuffers::GetRoot<MyGame::Example::Monster>(buf); }
 
+inline const MyGame::Example::Monster *GetSizePrefixedMonster(const void *buf) { return flatbuffers::GetSizePrefixedRoot<MyGame::Example::Monster>(buf); }
+
 inline Monster *GetMutableMonster(void *buf) { return flatbuffers::GetMutableRoot<Monster>(buf); }
 
 inline const char *MonsterIdentifier() { return "MONS"; }
@@ -835,10 +1530,14 @@ inline bool MonsterBufferHasIdentifier(const void *buf) { return flatbuffers::Bu
 
 inline bool VerifyMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<MyGame::Example::Monster>(MonsterIdentifier()); }
 
+inline bool VerifySizePrefixedMonsterBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<MyGame::Example::Monster>(MonsterIdentifier()); }
+
 inline const char *MonsterExtension() { return "mon"; }
 
 inline void FinishMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.Finish(root, MonsterIdentifier()); }
 
+inline void FinishSizePrefixedMonsterBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<MyGame::Example::Monster> root) { fbb.FinishSizePrefixed(root, MonsterIdentifier()); }
+
 }  // namespace Example
 }  // namespace MyGame
 
@@ -0,0 +1,268 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64TEST_H_
+#define FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64TEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace Offset64Test {
+
+struct Point;
+
+struct Blob;
+struct BlobT;
+
+MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  Point() { memset(this, 0, sizeof(Point)); }
+  Point(const Point &_o) { memcpy(this, &_o, sizeof(Point)); }
+  Point(float _x, float _y)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  void mutate_x(float _x) { flatbuffers::WriteScalar(&x_, _x); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  void mutate_y(float _y) { flatbuffers::WriteScalar(&y_, _y); }
+};
+STRUCT_END(Point, 8);
+
+struct Blob FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NAME = 4,
+    VT_DATA = 6,
+    VT_POINTS = 8,
+    VT_IDS = 10
+  };
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  const flatbuffers::Vector64<uint8_t> *data() const { return GetPointer64<const flatbuffers::Vector64<uint8_t> *>(VT_DATA); }
+  const flatbuffers::Vector64<const Point *> *points() const { return GetPointer64<const flatbuffers::Vector64<const Point *> *>(VT_POINTS); }
+  const flatbuffers::Vector<int64_t> *ids() const { return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_IDS); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyOffset64(verifier, VT_DATA) &&
+           verifier.Verify(data()) &&
+           VerifyOffset64(verifier, VT_POINTS) &&
+           verifier.Verify(points()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_IDS) &&
+           verifier.Verify(ids()) &&
+           verifier.EndTable();
+  }
+};
+
+struct BlobT : public flatbuffers::NativeTable {
+  flatbuffers::Offset<Blob> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Blob *object);
+  inline BlobT& operator=(const Blob *object) { UnPack(object); return *this;}
+  explicit BlobT(const Blob *object) { UnPack(object); }
+
+  std::string name;
+  std::vector<uint8_t> data;
+  std::vector<Point> points;
+  std::vector<int64_t> ids;
+  BlobT() {}
+
+};
+
+struct BlobLazyT {
+  explicit BlobLazyT(const Blob *source = nullptr)
+    : source_(source) {}
+
+  // Fields that were never accessed are copied from the source.
+  flatbuffers::Offset<Blob> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  const Blob *source() const { return source_; }
+
+  std::string &name();
+  std::vector<uint8_t> &data();
+  std::vector<Point> &points();
+  std::vector<int64_t> &ids();
+
+ private:
+  const Blob *source_;
+  flatbuffers::LazyField<std::string> name_;
+  flatbuffers::LazyField<std::vector<uint8_t>> data_;
+  flatbuffers::LazyField<std::vector<Point>> points_;
+  flatbuffers::LazyField<std::vector<int64_t>> ids_;
+};
+
+struct BlobBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Blob::VT_NAME, name); }
+  void add_data(flatbuffers::Offset64<flatbuffers::Vector64<uint8_t>> data) { fbb_.AddOffset(Blob::VT_DATA, data); }
+  void add_points(flatbuffers::Offset64<flatbuffers::Vector64<const Point *>> points) { fbb_.AddOffset(Blob::VT_POINTS, points); }
+  void add_ids(flatbuffers::Offset<flatbuffers::Vector<int64_t>> ids) { fbb_.AddOffset(Blob::VT_IDS, ids); }
+  BlobBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  BlobBuilder &operator=(const BlobBuilder &);
+  flatbuffers::Offset<Blob> Finish() {
+    auto o = flatbuffers::Offset<Blob>(fbb_.EndTable(start_, 4));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Blob> CreateBlob(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset64<flatbuffers::Vector64<uint8_t>> data = 0,
+    flatbuffers::Offset64<flatbuffers::Vector64<const Point *>> points = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> ids = 0) {
+  BlobBuilder builder_(_fbb);
+  builder_.add_points(points);
+  builder_.add_data(data);
+  builder_.add_ids(ids);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Blob> CreateBlobDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<uint8_t> *data = nullptr,
+    const std::vector<const Point *> *points = nullptr,
+    const std::vector<int64_t> *ids = nullptr) {
+  return CreateBlob(_fbb, name ? _fbb.CreateString(name) : 0, data ? _fbb.CreateVector64<uint8_t>(*data) : 0, points ? _fbb.CreateVector64<const Point *>(*points) : 0, ids ? _fbb.CreateVector<int64_t>(*ids) : 0);
+}
+
+inline flatbuffers::Offset<Blob> CopyBlob(flatbuffers::FlatBufferBuilder &_fbb, const Blob *_o);
+
+inline void BlobT::UnPack(const Blob *_o) {
+  if (_o->name()) name.assign(_o->name()->c_str(), _o->name()->size()); else name.clear();
+  if (_o->data()) {
+    data.resize(_o->data()->size());
+    auto _e = data.begin();
+    for (auto it = _o->data()->begin(), __end = _o->data()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    data.clear();
+  }
+  if (_o->points()) {
+    points.clear();
+    for (auto it = _o->points()->begin(), __end = _o->points()->end(); it != __end; ++it)
+      points.push_back(*(*it));
+  } else {
+    points.clear();
+  }
+  if (_o->ids()) {
+    ids.resize(_o->ids()->size());
+    auto _e = ids.begin();
+    for (auto it = _o->ids()->begin(), __end = _o->ids()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    ids.clear();
+  }
+}
+
+inline flatbuffers::Offset<Blob> BlobT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateBlob(_fbb,
+    name.size() ? _fbb.CreateString(name) : 0,
+    data.size() ? _fbb.CreateVector64(data) : 0,
+    points.size() ? _fbb.CreateVectorOfStructs64(points) : 0,
+    ids.size() ? _fbb.CreateVector(ids) : 0);
+}
+
+inline size_t BlobT::EstimatePackedSize() const {
+  size_t _size = 47;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (ids.size()) {
+    _size += flatbuffers::EstimateVectorSize(ids.size(), 8);
+  }
+  return _size;
+}
+
+inline flatbuffers::Offset<Blob> CopyBlob(flatbuffers::FlatBufferBuilder &_fbb, const Blob *_o) {
+  return CreateBlob(_fbb,
+    _o->name() ? _fbb.CreateString(_o->name()) : 0,
+    _o->data() ? _fbb.CreateVectorCopy(_o->data()) : 0,
+    _o->points() ? _fbb.CreateVectorCopy(_o->points()) : 0,
+    _o->ids() ? _fbb.CreateVectorCopy(_o->ids()) : 0);
+}
+
+inline std::string &BlobLazyT::name() {
+  if (!name_.loaded) {
+    name_.loaded = true;
+    if (source_) {
+      if (source_->name()) name_.value.assign(source_->name()->c_str(), source_->name()->size()); else name_.value.clear();
+    }
+  }
+  return name_.value;
+}
+
+inline std::vector<uint8_t> &BlobLazyT::data() {
+  if (!data_.loaded) {
+    data_.loaded = true;
+    if (source_) {
+      if (source_->data()) {
+        data_.value.resize(source_->data()->size());
+        auto _e = data_.value.begin();
+        for (auto it = source_->data()->begin(), __end = source_->data()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        data_.value.clear();
+      }
+    }
+  }
+  return data_.value;
+}
+
+inline std::vector<Point> &BlobLazyT::points() {
+  if (!points_.loaded) {
+    points_.loaded = true;
+    if (source_) {
+      if (source_->points()) {
+        points_.value.clear();
+        for (auto it = source_->points()->begin(), __end = source_->points()->end(); it != __end; ++it)
+          points_.value.push_back(*(*it));
+      } else {
+        points_.value.clear();
+      }
+    }
+  }
+  return points_.value;
+}
+
+inline std::vector<int64_t> &BlobLazyT::ids() {
+  if (!ids_.loaded) {
+    ids_.loaded = true;
+    if (source_) {
+      if (source_->ids()) {
+        ids_.value.resize(source_->ids()->size());
+        auto _e = ids_.value.begin();
+        for (auto it = source_->ids()->begin(), __end = source_->ids()->end(); it != __end; ++it, ++_e)
+          (*_e) = (*it);
+      } else {
+        ids_.value.clear();
+      }
+    }
+  }
+  return ids_.value;
+}
+
+inline flatbuffers::Offset<Blob> BlobLazyT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateBlob(_fbb,
+    !source_ || name_.loaded ? (name_.value.size() ? _fbb.CreateString(name_.value) : 0) : (source_->name() ? _fbb.CreateString(source_->name()) : 0),
+    !source_ || data_.loaded ? (data_.value.size() ? _fbb.CreateVector64(data_.value) : 0) : (source_->data() ? _fbb.CreateVectorCopy(source_->data()) : 0),
+    !source_ || points_.loaded ? (points_.value.size() ? _fbb.CreateVectorOfStructs64(points_.value) : 0) : (source_->points() ? _fbb.CreateVectorCopy(source_->points()) : 0),
+    !source_ || ids_.loaded ? (ids_.value.size() ? _fbb.CreateVector(ids_.value) : 0) : (source_->ids() ? _fbb.CreateVectorCopy(source_->ids()) : 0));
+}
+
+inline const Offset64Test::Blob *GetBlob(const void *buf) { return flatbuffers::GetRoot<Offset64Test::Blob>(buf); }
+
+inline const Offset64Test::Blob *GetSizePrefixedBlob(const void *buf) { return flatbuffers::GetSizePrefixedRoot<Offset64Test::Blob>(buf); }
+
+inline bool VerifyBlobBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<Offset64Test::Blob>(nullptr); }
+
+inline bool VerifySizePrefixedBlobBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<Offset64Test::Blob>(nullptr); }
+
+inline void FinishBlobBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<Offset64Test::Blob> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedBlobBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<Offset64Test::Blob> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace Offset64Test
+
+#endif  // FLATBUFFERS_GENERATED_OFFSET64TEST_OFFSET64TEST_H_
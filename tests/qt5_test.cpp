@@ -0,0 +1,79 @@
+/*
+ * Copyright 2014 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that the code generated with --cpp-framework qt5 compiles against
+// Qt, and that the models it hands out show the buffer.
+
+#include <cstdio>
+
+#include "qt5_test_generated.h"
+
+using namespace Qt5Test;
+
+static int failures = 0;
+
+static void Check(bool ok, const char *what) {
+  if (!ok) {
+    printf("FAILED: %s\n", what);
+    failures++;
+  }
+}
+
+#define CHECK(x) Check(x, #x)
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  flatbuffers::FlatBufferBuilder fbb;
+  flatbuffers::Offset<Item> items[] = {
+    CreateItem(fbb, fbb.CreateString("first")),
+    CreateItem(fbb, fbb.CreateString("second"))
+  };
+  int values[] = { 1, 2, 3 };
+  Vec2 points[] = { Vec2(1, 2) };
+  fbb.Finish(CreateRoot(fbb, fbb.CreateVector(items, 2), 0,
+                        fbb.CreateVector(values, 3),
+                        fbb.CreateVectorOfStructs(points, 1)));
+  auto root = GetRoot(fbb.GetBufferPointer());
+
+  // The table side: models over the buffer, made once per field.
+  RootModels models(root);
+  auto items_model = qobject_cast<QAbstractListModel *>(models.get_items());
+  CHECK(items_model && items_model == models.get_items());
+  CHECK(items_model->rowCount() == 2);
+  CHECK(items_model->roleNames().value(Qt::UserRole) == "name");
+  CHECK(items_model->data(items_model->index(1), Qt::UserRole).toByteArray() ==
+        "second");
+  auto values_model = qobject_cast<QAbstractListModel *>(models.get_values());
+  CHECK(values_model->data(values_model->index(2), Qt::DisplayRole).toInt() ==
+        3);
+  auto points_model = qobject_cast<QAbstractListModel *>(models.get_points());
+  CHECK(points_model->rowCount() == 1);
+  auto names_model = qobject_cast<QAbstractListModel *>(models.get_names());
+  CHECK(names_model->rowCount() == 0);
+  CHECK(models.property("values").value<QObject *>() == values_model);
+  models.setTable(nullptr);
+  CHECK(values_model->rowCount() == 0);
+
+  // The object side: editable models over the unpacked vectors.
+  RootT rootobj(root);
+  auto values_list = qobject_cast<QAbstractListModel *>(rootobj.get_values());
+  CHECK(values_list && values_list == rootobj.get_values());
+  CHECK(values_list->rowCount() == 3);
+  CHECK(rootobj.items[0].name == "first");
+
+  if (failures) return 1;
+  printf("ALL TESTS PASSED\n");
+  return 0;
+}
@@ -0,0 +1,484 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_QT5TEST_QT5TEST_H_
+#define FLATBUFFERS_GENERATED_QT5TEST_QT5TEST_H_
+
+#ifndef FLATBUFFERS_USE_QT
+#error FLATBUFFERS_USE_QT is not defined
+#endif
+
+#include "flatbuffers/flatbuffers.h"
+
+#include <QObject>
+#if (QT_VERSION < QT_VERSION_CHECK(5, 8, 0))
+# error Qt version must me at least 5.8
+#endif
+
+namespace Qt5Test {
+Q_NAMESPACE
+
+struct Vec2;
+
+struct Item;
+struct ItemT;
+
+struct Root;
+struct RootT;
+
+MANUALLY_ALIGNED_STRUCT(4) Vec2 FLATBUFFERS_FINAL_CLASS {
+  Q_GADGET
+ private:
+  float x_;
+  float y_;
+
+ public:
+  Vec2() { memset(this, 0, sizeof(Vec2)); }
+  Vec2(const Vec2 &_o) { memcpy(this, &_o, sizeof(Vec2)); }
+  Vec2(float _x, float _y)
+    : x_(flatbuffers::EndianScalar(_x)), y_(flatbuffers::EndianScalar(_y)) { }
+
+  float x() const { return flatbuffers::EndianScalar(x_); }
+  void mutate_x(float _x) { flatbuffers::WriteScalar(&x_, _x); }
+  float y() const { return flatbuffers::EndianScalar(y_); }
+  void mutate_y(float _y) { flatbuffers::WriteScalar(&y_, _y); }
+  Q_PROPERTY(float x READ x WRITE mutate_x)
+  Q_PROPERTY(float y READ y WRITE mutate_y)
+  inline bool operator ==(const Vec2 &other) const {
+    return x_ == other.x_ &&
+    y_ == other.y_;
+  }
+  inline bool operator !=(const Vec2 &other) const { return !operator==(other);}
+};
+STRUCT_END(Vec2, 8);
+
+struct Item FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_NAME = 4,
+    VT_POS = 6,
+    VT_TAGS = 8
+  };
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(VT_NAME); }
+  const Vec2 *pos() const { return GetStruct<const Vec2 *>(VT_POS); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyField<Vec2>(verifier, VT_POS) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_TAGS) &&
+           verifier.Verify(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           verifier.EndTable();
+  }
+  static QHash<int, QByteArray> QtRoleNames();
+  QVariant QtRoleData(int role) const;
+};
+
+// Read-only list models over the vectors of a Item, for QML to
+// show without unpacking them (see flatbuffers::VectorModel). The buffer
+// must outlive them.
+class ItemModels : public QObject {
+  Q_OBJECT
+  Q_PROPERTY(QObject* tags READ get_tags CONSTANT)
+ public:
+  explicit ItemModels(const Item *table, QObject *parent = nullptr)
+    : QObject(parent), table_(table) {}
+  QObject* get_tags();
+  // Show the same table in a newer buffer, in the models made so far.
+  void setTable(const Item *table);
+  const Item *table() const { return table_; }
+
+ private:
+  const Item *table_;
+  flatbuffers::VectorModelCache<flatbuffers::Offset<flatbuffers::String>> tags_model_;
+};
+
+struct ItemT : public flatbuffers::NativeTable {
+  Q_GADGET
+ public:
+  flatbuffers::Offset<Item> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Item *object);
+  inline ItemT& operator=(const Item *object) { UnPack(object); return *this;}
+  explicit ItemT(const Item *object) { UnPack(object); }
+
+  QByteArray name;
+  flatbuffers::OptionalStruct<Vec2> pos;
+  std::vector<QByteArray> tags;
+  ItemT() {}
+
+  QVariant get_pos() const {return pos.toQVariant();}
+  void set_pos(const QVariant &val) {pos.fromQVariant(val);}
+  Q_INVOKABLE QVariant create_pos() {pos.create(); return pos.toQVariant();}
+  QObject* get_tags() {return tags_model_.get(tags);}
+
+  Q_PROPERTY(QByteArray name MEMBER name)
+  Q_PROPERTY(QVariant pos READ get_pos WRITE set_pos)
+  Q_PROPERTY(QObject* tags READ get_tags)
+  inline bool operator ==(const ItemT &other) const {
+    return name == other.name &&
+    pos == other.pos &&
+    tags == other.tags;
+  }
+  inline bool operator !=(const ItemT &other) const { return !operator==(other);}
+
+ private:
+  flatbuffers::ListModelCache<QByteArray> tags_model_;
+};
+
+struct ItemBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(Item::VT_NAME, name); }
+  void add_pos(const Vec2 *pos) { fbb_.AddStruct(Item::VT_POS, pos); }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) { fbb_.AddOffset(Item::VT_TAGS, tags); }
+  ItemBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  ItemBuilder &operator=(const ItemBuilder &);
+  flatbuffers::Offset<Item> Finish() {
+    auto o = flatbuffers::Offset<Item>(fbb_.EndTable(start_, 3));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Item> CreateItem(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    const Vec2 *pos = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0) {
+  ItemBuilder builder_(_fbb);
+  builder_.add_tags(tags);
+  builder_.add_pos(pos);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Item> CreateItemDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const Vec2 *pos = 0,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr) {
+  return CreateItem(_fbb, name ? _fbb.CreateString(name) : 0, pos, tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0);
+}
+
+struct Root FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  enum {
+    VT_ITEMS = 4,
+    VT_NAMES = 6,
+    VT_VALUES = 8,
+    VT_POINTS = 10
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<Item>> *items() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Item>> *>(VT_ITEMS); }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *names() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_NAMES); }
+  const flatbuffers::Vector<int32_t> *values() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_VALUES); }
+  const flatbuffers::Vector<const Vec2 *> *points() const { return GetPointer<const flatbuffers::Vector<const Vec2 *> *>(VT_POINTS); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_ITEMS) &&
+           verifier.Verify(items()) &&
+           verifier.VerifyVectorOfTables(items()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_NAMES) &&
+           verifier.Verify(names()) &&
+           verifier.VerifyVectorOfStrings(names()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_VALUES) &&
+           verifier.Verify(values()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, VT_POINTS) &&
+           verifier.Verify(points()) &&
+           verifier.EndTable();
+  }
+  static QHash<int, QByteArray> QtRoleNames();
+  QVariant QtRoleData(int role) const;
+};
+
+// Read-only list models over the vectors of a Root, for QML to
+// show without unpacking them (see flatbuffers::VectorModel). The buffer
+// must outlive them.
+class RootModels : public QObject {
+  Q_OBJECT
+  Q_PROPERTY(QObject* items READ get_items CONSTANT)
+  Q_PROPERTY(QObject* names READ get_names CONSTANT)
+  Q_PROPERTY(QObject* values READ get_values CONSTANT)
+  Q_PROPERTY(QObject* points READ get_points CONSTANT)
+ public:
+  explicit RootModels(const Root *table, QObject *parent = nullptr)
+    : QObject(parent), table_(table) {}
+  QObject* get_items();
+  QObject* get_names();
+  QObject* get_values();
+  QObject* get_points();
+  // Show the same table in a newer buffer, in the models made so far.
+  void setTable(const Root *table);
+  const Root *table() const { return table_; }
+
+ private:
+  const Root *table_;
+  flatbuffers::VectorModelCache<flatbuffers::Offset<Item>> items_model_;
+  flatbuffers::VectorModelCache<flatbuffers::Offset<flatbuffers::String>> names_model_;
+  flatbuffers::VectorModelCache<int32_t> values_model_;
+  flatbuffers::VectorModelCache<const Vec2 *> points_model_;
+};
+
+struct RootT : public flatbuffers::NativeTable {
+  Q_GADGET
+ public:
+  flatbuffers::Offset<Root> Pack(flatbuffers::FlatBufferBuilder &_fbb) const;
+  // An upper bound on the bytes Pack() adds to a builder, see
+  // FlatBufferBuilder::Reserve().
+  size_t EstimatePackedSize() const;
+  void UnPack(const Root *object);
+  inline RootT& operator=(const Root *object) { UnPack(object); return *this;}
+  explicit RootT(const Root *object) { UnPack(object); }
+
+  std::vector<ItemT> items;
+  std::vector<QByteArray> names;
+  std::vector<int32_t> values;
+  std::vector<Vec2> points;
+  RootT() {}
+
+  QObject* get_items() {return items_model_.get(items);}
+  QObject* get_names() {return names_model_.get(names);}
+  QObject* get_values() {return values_model_.get(values);}
+  QObject* get_points() {return points_model_.get(points);}
+
+  Q_PROPERTY(QObject* items READ get_items)
+  Q_PROPERTY(QObject* names READ get_names)
+  Q_PROPERTY(QObject* values READ get_values)
+  Q_PROPERTY(QObject* points READ get_points)
+  inline bool operator ==(const RootT &other) const {
+    return items == other.items &&
+    names == other.names &&
+    values == other.values &&
+    points == other.points;
+  }
+  inline bool operator !=(const RootT &other) const { return !operator==(other);}
+
+ private:
+  flatbuffers::ListModelCache<ItemT> items_model_;
+  flatbuffers::ListModelCache<QByteArray> names_model_;
+  flatbuffers::ListModelCache<int32_t> values_model_;
+  flatbuffers::ListModelCache<Vec2> points_model_;
+};
+
+struct RootBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_items(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items) { fbb_.AddOffset(Root::VT_ITEMS, items); }
+  void add_names(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> names) { fbb_.AddOffset(Root::VT_NAMES, names); }
+  void add_values(flatbuffers::Offset<flatbuffers::Vector<int32_t>> values) { fbb_.AddOffset(Root::VT_VALUES, values); }
+  void add_points(flatbuffers::Offset<flatbuffers::Vector<const Vec2 *>> points) { fbb_.AddOffset(Root::VT_POINTS, points); }
+  RootBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  RootBuilder &operator=(const RootBuilder &);
+  flatbuffers::Offset<Root> Finish() {
+    auto o = flatbuffers::Offset<Root>(fbb_.EndTable(start_, 4));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Root> CreateRoot(flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> names = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> values = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Vec2 *>> points = 0) {
+  RootBuilder builder_(_fbb);
+  builder_.add_points(points);
+  builder_.add_values(values);
+  builder_.add_names(names);
+  builder_.add_items(items);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Root> CreateRootDirect(flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<Item>> *items = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *names = nullptr,
+    const std::vector<int32_t> *values = nullptr,
+    const std::vector<const Vec2 *> *points = nullptr) {
+  return CreateRoot(_fbb, items ? _fbb.CreateVector<flatbuffers::Offset<Item>>(*items) : 0, names ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*names) : 0, values ? _fbb.CreateVector<int32_t>(*values) : 0, points ? _fbb.CreateVector<const Vec2 *>(*points) : 0);
+}
+
+inline void ItemT::UnPack(const Item *_o) {
+  if (_o->name()) name = QByteArray(_o->name()->c_str(), _o->name()->size()); else name.clear();
+  pos = _o->pos();
+  if (auto _m = tags_model_.model()) {
+    _m->update(_o->tags() ? _o->tags()->size() : 0, [&](QByteArray &_v, flatbuffers::uoffset_t _i) { _v = QByteArray(_o->tags()->Get(_i)->c_str(), _o->tags()->Get(_i)->size()); });
+  } else if (_o->tags()) {
+    tags.resize(_o->tags()->size());
+    auto _e = tags.begin();
+    for (auto it = _o->tags()->begin(), __end = _o->tags()->end(); it != __end; ++it, ++_e)
+      (*_e) = QByteArray((*it)->c_str(), (*it)->size());
+  } else {
+    tags.clear();
+  }
+}
+
+inline flatbuffers::Offset<Item> ItemT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateItem(_fbb,
+    name.size() ? _fbb.CreateString(name) : 0,
+    pos.get(),
+    tags.size() ? _fbb.CreateVectorOfStrings(tags) : 0);
+}
+
+inline size_t ItemT::EstimatePackedSize() const {
+  size_t _size = 33;
+  if (name.size()) _size += flatbuffers::EstimateStringSize(name.size());
+  if (tags.size()) {
+    _size += flatbuffers::EstimateVectorSize(tags.size(), 4);
+    for (auto it = tags.begin(); it != tags.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  return _size;
+}
+
+inline void RootT::UnPack(const Root *_o) {
+  if (auto _m = items_model_.model()) {
+    _m->update(_o->items() ? _o->items()->size() : 0, [&](ItemT &_v, flatbuffers::uoffset_t _i) { _v.UnPack(_o->items()->Get(_i)); });
+  } else if (_o->items()) {
+    items.resize(_o->items()->size());
+    auto _e = items.begin();
+    for (auto it = _o->items()->begin(), __end = _o->items()->end(); it != __end; ++it, ++_e)
+      (*_e).UnPack((*it));
+  } else {
+    items.clear();
+  }
+  if (auto _m = names_model_.model()) {
+    _m->update(_o->names() ? _o->names()->size() : 0, [&](QByteArray &_v, flatbuffers::uoffset_t _i) { _v = QByteArray(_o->names()->Get(_i)->c_str(), _o->names()->Get(_i)->size()); });
+  } else if (_o->names()) {
+    names.resize(_o->names()->size());
+    auto _e = names.begin();
+    for (auto it = _o->names()->begin(), __end = _o->names()->end(); it != __end; ++it, ++_e)
+      (*_e) = QByteArray((*it)->c_str(), (*it)->size());
+  } else {
+    names.clear();
+  }
+  if (auto _m = values_model_.model()) {
+    _m->update(_o->values() ? _o->values()->size() : 0, [&](int32_t &_v, flatbuffers::uoffset_t _i) { _v = _o->values()->Get(_i); });
+  } else if (_o->values()) {
+    values.resize(_o->values()->size());
+    auto _e = values.begin();
+    for (auto it = _o->values()->begin(), __end = _o->values()->end(); it != __end; ++it, ++_e)
+      (*_e) = (*it);
+  } else {
+    values.clear();
+  }
+  if (auto _m = points_model_.model()) {
+    _m->update(_o->points() ? _o->points()->size() : 0, [&](Vec2 &_v, flatbuffers::uoffset_t _i) { _v = *_o->points()->Get(_i); });
+  } else if (_o->points()) {
+    points.clear();
+    for (auto it = _o->points()->begin(), __end = _o->points()->end(); it != __end; ++it)
+      points.push_back(*(*it));
+  } else {
+    points.clear();
+  }
+}
+
+inline flatbuffers::Offset<Root> RootT::Pack(flatbuffers::FlatBufferBuilder &_fbb) const {
+  return CreateRoot(_fbb,
+    items.size() ? _fbb.CreateVector<flatbuffers::Offset<Item>>(items.size(), [&](size_t i) { return items[i].Pack(_fbb); }) : 0,
+    names.size() ? _fbb.CreateVectorOfStrings(names) : 0,
+    values.size() ? _fbb.CreateVector(values) : 0,
+    points.size() ? _fbb.CreateVectorOfStructs(points) : 0);
+}
+
+inline size_t RootT::EstimatePackedSize() const {
+  size_t _size = 35;
+  if (items.size()) {
+    _size += flatbuffers::EstimateVectorSize(items.size(), 4);
+    for (auto it = items.begin(); it != items.end(); ++it)
+      _size += it->EstimatePackedSize();
+  }
+  if (names.size()) {
+    _size += flatbuffers::EstimateVectorSize(names.size(), 4);
+    for (auto it = names.begin(); it != names.end(); ++it)
+      _size += flatbuffers::EstimateStringSize(it->size());
+  }
+  if (values.size()) {
+    _size += flatbuffers::EstimateVectorSize(values.size(), 4);
+  }
+  if (points.size()) {
+    _size += flatbuffers::EstimateVectorSize(points.size(), 8);
+  }
+  return _size;
+}
+
+inline const Qt5Test::Root *GetRoot(const void *buf) { return flatbuffers::GetRoot<Qt5Test::Root>(buf); }
+
+inline const Qt5Test::Root *GetSizePrefixedRoot(const void *buf) { return flatbuffers::GetSizePrefixedRoot<Qt5Test::Root>(buf); }
+
+inline bool VerifyRootBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<Qt5Test::Root>(nullptr); }
+
+inline bool VerifySizePrefixedRootBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifySizePrefixedBuffer<Qt5Test::Root>(nullptr); }
+
+inline void FinishRootBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<Qt5Test::Root> root) { fbb.Finish(root); }
+
+inline void FinishSizePrefixedRootBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<Qt5Test::Root> root) { fbb.FinishSizePrefixed(root); }
+
+}  // namespace Qt5Test
+
+Q_DECLARE_METATYPE(Qt5Test::Vec2)
+Q_DECLARE_METATYPE(Qt5Test::ItemT)
+Q_DECLARE_METATYPE(Qt5Test::RootT)
+Q_DECLARE_METATYPE(int8_t)
+Q_DECLARE_METATYPE(uint8_t)
+Q_DECLARE_METATYPE(int16_t)
+Q_DECLARE_METATYPE(uint16_t)
+Q_DECLARE_METATYPE(int32_t)
+Q_DECLARE_METATYPE(uint32_t)
+Q_DECLARE_METATYPE(int64_t)
+Q_DECLARE_METATYPE(uint64_t)
+
+inline QHash<int, QByteArray> Qt5Test::Item::QtRoleNames() {
+  return {
+    {Qt::UserRole + 0, "name"},
+    {Qt::UserRole + 1, "pos"}
+  };
+}
+
+inline QVariant Qt5Test::Item::QtRoleData(int role) const {
+  switch (role) {
+    case Qt::UserRole + 0: return name() ? QVariant(QByteArray::fromRawData(name()->c_str(), int(name()->size()))) : QVariant();
+    case Qt::UserRole + 1: return pos() ? QVariant::fromValue(*pos()) : QVariant();
+    default: return QVariant();
+  }
+}
+
+inline QObject *Qt5Test::ItemModels::get_tags() {
+  return tags_model_.get(table_ ? table_->tags() : nullptr, this);
+}
+
+inline void Qt5Test::ItemModels::setTable(const Qt5Test::Item *table) {
+  table_ = table;
+  tags_model_.set(table ? table->tags() : nullptr);
+}
+
+inline QHash<int, QByteArray> Qt5Test::Root::QtRoleNames() {
+  return {};
+}
+
+inline QVariant Qt5Test::Root::QtRoleData(int role) const {
+  (void)role;
+  return QVariant();
+}
+
+inline QObject *Qt5Test::RootModels::get_items() {
+  return items_model_.get(table_ ? table_->items() : nullptr, this);
+}
+
+inline QObject *Qt5Test::RootModels::get_names() {
+  return names_model_.get(table_ ? table_->names() : nullptr, this);
+}
+
+inline QObject *Qt5Test::RootModels::get_values() {
+  return values_model_.get(table_ ? table_->values() : nullptr, this);
+}
+
+inline QObject *Qt5Test::RootModels::get_points() {
+  return points_model_.get(table_ ? table_->points() : nullptr, this);
+}
+
+inline void Qt5Test::RootModels::setTable(const Qt5Test::Root *table) {
+  table_ = table;
+  items_model_.set(table ? table->items() : nullptr);
+  names_model_.set(table ? table->names() : nullptr);
+  values_model_.set(table ? table->values() : nullptr);
+  points_model_.set(table ? table->points() : nullptr);
+}
+
+#endif  // FLATBUFFERS_GENERATED_QT5TEST_QT5TEST_H_
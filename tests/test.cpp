@@ -14,14 +14,27 @@
  * limitations under the License.
  */
 
-#define FLATBUFFERS_DEBUG_VERIFICATION_FAILURE 1
-#define FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+// These are normally set for the whole test binary by the build, as the
+// reflection sources linked in must see the same Verifier.
+#ifndef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+  #define FLATBUFFERS_DEBUG_VERIFICATION_FAILURE 1
+#endif
+#ifndef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+  #define FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+#endif
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
+#include "flatbuffers/pool_allocator.h"
+#include "flatbuffers/container_allocator.h"
 #include "flatbuffers/util.h"
+#include "flatbuffers/work_stealing_pool.h"
 
 #include "monster_test_generated.h"
+#include "key_index_test_generated.h"
+#include "fixed_layout_test_generated.h"
+#include "offset64_test_generated.h"
+#include "arena_test_generated.h"
 #include "namespace_test/namespace_test1_generated.h"
 #include "namespace_test/namespace_test2_generated.h"
 
@@ -382,6 +395,99 @@ void ObjectFlatBuffersTest(uint8_t *flatbuf) {
   TEST_EQ(tests[0].b(), 20);
   TEST_EQ(tests[1].a(), 30);
   TEST_EQ(tests[1].b(), 40);
+
+  // Struct fields are held inline, but can still be null.
+  TEST_EQ(pos.get() == reinterpret_cast<Vec3 *>(&pos), true);
+  auto monster4 = monster2;
+  monster4.pos.release();
+  TEST_EQ(monster4.pos.get() == nullptr, true);
+  TEST_EQ(monster2.pos->z(), 3);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(monster4.Pack(fbb3), MonsterIdentifier());
+  TEST_EQ(GetMonster(fbb3.GetBufferPointer())->pos() == nullptr, true);
+  monster4.pos.create()->mutate_z(5);
+  TEST_EQ(monster4.pos->z(), 5);
+  // Assigning a struct to itself leaves it alone.
+  auto &self = monster4.pos;
+  monster4.pos = self;
+  if (auto own = monster4.pos.get()) monster4.pos = *own;
+  TEST_EQ(monster4.pos->z(), 5);
+}
+
+// Unpack a FlatBuffer lazily, only touching a few fields.
+void LazyObjectFlatBuffersTest(uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  // Untouched, it packs exactly like a fully unpacked object.
+  MyGame::Example::MonsterT monster1(monster);
+  flatbuffers::FlatBufferBuilder fbb1;
+  fbb1.Finish(monster1.Pack(fbb1), MonsterIdentifier());
+  MyGame::Example::MonsterLazyT lazy(monster);
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.Finish(lazy.Pack(fbb2), MonsterIdentifier());
+  TEST_EQ(fbb2.GetSize(), fbb1.GetSize());
+  TEST_EQ(memcmp(fbb2.GetBufferPointer(), fbb1.GetBufferPointer(),
+                 fbb1.GetSize()), 0);
+
+  // Fields are unpacked as they are accessed, and may be changed.
+  TEST_EQ_STR(lazy.name().c_str(), "MyMonster");
+  TEST_EQ(lazy.hp(), 80);
+  TEST_EQ(lazy.pos()->z(), 3);
+  TEST_EQ_STR(lazy.test().AsMonster()->name.c_str(), "Fred");
+  lazy.name() = "Bob";
+  lazy.hp() = 10;
+  lazy.inventory().push_back(10);
+  monster1.name = "Bob";
+  monster1.hp = 10;
+  monster1.inventory.push_back(10);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(monster1.Pack(fbb3), MonsterIdentifier());
+  flatbuffers::FlatBufferBuilder fbb4;
+  fbb4.Finish(lazy.Pack(fbb4), MonsterIdentifier());
+  TEST_EQ(fbb4.GetSize(), fbb3.GetSize());
+  TEST_EQ(memcmp(fbb4.GetBufferPointer(), fbb3.GetBufferPointer(),
+                 fbb3.GetSize()), 0);
+
+  // Without a source table, it starts out with the defaults.
+  MyGame::Example::MonsterLazyT empty;
+  TEST_EQ(empty.mana(), 150);
+  TEST_EQ(empty.pos().get() == nullptr, true);
+}
+
+class CountingAllocator : public flatbuffers::simple_allocator {
+ public:
+  CountingAllocator() : allocations(0) {}
+  virtual uint8_t *allocate(size_t size) const {
+    allocations++;
+    return simple_allocator::allocate(size);
+  }
+  mutable int allocations;
+};
+
+// Packing into a builder that reserved the estimated size must not grow it
+// any further.
+void EstimatePackedSizeTest(uint8_t *flatbuf) {
+  MonsterT monster(GetMonster(flatbuf));
+  for (int i = 0; i < 100; i++) {
+    monster.testarrayoftables.push_back(monster.testarrayoftables[i % 3]);
+    monster.testarrayofstring.push_back(std::string(i, 'x'));
+  }
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(64, &allocator);
+  auto estimate = monster.EstimatePackedSize();
+  fbb.Reserve(estimate);
+  TEST_EQ(allocator.allocations, 2);
+  FinishMonsterBuffer(fbb, monster.Pack(fbb));
+  TEST_EQ(allocator.allocations, 2);
+  TEST_EQ(fbb.GetSize() <= estimate + fbb.kMaxFinishSize, true);
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(GetMonster(fbb.GetBufferPointer())->testarrayoftables()->size(),
+          103U);
+
+  // Reserving what's already there doesn't allocate.
+  fbb.Clear();
+  fbb.Reserve(estimate);
+  TEST_EQ(allocator.allocations, 2);
 }
 
 // example of parsing text straight into a buffer, and generating
@@ -546,13 +652,94 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
   // Using reflection, rather than mutating binary FlatBuffers, we can also copy
   // tables and other things out of other FlatBuffers into a FlatBufferBuilder,
   // either part or whole.
-  flatbuffers::FlatBufferBuilder fbb;
+  // Reserving the estimated size first leaves the builder with exactly the
+  // one allocation it needs.
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(8, &allocator);
+  auto estimate = flatbuffers::EstimatePackedSize(
+                    schema, *root_table, *flatbuffers::GetAnyRoot(flatbuf));
+  fbb.Reserve(estimate);
   auto root_offset = flatbuffers::CopyTable(fbb, schema, *root_table,
                                             *flatbuffers::GetAnyRoot(flatbuf),
                                             true);
   fbb.Finish(root_offset, MonsterIdentifier());
+  TEST_EQ(allocator.allocations, 2);
+  TEST_EQ(fbb.GetSize() <= estimate + fbb.kMaxFinishSize, true);
   // Test that it was copied correctly:
   AccessFlatBufferTest(fbb.GetBufferPointer(), fbb.GetSize());
+
+  // The schema alone is enough to check a buffer before working on it.
+  TEST_EQ(flatbuffers::VerifyAnyBuffer(schema, flatbuf, length), true);
+  TEST_EQ(flatbuffers::VerifyAnyBuffer(schema, resizingbuf.data(),
+                                       resizingbuf.size()), true);
+
+  // The resizing above left the old name and the buffer AddFlatBuffer()
+  // appended behind as garbage, which compacting drops again.
+  auto resized_size = resizingbuf.size();
+  flatbuffers::CompactBuffer(schema, &resizingbuf);
+  TEST_EQ(resizingbuf.size() < resized_size, true);
+  flatbuffers::Verifier compact_verifier(resizingbuf.data(),
+                                         resizingbuf.size());
+  TEST_EQ(VerifyMonsterBuffer(compact_verifier), true);
+  TEST_EQ(flatbuffers::BufferHasIdentifier(resizingbuf.data(),
+                                           MonsterIdentifier()), true);
+  auto compacted = GetMonster(resizingbuf.data());
+  TEST_EQ_STR(compacted->name()->c_str(), "hank");
+  TEST_EQ(compacted->inventory()->size(), 110U);
+  TEST_EQ(compacted->testarrayofstring()->size(), 3U);
+  TEST_EQ_STR(compacted->testarrayofstring()->Get(0)->c_str(), "bob");
+  // Equal strings end up stored once.
+  TEST_EQ(compacted->testarrayofstring()->Get(2), compacted->name());
+  // Compacting is idempotent.
+  auto compact_size = resizingbuf.size();
+  flatbuffers::CompactBuffer(schema, &resizingbuf);
+  TEST_EQ(resizingbuf.size(), compact_size);
+  TEST_EQ(flatbuffers::VerifyAnyBuffer(schema, resizingbuf.data(),
+                                       resizingbuf.size()), true);
+
+  // Fields added smallest first get padded, compacting writes them largest
+  // first instead.
+  flatbuffers::FlatBufferBuilder paddedfbb;
+  auto paddedname = paddedfbb.CreateString("padded");
+  MonsterBuilder paddedmb(paddedfbb);
+  paddedmb.add_testbool(true);
+  paddedmb.add_testhashu64_fnv1(1);
+  paddedmb.add_hp(20);
+  paddedmb.add_testhashs32_fnv1(2);
+  paddedmb.add_name(paddedname);
+  paddedmb.add_testhashs64_fnv1(3);
+  FinishMonsterBuffer(paddedfbb, paddedmb.Finish());
+  std::vector<uint8_t> paddedbuf(paddedfbb.GetBufferPointer(),
+                                 paddedfbb.GetBufferPointer() +
+                                 paddedfbb.GetSize());
+  flatbuffers::CompactBuffer(schema, &paddedbuf);
+  TEST_EQ(paddedbuf.size() < paddedfbb.GetSize(), true);
+  auto padded = GetMonster(paddedbuf.data());
+  TEST_EQ(padded->testbool(), true);
+  TEST_EQ(padded->hp(), 20);
+  TEST_EQ(padded->testhashs64_fnv1(), 3);
+  TEST_EQ_STR(padded->name()->c_str(), "padded");
+
+  // Tables referred to more than once are still shared afterwards.
+  flatbuffers::FlatBufferBuilder dagfbb;
+  auto child = CreateMonster(dagfbb, nullptr, 150, 100,
+                             dagfbb.CreateString("child"));
+  flatbuffers::Offset<Monster> children[] = { child, child };
+  auto dagname = dagfbb.CreateString("parent");
+  auto dagvec = dagfbb.CreateVector(children, 2);
+  MonsterBuilder dagmb(dagfbb);
+  dagmb.add_name(dagname);
+  dagmb.add_testarrayoftables(dagvec);
+  dagmb.add_enemy(child);
+  FinishMonsterBuffer(dagfbb, dagmb.Finish());
+  std::vector<uint8_t> dagbuf(dagfbb.GetBufferPointer(),
+                              dagfbb.GetBufferPointer() + dagfbb.GetSize());
+  flatbuffers::CompactBuffer(schema, &dagbuf);
+  TEST_EQ(dagbuf.size() <= dagfbb.GetSize(), true);
+  auto dag = GetMonster(dagbuf.data());
+  TEST_EQ(dag->testarrayoftables()->Get(0), dag->testarrayoftables()->Get(1));
+  TEST_EQ(dag->testarrayoftables()->Get(0), dag->enemy());
+  TEST_EQ(dag->enemy()->mana(), 150);
 }
 
 // Parse a .proto schema, output as .fbs
@@ -852,6 +1039,1115 @@ void FuzzTest2() {
          static_cast<int>(json.length() / 1024));
 }
 
+// Tables with many different shapes must still share identical vtables,
+// also after the builder has been cleared and reused.
+void VTableDedupTest() {
+  const int num_shapes = 512;
+  const flatbuffers::voffset_t num_fields = 10;
+  flatbuffers::FlatBufferBuilder builder;
+  for (int pass = 0; pass < 2; pass++) {
+    builder.Clear();
+    std::vector<flatbuffers::uoffset_t> objects;
+    for (int round = 0; round < 2; round++) {
+      for (int shape = 1; shape <= num_shapes; shape++) {
+        auto start = builder.StartTable();
+        for (flatbuffers::voffset_t f = 0; f < num_fields; f++) {
+          if (shape & (1 << f))
+            builder.AddElement<int32_t>(flatbuffers::FieldIndexToOffset(f),
+                                        shape, 0);
+        }
+        objects.push_back(builder.EndTable(start, num_fields));
+      }
+    }
+    auto eob = builder.GetCurrentBufferPointer() + builder.GetSize();
+    for (int shape = 1; shape <= num_shapes; shape++) {
+      auto t1 = reinterpret_cast<flatbuffers::Table *>(
+                  eob - objects[shape - 1]);
+      auto t2 = reinterpret_cast<flatbuffers::Table *>(
+                  eob - objects[num_shapes + shape - 1]);
+      // The second table of each shape must point to the first's vtable.
+      TEST_EQ(t1->GetVTable() == t2->GetVTable(), true);
+      for (flatbuffers::voffset_t f = 0; f < num_fields; f++) {
+        auto off = flatbuffers::FieldIndexToOffset(f);
+        TEST_EQ(t2->GetField<int32_t>(off, 0), shape & (1 << f) ? shape : 0);
+      }
+    }
+  }
+}
+
+// Buffers released by builders using a pool_allocator must be recycled by
+// the next builder.
+void PoolAllocatorTest() {
+  flatbuffers::pool_allocator allocator;
+  flatbuffers::pool_allocator::trim_thread_pool();
+  flatbuffers::pool_allocator::reset_thread_stats();
+  for (int i = 0; i < 10; i++) {
+    flatbuffers::FlatBufferBuilder builder(1024, &allocator);
+    auto name = builder.CreateString("MyMonster");
+    // Force the buffer to grow a few times.
+    std::vector<uint8_t> inventory(4096, static_cast<uint8_t>(i));
+    auto inv = builder.CreateVector(inventory);
+    FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 150, 80,
+                                               name, inv));
+    auto size = builder.GetSize();
+    auto buf = builder.ReleaseBufferPointer();
+    flatbuffers::Verifier verifier(buf.get(), size);
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    TEST_EQ(GetMonster(buf.get())->inventory()->Get(0), i);
+  }
+  auto stats = flatbuffers::pool_allocator::thread_stats();
+  // Every size class is only ever allocated from the heap once.
+  TEST_EQ(stats.hits > stats.misses, true);
+  TEST_EQ(stats.hits + stats.misses, stats.recycled + stats.released);
+  TEST_EQ(stats.released, 0U);
+  flatbuffers::pool_allocator::trim_thread_pool();
+}
+
+// Builds a monster with a lot of sub-objects, used to compare buffers
+// produced by differently configured builders.
+void BuildLargeMonster(flatbuffers::FlatBufferBuilder &builder) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateString("Monster" +
+                                     flatbuffers::NumToString(i));
+    std::vector<uint8_t> inventory(static_cast<size_t>(i), 7);
+    auto inv = builder.CreateVector(inventory);
+    auto pos = Vec3(1, 2, static_cast<float>(i), 0, Color_Red, Test(10, 20));
+    monsters.push_back(CreateMonster(builder, &pos, 150,
+                                     static_cast<int16_t>(i), name, inv));
+  }
+  auto testarrayoftables = builder.CreateVector(monsters);
+  auto name = builder.CreateString("MyMonster");
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 150, 80, name,
+                                             0, Color_Blue, Any_NONE, 0, 0, 0,
+                                             testarrayoftables));
+}
+
+// A chunked builder must produce the exact same bytes as a contiguous one.
+void ChunkedBuilderTest() {
+  flatbuffers::FlatBufferBuilder contiguous;
+  BuildLargeMonster(contiguous);
+
+  flatbuffers::FlatBufferBuilder chunked(64);
+  chunked.SetChunkSize(256);
+  BuildLargeMonster(chunked);
+  TEST_EQ(chunked.GetSize(), contiguous.GetSize());
+
+  auto slices = chunked.GetBufferSlices();
+  TEST_EQ(slices.size() > 1, true);
+  std::string joined;
+  for (auto it = slices.begin(); it != slices.end(); ++it) {
+    joined.append(reinterpret_cast<const char *>(it->data), it->size);
+  }
+  TEST_EQ(joined.size(), static_cast<size_t>(contiguous.GetSize()));
+  TEST_EQ(memcmp(joined.data(), contiguous.GetBufferPointer(), joined.size()),
+          0);
+
+  chunked.FlattenBuffer();
+  TEST_EQ(chunked.GetBufferSlices().size(), 1U);
+  TEST_EQ(memcmp(chunked.GetBufferPointer(), contiguous.GetBufferPointer(),
+                 contiguous.GetSize()), 0);
+  flatbuffers::Verifier verifier(chunked.GetBufferPointer(),
+                                 chunked.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+}
+
+// A builder using a container_allocator must leave exactly the same bytes as
+// a regular one in the container, whether it grew there or not.
+void ContainerAllocatorTest() {
+  flatbuffers::FlatBufferBuilder regular;
+  BuildLargeMonster(regular);
+
+  std::vector<uint8_t> bytes(16, 0xFF);
+  flatbuffers::container_allocator<std::vector<uint8_t>> allocator(bytes);
+  {
+    flatbuffers::FlatBufferBuilder builder(64, &allocator);
+    BuildLargeMonster(builder);
+    TEST_EQ(builder.GetBufferPointer() >= bytes.data() &&
+            builder.GetBufferPointer() < bytes.data() + bytes.size(), true);
+    allocator.release(builder);
+  }
+  TEST_EQ(bytes.size(), static_cast<size_t>(regular.GetSize()));
+  TEST_EQ(memcmp(bytes.data(), regular.GetBufferPointer(), bytes.size()), 0);
+
+  // Chunks other than the first come from the heap, and so may the
+  // flattened buffer.
+  std::string str;
+  flatbuffers::container_allocator<std::string> str_allocator(str);
+  {
+    flatbuffers::FlatBufferBuilder builder(64, &str_allocator);
+    builder.SetChunkSize(256);
+    BuildLargeMonster(builder);
+    str_allocator.release(builder);
+  }
+  TEST_EQ(str.size(), static_cast<size_t>(regular.GetSize()));
+  TEST_EQ(memcmp(str.data(), regular.GetBufferPointer(), str.size()), 0);
+  flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(str.data()),
+                                 str.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+}
+
+// The tests are built with FLATBUFFERS_PERF_COUNTERS, check that everything
+// gets counted on this thread.
+void PerfCountersTest() {
+  #ifdef FLATBUFFERS_PERF_COUNTERS
+  flatbuffers::ResetPerfCounters();
+  TEST_EQ(flatbuffers::GetPerfCounters().tokens_parsed, 0U);
+
+  flatbuffers::FlatBufferBuilder fbb(8);
+  BuildLargeMonster(fbb);
+  auto counters = flatbuffers::GetPerfCounters();
+  TEST_EQ(counters.reallocations > 0, true);
+  TEST_EQ(counters.bytes_copied > 0, true);
+  TEST_EQ(counters.padding_bytes > 0, true);
+  // Most of the 100 child monsters have the same fields, and share a vtable.
+  TEST_EQ(counters.vtables_emitted + counters.vtables_deduplicated, 101U);
+  TEST_EQ(counters.vtables_deduplicated > 90, true);
+  TEST_EQ(counters.shared_string_hits, 0U);
+  flatbuffers::FlatBufferBuilder strings;
+  strings.CreateSharedString("x");
+  strings.CreateSharedString("x");
+  TEST_EQ(flatbuffers::GetPerfCounters().shared_string_hits, 1U);
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  counters = flatbuffers::GetPerfCounters();
+  TEST_EQ(counters.tables_verified, 101U);
+  TEST_EQ(counters.bytes_verified >= fbb.GetSize() / 2, true);
+
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { a:int; b:[string]; } root_type T;"
+                       "{ a: 1, b: [\"x\"] }"), true);
+  counters = flatbuffers::GetPerfCounters();
+  TEST_EQ(counters.tokens_parsed > 20, true);
+  TEST_EQ(counters.parser_allocations >= 4, true);  // Namespace, T, a and b.
+
+  flatbuffers::ResetPerfCounters();
+  TEST_EQ(flatbuffers::GetPerfCounters().tables_verified, 0U);
+  #endif
+}
+
+// Size prefixed buffers written one after the other must be read back
+// intact from a stream, whether it comes in one piece (in place) or in
+// pieces of any size.
+void BufferStreamTest() {
+  std::vector<uint64_t> stream;  // Aligned, like a mapped file.
+  size_t stream_size = 0;
+  const int kBuffers = 20;
+  for (int i = 0; i < kBuffers; i++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<uint8_t> inventory(i * 7, static_cast<uint8_t>(i));
+    auto name = fbb.CreateString("Monster" + flatbuffers::NumToString(i));
+    auto inv = fbb.CreateVector(inventory);
+    FinishSizePrefixedMonsterBuffer(fbb, CreateMonster(fbb, nullptr, 150,
+                                           static_cast<int16_t>(i), name, inv));
+    auto buf = fbb.GetBufferPointer();
+    TEST_EQ(flatbuffers::GetPrefixedSize(buf) + sizeof(flatbuffers::uoffset_t),
+            fbb.GetSize());
+    flatbuffers::Verifier verifier(buf, fbb.GetSize());
+    TEST_EQ(VerifySizePrefixedMonsterBuffer(verifier), true);
+    TEST_EQ(GetSizePrefixedMonster(buf)->hp(), i);
+    stream.resize((stream_size + fbb.GetSize() + 7) / 8);
+    memcpy(reinterpret_cast<uint8_t *>(stream.data()) + stream_size, buf,
+           fbb.GetSize());
+    stream_size += fbb.GetSize();
+  }
+  auto data = reinterpret_cast<const uint8_t *>(stream.data());
+
+  const uint8_t *buf;
+  size_t size;
+  {
+    flatbuffers::BufferStreamReader reader(VerifyMonsterBuffer);
+    reader.Append(data, stream_size);
+    int count = 0;
+    while (reader.Next(&buf, &size)) {
+      TEST_EQ(buf > data && buf + size <= data + stream_size, true);
+      TEST_EQ(GetMonster(buf)->hp(), count++);
+    }
+    TEST_EQ(count, kBuffers);
+    TEST_EQ(reader.Failed(), false);
+    TEST_EQ(reader.Pending(), 0U);
+  }
+
+  // As if read() into the same buffer over and over.
+  uint8_t chunk[64];
+  for (size_t chunk_size = 1; chunk_size <= sizeof(chunk); chunk_size++) {
+    flatbuffers::BufferStreamReader reader(VerifyMonsterBuffer);
+    int count = 0;
+    for (size_t pos = 0; pos < stream_size; pos += chunk_size) {
+      auto len = std::min(chunk_size, stream_size - pos);
+      memcpy(chunk, data + pos, len);
+      reader.Append(chunk, len);
+      while (reader.Next(&buf, &size)) {
+        TEST_EQ(GetMonster(buf)->hp(), count);
+        TEST_EQ(GetMonster(buf)->inventory()->size(),
+                static_cast<size_t>(count * 7));
+        count++;
+      }
+      TEST_EQ(reader.Failed(), false);
+    }
+    TEST_EQ(count, kBuffers);
+    TEST_EQ(reader.Pending(), 0U);
+  }
+
+  // A truncated stream leaves the start of the last buffer pending, and a
+  // buffer claiming to be too large fails it.
+  {
+    flatbuffers::BufferStreamReader reader(VerifyMonsterBuffer, 1024);
+    reader.Append(data, stream_size - 1);
+    int count = 0;
+    while (reader.Next(&buf, &size)) count++;
+    TEST_EQ(count, kBuffers - 1);
+    TEST_EQ(reader.Pending() > 0, true);
+    uint8_t huge[] = { 0, 0, 1, 0 };  // 64KB.
+    flatbuffers::BufferStreamReader strict(VerifyMonsterBuffer, 1024);
+    strict.Append(huge, sizeof(huge));
+    TEST_EQ(strict.Next(&buf, &size), false);
+    TEST_EQ(strict.Failed(), true);
+  }
+}
+
+void SharedStringTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  auto bob = builder.CreateSharedString("bob");
+  TEST_EQ(builder.CreateSharedString("bob").o, bob.o);
+  TEST_EQ(builder.CreateSharedString(std::string("bob")).o, bob.o);
+  // Prefixes and embedded zeros must not be mistaken for the same string.
+  auto bo = builder.CreateSharedString("bo");
+  TEST_EQ(bo.o != bob.o, true);
+  auto zero1 = builder.CreateSharedString("b\0x", 3);
+  auto zero2 = builder.CreateSharedString("b\0y", 3);
+  TEST_EQ(zero1.o != zero2.o, true);
+  TEST_EQ(builder.CreateSharedString("b\0y", 3).o, zero2.o);
+
+  // Enough strings to grow the pool a few times, all shared.
+  std::vector<flatbuffers::Offset<flatbuffers::String>> offsets;
+  for (int i = 0; i < 1000; i++) {
+    offsets.push_back(builder.CreateSharedString(flatbuffers::NumToString(i)));
+  }
+  auto size = builder.GetSize();
+  for (int i = 0; i < 1000; i++) {
+    TEST_EQ(builder.CreateSharedString(flatbuffers::NumToString(i)).o,
+            offsets[i].o);
+  }
+  TEST_EQ(builder.GetSize(), size);
+
+  // With a bounded pool, the string that was not shared again is forgotten.
+  builder.Clear();
+  builder.SetSharedStringCapacity(2);
+  auto a = builder.CreateSharedString("a");
+  auto b = builder.CreateSharedString("b");
+  TEST_EQ(builder.CreateSharedString("a").o, a.o);
+  builder.CreateSharedString("c");
+  TEST_EQ(builder.CreateSharedString("a").o, a.o);
+  auto b2 = builder.CreateSharedString("b");
+  TEST_EQ(b2.o != b.o, true);
+  auto vec = builder.CreateVector(std::vector<flatbuffers::Offset<
+    flatbuffers::String>>({ a, b, b2 }));
+  builder.Finish(vec);
+  auto strings = flatbuffers::GetRoot<flatbuffers::Vector<flatbuffers::Offset<
+    flatbuffers::String>>>(builder.GetBufferPointer());
+  TEST_EQ_STR(strings->Get(0)->c_str(), "a");
+  TEST_EQ_STR(strings->Get(1)->c_str(), "b");
+  TEST_EQ_STR(strings->Get(2)->c_str(), "b");
+
+  // Copies of strings from another buffer are stored once per source string.
+  flatbuffers::FlatBufferBuilder copies;
+  auto copy_a = copies.CreateStringCopy(strings->Get(0));
+  TEST_EQ(copies.CreateStringCopy(strings->Get(0)).o, copy_a.o);
+  auto copy_b = copies.CreateStringCopy(strings->Get(1));
+  TEST_EQ(copies.CreateStringCopy(strings->Get(2)).o != copy_b.o, true);
+  copies.Finish(copies.CreateVector(std::vector<flatbuffers::Offset<
+    flatbuffers::String>>({ copy_a, copy_b, copy_a })));
+  strings = flatbuffers::GetRoot<flatbuffers::Vector<flatbuffers::Offset<
+    flatbuffers::String>>>(copies.GetBufferPointer());
+  TEST_EQ_STR(strings->Get(0)->c_str(), "a");
+  TEST_EQ_STR(strings->Get(1)->c_str(), "b");
+  TEST_EQ(strings->Get(2), strings->Get(0));
+}
+
+// Vectors of strings and tables long enough for the SIMD paths of the
+// Verifier, with corruptions in every position.
+void VerifierVectorsTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<std::string> strings;
+  for (int i = 0; i < 37; i++) {
+    strings.push_back(std::string(static_cast<size_t>(i), 'x') + "\xC3\xA9");
+  }
+  auto strings_off = builder.CreateVectorOfStrings(strings);
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 19; i++) {
+    monsters.push_back(CreateMonster(builder, nullptr, 150, 80,
+                                     builder.CreateString("m")));
+  }
+  auto monsters_off = builder.CreateVector(monsters);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 150, 80,
+                                             builder.CreateString("MyMonster"),
+                                             0, Color_Blue, Any_NONE, 0,
+                                             0, strings_off, monsters_off));
+  std::vector<uint8_t> buf(builder.GetBufferPointer(),
+                           builder.GetBufferPointer() + builder.GetSize());
+
+  flatbuffers::Verifier verifier(buf.data(), buf.size(), 64, 1000000, true);
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(verifier.GetComputedSize(), buf.size());
+
+  // The bulk offset check must catch an offset pointing outside the buffer,
+  // or to where only part of a string would fit, in any position.
+  // (This test enables FLATBUFFERS_DEBUG_VERIFICATION_FAILURE, so it can't
+  // run a Verifier on broken buffers.)
+  auto monster = GetMutableMonster(buf.data());
+  auto strings_vec = monster->mutable_testarrayofstring();
+  auto data = const_cast<uint8_t *>(strings_vec->Data());
+  auto pos = static_cast<size_t>(data - buf.data());
+  const size_t min_size = sizeof(flatbuffers::uoffset_t) + 1;
+  TEST_EQ(flatbuffers::OffsetTargetsInRange(data, strings_vec->size(), pos,
+                                            buf.size(), min_size), true);
+  for (flatbuffers::uoffset_t i = 0; i < strings_vec->size(); i++) {
+    auto elem = data + i * sizeof(flatbuffers::uoffset_t);
+    auto off = flatbuffers::ReadScalar<flatbuffers::uoffset_t>(elem);
+    auto to_end = static_cast<flatbuffers::uoffset_t>(
+                    buf.data() + buf.size() - elem);
+    flatbuffers::uoffset_t bad[] = { 0x80000000, 0xFFFFFFFF, to_end,
+                                     to_end - 4 };
+    for (size_t j = 0; j < sizeof(bad) / sizeof(bad[0]); j++) {
+      flatbuffers::WriteScalar(elem, bad[j]);
+      TEST_EQ(flatbuffers::OffsetTargetsInRange(data, strings_vec->size(), pos,
+                                                buf.size(), min_size), false);
+    }
+    flatbuffers::WriteScalar(elem, to_end - 5);
+    TEST_EQ(flatbuffers::OffsetTargetsInRange(data, strings_vec->size(), pos,
+                                              buf.size(), min_size), true);
+    flatbuffers::WriteScalar(elem, off);
+  }
+
+  // Invalid UTF-8 is accepted unless asked for.
+  auto str = strings_vec->GetMutableObject(36);
+  str->Data()[str->size() - 1] = 'x';
+  flatbuffers::Verifier lenient(buf.data(), buf.size());
+  TEST_EQ(VerifyMonsterBuffer(lenient), true);
+
+  struct { const char *str; bool valid; } utf8_tests[] = {
+    { "", true },
+    { "plain ascii that is longer than one or two simd registers", true },
+    { "\xC3\xA9t\xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80", true },
+    { "long enough ascii prefix for a vector load, then \xE2\x82\xAC", true },
+    { "\xC0\xAF", false },          // Overlong.
+    { "\xE0\x80\xAF", false },      // Overlong.
+    { "\xED\xA0\x80", false },      // Surrogate.
+    { "\xF4\x90\x80\x80", false },  // Past U+10FFFF.
+    { "\xE2\x82", false },          // Truncated.
+    { "\x80", false },              // Stray continuation byte.
+    { "\xF8\x88\x80\x80\x80", false },  // 5 byte sequence.
+    { "long enough ascii prefix for a vector load, then \xE2(\xAC", false },
+  };
+  for (size_t i = 0; i < sizeof(utf8_tests) / sizeof(utf8_tests[0]); i++) {
+    auto s = reinterpret_cast<const uint8_t *>(utf8_tests[i].str);
+    TEST_EQ(flatbuffers::IsValidUTF8(s, strlen(utf8_tests[i].str)),
+            utf8_tests[i].valid);
+  }
+}
+
+// Verifying with a thread pool must reach the same verdict, table count and
+// computed size as serially, also when vectors of tables nest.
+void ParallelVerifierTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> outer;
+  for (int i = 0; i < 40; i++) {
+    std::vector<flatbuffers::Offset<Monster>> inner;
+    for (int j = 0; j < 30; j++) {
+      inner.push_back(CreateMonster(builder, nullptr, 150, 80,
+                                    builder.CreateString("inner")));
+    }
+    auto inner_vec = builder.CreateVector(inner);
+    outer.push_back(CreateMonster(builder, nullptr, 150, 80,
+                                  builder.CreateString("outer"), 0, Color_Blue,
+                                  Any_NONE, 0, 0, 0, inner_vec));
+  }
+  auto outer_vec = builder.CreateVector(outer);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 150, 80,
+                                             builder.CreateString("root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0, 0,
+                                             outer_vec));
+  auto buf = builder.GetBufferPointer();
+  auto size = builder.GetSize();
+
+  flatbuffers::Verifier serial(buf, size);
+  TEST_EQ(VerifyMonsterBuffer(serial), true);
+
+  flatbuffers::WorkStealingPool pool(3);
+  TEST_EQ(pool.Concurrency(), 4U);
+  for (size_t min_tables = 1; min_tables <= 64; min_tables *= 4) {
+    flatbuffers::Verifier parallel(buf, size);
+    parallel.SetTaskRunner(&pool, min_tables);
+    TEST_EQ(VerifyMonsterBuffer(parallel), true);
+    TEST_EQ(parallel.GetComputedSize(), serial.GetComputedSize());
+  }
+  // 1 + 40 + 40 * 30 tables, so a budget of exactly that is enough.
+  flatbuffers::Verifier exact(buf, size, 64, 1241);
+  exact.SetTaskRunner(&pool, 2);
+  TEST_EQ(VerifyMonsterBuffer(exact), true);
+
+  // Nested ForEach calls from inside tasks, from several threads at once.
+  std::atomic<int> sum(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.push_back(std::thread([&]() {
+      struct Context { flatbuffers::WorkStealingPool *pool;
+                       std::atomic<int> *sum; };
+      Context ctx = { &pool, &sum };
+      pool.ForEach(10, [](void *c, size_t) {
+        auto outer_ctx = reinterpret_cast<Context *>(c);
+        outer_ctx->pool->ForEach(10, [](void *c2, size_t i) {
+          *reinterpret_cast<std::atomic<int> *>(c2) += static_cast<int>(i);
+        }, outer_ctx->sum);
+      }, &ctx);
+    }));
+  }
+  for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+  TEST_EQ(sum.load(), 4 * 10 * 45);
+}
+
+// Subtrees built on other threads, spliced into one buffer.
+void SpliceBufferTest() {
+  const size_t kChildren = 8;
+  flatbuffers::FlatBufferBuilder children[kChildren];
+  flatbuffers::WorkStealingPool pool(3);
+  pool.ForEach(kChildren, [](void *ctx, size_t i) {
+    auto &fbb = reinterpret_cast<flatbuffers::FlatBufferBuilder *>(ctx)[i];
+    if (i % 3 == 0) fbb.SetChunkSize(64);
+    std::vector<flatbuffers::Offset<Monster>> minions;
+    for (int j = 0; j < 3; j++) {
+      minions.push_back(CreateMonster(fbb, nullptr, 150, 80,
+                                      fbb.CreateString("minion")));
+    }
+    uint8_t inventory[] = { 1, 2, 3 };
+    Vec3 pos(1, 2, static_cast<float>(i), 0, Color_Red, Test(5, 6));
+    auto root = CreateMonster(fbb, &pos, 150, 80,
+                              fbb.CreateString(flatbuffers::NumToString(i)),
+                              fbb.CreateVector(inventory, 3), Color_Blue,
+                              Any_NONE, 0, 0, 0, fbb.CreateVector(minions));
+    // Some with a file identifier, some without.
+    if (i % 2) FinishMonsterBuffer(fbb, root);
+    else fbb.Finish(root);
+  }, children);
+
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.CreateString("x");  // So the children don't start out aligned.
+  std::vector<flatbuffers::Offset<Monster>> spliced;
+  for (size_t i = 0; i < kChildren; i++) {
+    if (i == kChildren - 1) {
+      // From a plain buffer. Vec3 needs 16 byte alignment.
+      spliced.push_back(fbb.SpliceBuffer<Monster>(
+        children[i].GetBufferPointer(), children[i].GetSize(), 16, i % 2 != 0));
+    } else {
+      spliced.push_back(fbb.SpliceBuffer<Monster>(children[i], i % 2 != 0));
+    }
+  }
+  // This one's vtable is the same as that of the minions.
+  auto parent_size = fbb.GetSize();
+  auto name = fbb.CreateString("minion");
+  auto name_size = fbb.GetSize() - parent_size;
+  CreateMonster(fbb, nullptr, 150, 80, name);
+  // Table: vtable offset, name offset, hp and mana.
+  TEST_EQ(fbb.GetSize() - parent_size - name_size, 12u);
+  FinishMonsterBuffer(fbb, CreateMonster(fbb, nullptr, 150, 80,
+                                         fbb.CreateString("root"), 0,
+                                         Color_Blue, Any_NONE, 0, 0, 0,
+                                         fbb.CreateVector(spliced)));
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monsters = GetMonster(fbb.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(monsters->size(), kChildren);
+  for (size_t i = 0; i < kChildren; i++) {
+    auto monster = monsters->Get(static_cast<flatbuffers::uoffset_t>(i));
+    TEST_EQ_STR(monster->name()->c_str(), flatbuffers::NumToString(i).c_str());
+    TEST_EQ(reinterpret_cast<size_t>(monster->pos()) % 16, 0u);
+    TEST_EQ(monster->pos()->z(), static_cast<float>(i));
+    TEST_EQ(monster->pos()->test3().b(), 6);
+    TEST_EQ(monster->inventory()->Get(2), 3);
+    TEST_EQ(monster->testarrayoftables()->size(), 3u);
+    TEST_EQ_STR(monster->testarrayoftables()->Get(1)->name()->c_str(),
+                "minion");
+  }
+
+  // Chunked children with a file identifier, and maybe a size prefix, such
+  // that the header lands in a chunk of its own or shares one with other
+  // data. Each is spliced from the builder and from the finished buffer.
+  for (size_t name_length = 0; name_length < 32; name_length++) {
+    bool size_prefixed = name_length >= 16;
+    flatbuffers::FlatBufferBuilder child(16);
+    child.SetChunkSize(16);
+    auto child_name = std::string(name_length % 16, 'c');
+    auto child_root = CreateMonster(child, nullptr, 150, 80,
+                                    child.CreateString(child_name));
+    if (size_prefixed)
+      child.FinishSizePrefixed(child_root, MonsterIdentifier());
+    else
+      FinishMonsterBuffer(child, child_root);
+    flatbuffers::FlatBufferBuilder parent;
+    flatbuffers::Offset<Monster> spliced_children[2];
+    spliced_children[0] = parent.SpliceBuffer<Monster>(child, true);
+    child.FlattenBuffer();
+    spliced_children[1] = parent.SpliceBuffer<Monster>(
+        child.GetBufferPointer(), child.GetSize(), 16, true, size_prefixed);
+    FinishMonsterBuffer(parent, CreateMonster(parent, nullptr, 150, 80,
+                                              parent.CreateString("parent"),
+                                              0, Color_Blue, Any_NONE, 0, 0, 0,
+                                              parent.CreateVector(
+                                                spliced_children, 2)));
+    flatbuffers::Verifier parent_verifier(parent.GetBufferPointer(),
+                                          parent.GetSize());
+    TEST_EQ(VerifyMonsterBuffer(parent_verifier), true);
+    auto parent_children = GetMonster(parent.GetBufferPointer())->
+                             testarrayoftables();
+    for (flatbuffers::uoffset_t i = 0; i < 2; i++) {
+      TEST_EQ_STR(parent_children->Get(i)->name()->c_str(),
+                  child_name.c_str());
+    }
+  }
+
+  // A child with 64-bit offsets, whose Finish() moved its vtables away from
+  // the end: tables of the parent must still share them correctly.
+  namespace o64 = Offset64Test;
+  uint8_t bytes[] = { 1, 2, 3 };
+  flatbuffers::FlatBufferBuilder wide_child;
+  o64::CreateBlob(wide_child, wide_child.CreateString("unused"));
+  wide_child.Finish(o64::CreateBlob(wide_child,
+                                    wide_child.CreateString("child"),
+                                    wide_child.CreateVector64(bytes, 3)));
+  flatbuffers::FlatBufferBuilder wide_parent;
+  auto spliced_blob = wide_parent.SpliceBuffer<o64::Blob>(wide_child);
+  // The same vtable as the unused one in the child.
+  auto parent_blob = o64::CreateBlob(wide_parent,
+                                     wide_parent.CreateString("parent"));
+  auto wide_end = wide_parent.GetCurrentBufferPointer() + wide_parent.GetSize();
+  auto parent_table = wide_end - parent_blob.o;
+  auto parent_vtable = parent_table -
+    flatbuffers::ReadScalar<flatbuffers::soffset_t>(parent_table);
+  TEST_EQ(parent_vtable < parent_table, false);  // Shared, not its own.
+  auto child_blob = reinterpret_cast<const o64::Blob *>(
+                      wide_end - spliced_blob.o);
+  TEST_EQ_STR(child_blob->name()->c_str(), "child");
+  TEST_EQ(child_blob->data()->Get(2), 3);
+  wide_parent.Finish(parent_blob);
+  flatbuffers::Verifier wide_verifier(wide_parent.GetBufferPointer(),
+                                      wide_parent.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(wide_verifier), true);
+  TEST_EQ_STR(o64::GetBlob(wide_parent.GetBufferPointer())->name()->c_str(),
+              "parent");
+}
+
+void MappedBufferTest() {
+  std::string loaded;
+  TEST_EQ(flatbuffers::LoadFile("tests/monsterdata_test.mon", true, &loaded),
+          true);
+
+  flatbuffers::MappedBuffer mapped;
+  TEST_EQ(mapped.Map("tests/no_such_file.mon"), false);
+  TEST_EQ(mapped.MapAndVerify("tests/monsterdata_test.mon",
+                              VerifyMonsterBuffer,
+                              flatbuffers::MappedBuffer::kAdviceRandom), true);
+  TEST_EQ(mapped.size(), loaded.size());
+  TEST_EQ(memcmp(mapped.data(), loaded.data(), loaded.size()), 0);
+  TEST_EQ_STR(GetMonster(mapped.data())->name()->c_str(), "MyMonster");
+  TEST_EQ(mapped.Advise(flatbuffers::MappedBuffer::kAdviceWillNeed, 3, 10),
+          true);
+
+  // Moving keeps the data valid.
+  auto data = mapped.data();
+  flatbuffers::MappedBuffer moved(std::move(mapped));
+  TEST_EQ(moved.data(), data);
+  TEST_EQ(mapped.data() == nullptr, true);
+  TEST_EQ(mapped.size(), 0U);
+
+  // Failed verification leaves nothing mapped.
+  TEST_EQ(moved.MapAndVerify("tests/monsterdata_test.mon",
+                             [](flatbuffers::Verifier &) { return false; }),
+          false);
+  TEST_EQ(moved.data() == nullptr, true);
+}
+
+// LookupByKey and LookupByKeyIndex must find every key, and nothing else,
+// for all vector sizes up to a few complete trees.
+void KeyIndexLookupTest() {
+  for (size_t n = 0; n < 70; n++) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<KeyIndexTest::Entry>> entries;
+    // Keys 10, 20, ... added in reverse, so the sort has work to do.
+    for (size_t i = n; i > 0; i--) {
+      entries.push_back(KeyIndexTest::CreateEntry(builder, i * 10,
+        builder.CreateString(flatbuffers::NumToString(i * 10))));
+    }
+    auto entries_vec = builder.CreateVectorOfSortedTables(&entries);
+    auto index = builder.CreateKeyIndex(entries);
+    builder.Finish(KeyIndexTest::CreateCatalog(builder, entries_vec, index));
+
+    auto catalog = flatbuffers::GetRoot<KeyIndexTest::Catalog>(
+                     builder.GetBufferPointer());
+    auto vec = catalog->entries();
+    TEST_EQ(catalog->entries_index()->size(), n);
+    for (uint64_t key = 0; key <= n * 10 + 10; key += 5) {
+      bool present = key && key % 10 == 0 && key <= n * 10;
+      auto by_key = vec->LookupByKey(key);
+      auto by_index = vec->LookupByKeyIndex(catalog->entries_index(), key);
+      TEST_EQ(by_key != nullptr, present);
+      TEST_EQ(by_index != nullptr, present);
+      if (present) {
+        TEST_EQ(by_key->id(), key);
+        TEST_EQ(by_index->id(), key);
+        TEST_EQ_STR(by_index->value()->c_str(),
+                    flatbuffers::NumToString(key).c_str());
+      }
+    }
+  }
+}
+
+// Sorts tables made by `create(builder, i)` with CreateVectorOfSortedTables,
+// and checks the result against std::stable_sort.
+template<typename T, typename F> void CheckSortedTables(
+    flatbuffers::FlatBufferBuilder &builder, size_t n, F create) {
+  std::vector<flatbuffers::Offset<T>> tables;
+  for (size_t i = 0; i < n; i++) tables.push_back(create(builder, i));
+  auto expected = tables;
+  std::stable_sort(expected.begin(), expected.end(),
+                   [&](flatbuffers::Offset<T> a, flatbuffers::Offset<T> b) {
+    return reinterpret_cast<const T *>(builder.GetCurrentBufferPointer() +
+             builder.GetSize() - a.o)->KeyCompareLessThan(
+           reinterpret_cast<const T *>(builder.GetCurrentBufferPointer() +
+             builder.GetSize() - b.o));
+  });
+  builder.CreateVectorOfSortedTables(&tables);
+  for (size_t i = 0; i < n; i++) TEST_EQ(tables[i].o, expected[i].o);
+}
+
+// A table as generated before GetKey() existed, with only a comparison.
+struct LegacyKeyedTable : private flatbuffers::Table {
+  int32_t id() const { return GetField<int32_t>(4, 0); }
+  bool KeyCompareLessThan(const LegacyKeyedTable *o) const {
+    return id() < o->id();
+  }
+};
+
+void SortedTablesTest() {
+  using namespace KeyIndexTest;
+  flatbuffers::FlatBufferBuilder builder;
+  for (size_t n = 0; n < 600; n += 199) {
+    // Few distinct keys, so there are plenty of ties.
+    CheckSortedTables<Entry>(builder, n, [](
+        flatbuffers::FlatBufferBuilder &b, size_t) {
+      return CreateEntry(b, lcg_rand() % 50 * 0x10001);
+    });
+    CheckSortedTables<Event>(builder, n, [](
+        flatbuffers::FlatBufferBuilder &b, size_t) {
+      return CreateEvent(b, (static_cast<int64_t>(lcg_rand() % 50) - 25) *
+                            0x100000001LL);
+    });
+    CheckSortedTables<Change>(builder, n, [](
+        flatbuffers::FlatBufferBuilder &b, size_t) {
+      return CreateChange(b, static_cast<int16_t>(lcg_rand() % 50 - 25));
+    });
+    CheckSortedTables<Reading>(builder, n, [](
+        flatbuffers::FlatBufferBuilder &b, size_t i) {
+      // -0.0 and 0.0 must be treated as equal.
+      auto value = (static_cast<double>(lcg_rand() % 50) - 25) / 4;
+      return CreateReading(b, i % 7 ? value : i % 2 ? -0.0 : 0.0);
+    });
+    CheckSortedTables<LegacyKeyedTable>(builder, n, [](
+        flatbuffers::FlatBufferBuilder &b, size_t) {
+      auto start = b.StartTable();
+      b.AddElement<int32_t>(4, static_cast<int32_t>(lcg_rand() % 50), 0);
+      return flatbuffers::Offset<LegacyKeyedTable>(b.EndTable(start, 1));
+    });
+  }
+
+  // String keys, sorted serially and in parallel. The names share prefixes
+  // of various lengths, some longer than 8 bytes.
+  flatbuffers::WorkStealingPool pool(3);
+  const char *prefixes[] = { "", "a", "ab", "abcdefg", "abcdefgh",
+                             "abcdefghij", "\xC3\xA9" };
+  for (int parallel = 0; parallel < 2; parallel++) {
+    builder.SetTaskRunner(parallel ? &pool : nullptr, 8);
+    for (size_t n = 0; n < 600; n += 199) {
+      CheckSortedTables<Monster>(builder, n, [&](
+          flatbuffers::FlatBufferBuilder &b, size_t) {
+        auto name = prefixes[lcg_rand() % 7] +
+                    std::string(lcg_rand() % 3, 'a' + lcg_rand() % 3);
+        return CreateMonster(b, nullptr, 0, 0, b.CreateString(name));
+      });
+    }
+  }
+}
+
+// fl::CreateSprite writes the table in one go when all fields are present, which
+// must give the same bytes as adding them one by one with the fl::SpriteBuilder.
+void PrecomputedLayoutTest() {
+  namespace fl = FixedLayoutTest;
+  fl::Vec3 pos(1, 2, 3);
+  fl::Ability ability(7, 9);
+  // All fields set, one at its default, and the same with ForceDefaults.
+  for (int variant = 0; variant < 3; variant++) {
+    int16_t hp = variant ? 100 : 80;
+    // Vary the alignment of the buffer the table starts at.
+    for (size_t pad = 0; pad < 8; pad++) {
+      flatbuffers::FlatBufferBuilder fast, slow;
+      flatbuffers::FlatBufferBuilder *builders[] = { &fast, &slow };
+      for (int b = 0; b < 2; b++) {
+        auto &fbb = *builders[b];
+        fbb.ForceDefaults(variant == 2);
+        fbb.CreateString(std::string(pad, 'x'));
+        // Twice, so the second one reuses the vtable.
+        flatbuffers::Offset<fl::Sprite> root;
+        for (uint64_t id = 0; id < 2; id++) {
+          if (b == 0) {
+            root = fl::CreateSprite(fbb, &pos, 200, hp, fl::Color_Red,
+                                    1234 + id, -1, 2, -3, 4, 5.5f, 6.5f, true,
+                                    &ability);
+          } else {
+            fl::SpriteBuilder sb(fbb);
+            sb.add_testhashu64_fnv1(4);
+            sb.add_testhashs64_fnv1(-3);
+            sb.add_id(1234 + id);
+            sb.add_ability(&ability);
+            sb.add_testf2(6.5f);
+            sb.add_testf(5.5f);
+            sb.add_testhashu32_fnv1(2);
+            sb.add_testhashs32_fnv1(-1);
+            sb.add_pos(&pos);
+            sb.add_hp(hp);
+            sb.add_mana(200);
+            sb.add_testbool(true);
+            sb.add_color(fl::Color_Red);
+            root = sb.Finish();
+          }
+        }
+        fl::FinishSpriteBuffer(fbb, root);
+      }
+      TEST_EQ(fast.GetSize(), slow.GetSize());
+      TEST_EQ(memcmp(fast.GetBufferPointer(), slow.GetBufferPointer(),
+                     fast.GetSize()), 0);
+
+      flatbuffers::Verifier verifier(fast.GetBufferPointer(), fast.GetSize());
+      TEST_EQ(fl::VerifySpriteBuffer(verifier), true);
+      auto sprite = fl::GetSprite(fast.GetBufferPointer());
+      TEST_EQ(sprite->hp(), hp);
+      TEST_EQ(sprite->id(), 1235u);
+      TEST_EQ(sprite->color(), fl::Color_Red);
+      TEST_EQ(sprite->testbool(), true);
+      TEST_EQ(sprite->pos()->z(), 3);
+      TEST_EQ(sprite->ability()->distance(), 9);
+    }
+  }
+
+  // No fixed layout, this always goes through PoseBuilder.
+  flatbuffers::FlatBufferBuilder fbb;
+  fl::Quat rotation(0, 0, 0, 1);
+  fbb.Finish(fl::CreatePose(fbb, 42, &rotation));
+  auto pose = flatbuffers::GetRoot<fl::Pose>(fbb.GetBufferPointer());
+  TEST_EQ(pose->time(), 42u);
+  TEST_EQ(pose->rotation()->w(), 1);
+}
+
+void Vector64Test() {
+  namespace o64 = Offset64Test;
+  flatbuffers::FlatBufferBuilder fbb;
+  // Vectors with 64-bit offsets can be made at any time, even first.
+  std::vector<uint8_t> data(1000);
+  for (size_t i = 0; i < data.size(); i++) data[i] = static_cast<uint8_t>(i);
+  auto data_off = fbb.CreateVector64(data);
+  o64::Point points[] = { o64::Point(1, 2), o64::Point(3, 4) };
+  auto points_off = fbb.CreateVectorOfStructs64(points, 2);
+  int64_t ids[] = { 7, 8, 9 };
+  fbb.Finish(o64::CreateBlob(fbb, fbb.CreateString("blob"), data_off,
+                             points_off, fbb.CreateVector(ids, 3)));
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(verifier), true);
+  auto blob = o64::GetBlob(fbb.GetBufferPointer());
+  TEST_EQ_STR(blob->name()->c_str(), "blob");
+  TEST_EQ(blob->data()->size(), 1000u);
+  TEST_EQ(blob->data()->Get(999), 999 % 256);
+  TEST_EQ(blob->points()->size(), 2u);
+  TEST_EQ(blob->points()->Get(1)->y(), 4);
+  TEST_EQ(blob->ids()->Get(2), 9);
+  // They end up after everything else.
+  auto end = fbb.GetBufferPointer() + fbb.GetSize();
+  TEST_EQ(blob->ids()->Data() < blob->points()->Data(), true);
+  TEST_EQ(blob->data()->Data() + blob->data()->size() <= end, true);
+  TEST_EQ(reinterpret_cast<size_t>(blob->points()->Data()) % 8, 0u);
+
+  // A 64-bit offset that would wrap around to another spot in the buffer,
+  // or lead out of it, is caught before it is followed. (This test enables
+  // FLATBUFFERS_DEBUG_VERIFICATION_FAILURE, so it can't run a Verifier on
+  // broken buffers.)
+  std::vector<uint8_t> bad(fbb.GetBufferPointer(),
+                           fbb.GetBufferPointer() + fbb.GetSize());
+  auto data_field = flatbuffers::GetMutableRoot<flatbuffers::Table>(
+                      bad.data())->GetAddressOf(o64::Blob::VT_DATA);
+  auto bad_end = bad.data() + bad.size();
+  TEST_EQ(flatbuffers::Offset64InRange(data_field, bad_end), true);
+  flatbuffers::uoffset64_t bad_offsets[] = {
+    0, static_cast<flatbuffers::uoffset64_t>(bad_end - data_field),
+    ~static_cast<flatbuffers::uoffset64_t>(7)
+  };
+  for (size_t i = 0; i < 3; i++) {
+    flatbuffers::WriteScalar(data_field, bad_offsets[i]);
+    TEST_EQ(flatbuffers::Offset64InRange(data_field, bad_end), false);
+  }
+
+  // The same buffer with chunked storage, which the vectors with 64-bit
+  // offsets are appended across, and with a size prefix covering them.
+  for (int size_prefixed = 0; size_prefixed < 2; size_prefixed++) {
+    flatbuffers::FlatBufferBuilder chunked(64);
+    chunked.SetChunkSize(64);
+    auto chunked_data = chunked.CreateVector64(data);
+    auto chunked_points = chunked.CreateVectorOfStructs64(points, 2);
+    auto chunked_blob = o64::CreateBlob(chunked, chunked.CreateString("blob"),
+                                        chunked_data, chunked_points,
+                                        chunked.CreateVector(ids, 3));
+    if (size_prefixed)
+      o64::FinishSizePrefixedBlobBuffer(chunked, chunked_blob);
+    else
+      o64::FinishBlobBuffer(chunked, chunked_blob);
+    TEST_EQ(chunked.GetBufferSlices().size() > 1, true);
+    TEST_EQ(chunked.GetSize64(), chunked.GetSize());
+    chunked.FlattenBuffer();
+    auto chunked_buf = chunked.GetBufferPointer();
+    if (size_prefixed) {
+      TEST_EQ(flatbuffers::ReadScalar<flatbuffers::uoffset_t>(chunked_buf),
+              chunked.GetSize() - sizeof(flatbuffers::uoffset_t));
+      flatbuffers::Verifier chunked_verifier(chunked_buf, chunked.GetSize());
+      TEST_EQ(o64::VerifySizePrefixedBlobBuffer(chunked_verifier), true);
+      auto chunked_root = o64::GetSizePrefixedBlob(chunked_buf);
+      TEST_EQ(memcmp(chunked_root->data()->Data(), data.data(), data.size()),
+              0);
+      TEST_EQ(chunked_root->points()->Get(1)->y(), 4);
+    } else {
+      TEST_EQ(chunked.GetSize(), fbb.GetSize());
+      TEST_EQ(memcmp(chunked_buf, fbb.GetBufferPointer(), fbb.GetSize()), 0);
+    }
+  }
+
+  // The object API.
+  o64::BlobT blobt(blob);
+  TEST_EQ(blobt.data == data, true);
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.Finish(blobt.Pack(fbb2));
+  flatbuffers::Verifier verifier2(fbb2.GetBufferPointer(), fbb2.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(verifier2), true);
+  TEST_EQ(o64::GetBlob(fbb2.GetBufferPointer())->points()->Get(0)->x(), 1);
+  // Untouched vectors with 64-bit offsets are copied as is.
+  o64::BlobLazyT lazy(blob);
+  lazy.name() = "lazy";
+  flatbuffers::FlatBufferBuilder fbb5;
+  fbb5.Finish(lazy.Pack(fbb5));
+  flatbuffers::Verifier verifier5(fbb5.GetBufferPointer(), fbb5.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(verifier5), true);
+  auto blob5 = o64::GetBlob(fbb5.GetBufferPointer());
+  TEST_EQ_STR(blob5->name()->c_str(), "lazy");
+  TEST_EQ(memcmp(blob5->data()->Data(), data.data(), data.size()), 0);
+  TEST_EQ(blob5->points()->Get(1)->y(), 4);
+
+  // Text, and reflection through the schema the parser serializes.
+  std::string schemafile;
+  TEST_EQ(flatbuffers::LoadFile("tests/offset64_test.fbs", false,
+                                &schemafile), true);
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse(schemafile.c_str()), true);
+  std::string json;
+  GenerateText(parser, fbb.GetBufferPointer(), &json);
+  TEST_EQ(parser.Parse(json.c_str()), true);
+  std::string json2;
+  GenerateText(parser, parser.builder_.GetBufferPointer(), &json2);
+  TEST_EQ_STR(json2.c_str(), json.c_str());
+  flatbuffers::Verifier verifier3(parser.builder_.GetBufferPointer(),
+                                  parser.builder_.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(verifier3), true);
+
+  parser.Serialize();
+  auto &schema = *reflection::GetSchema(parser.builder_.GetBufferPointer());
+  TEST_EQ(schema.root_table()->fields()->LookupByKey("data")->offset64(),
+          true);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(flatbuffers::CopyTable(fbb3, schema, *schema.root_table(),
+                                     *flatbuffers::GetAnyRoot(
+                                       fbb.GetBufferPointer())));
+  flatbuffers::Verifier verifier4(fbb3.GetBufferPointer(), fbb3.GetSize());
+  TEST_EQ(o64::VerifyBlobBuffer(verifier4), true);
+  auto copy = o64::GetBlob(fbb3.GetBufferPointer());
+  TEST_EQ(memcmp(copy->data()->Data(), data.data(), data.size()), 0);
+  TEST_EQ(copy->points()->Get(1)->x(), 3);
+  auto &blob_table = *flatbuffers::GetAnyRoot(fbb.GetBufferPointer());
+  auto fields = schema.root_table()->fields();
+  auto any_data = flatbuffers::GetFieldV64<uint8_t>(
+                    blob_table, *fields->LookupByKey("data"));
+  TEST_EQ(any_data->size(), 1000u);
+  TEST_EQ(any_data->Get(999), 999 % 256);
+  auto any_ids = flatbuffers::GetFieldV<int64_t>(blob_table,
+                                                 *fields->LookupByKey("ids"));
+  TEST_EQ(any_ids->Get(2), 9);
+
+  TEST_EQ(parser.Parse("table T { s:[string] (offset64); }"), false);
+}
+
+// A tree of ArenaTest::NodeT, `depth` levels deep.
+void BuildArenaTestNode(ArenaTest::NodeT *node, int depth) {
+  namespace at = ArenaTest;
+  node->name.assign("node");
+  node->name += flatbuffers::NumToString(depth).c_str();
+  node->pos = at::Vec2(1, static_cast<float>(depth));
+  for (int i = 0; i < 10; i++) {
+    node->values.push_back(i * depth);
+    node->flags.push_back(i % 3 == 0);
+    node->tags.push_back(flatbuffers::arena_string(i + 1, 'a' + i));
+    node->points.push_back(at::Vec2(static_cast<float>(i), 0));
+  }
+  at::LeafT leaf;
+  leaf.value = depth;
+  node->payload = leaf;
+  if (!depth) return;
+  node->children.resize(3);
+  for (auto it = node->children.begin(); it != node->children.end(); ++it)
+    BuildArenaTestNode(&*it, depth - 1);
+  BuildArenaTestNode(node->first.create(), depth - 1);
+}
+
+void ArenaObjectApiTest() {
+  namespace at = ArenaTest;
+  // Outside of an ArenaScope, these types use the heap.
+  TEST_EQ(flatbuffers::Arena::Current() == nullptr, true);
+  at::NodeT tree;
+  BuildArenaTestNode(&tree, 3);
+  flatbuffers::FlatBufferBuilder fbb;
+  fbb.Finish(tree.Pack(fbb));
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(at::VerifyNodeBuffer(verifier), true);
+  auto root = at::GetNode(fbb.GetBufferPointer());
+
+  flatbuffers::Arena arena(1024);
+  for (int run = 0; run < 2; run++) {
+    {
+      flatbuffers::ArenaScope scope(&arena);
+      TEST_EQ(flatbuffers::Arena::Current() == &arena, true);
+      // Destroyed before the reset below.
+      at::NodeT node(root);
+      TEST_EQ(arena.BytesUsed() > fbb.GetSize(), true);
+      TEST_EQ_STR(node.name.c_str(), "node3");
+      TEST_EQ(node.children.size(), 3u);
+      TEST_EQ(node.first->pos->y(), 2);
+      TEST_EQ(node.first->children[2].tags[9].size(), 10u);
+      TEST_EQ(node.children[1].children[0].flags[3], true);
+      TEST_EQ(node.children[1].payload.AsLeaf()->value, 2);
+      // Objects from the arena may be copied to the heap.
+      at::NodeT copy;
+      {
+        flatbuffers::ArenaScope no_arena(nullptr);
+        copy = node;
+      }
+      flatbuffers::FlatBufferBuilder fbb2;
+      fbb2.Finish(node.Pack(fbb2));
+      TEST_EQ(fbb2.GetSize(), fbb.GetSize());
+      TEST_EQ(memcmp(fbb2.GetBufferPointer(), fbb.GetBufferPointer(),
+                     fbb.GetSize()), 0);
+      // Or abandoned, leaving them to the arena.
+      auto abandoned = new at::NodeT(root);
+      TEST_EQ(abandoned->first->first->points.size(), 10u);
+    }
+    TEST_EQ(flatbuffers::Arena::Current() == nullptr, true);
+    arena.Reset();
+    TEST_EQ(arena.BytesUsed(), 0u);
+  }
+
+  // Any alignment is honored, from the heap as well as the arena.
+  for (int use_arena = 0; use_arena < 2; use_arena++) {
+    flatbuffers::ArenaScope scope(use_arena ? &arena : nullptr);
+    for (size_t align = 1; align <= 64; align *= 2) {
+      auto p = flatbuffers::ArenaAllocate(3, align);
+      TEST_EQ(reinterpret_cast<size_t>(p) % align, 0u);
+      flatbuffers::ArenaDeallocate(p, align);
+    }
+  }
+}
+
+// Unpacking into the same object again should reuse everything it holds.
+// The arena-allocated types make that easy to observe.
+void UnPackReuseTest() {
+  namespace at = ArenaTest;
+  at::NodeT tree;
+  BuildArenaTestNode(&tree, 2);
+  flatbuffers::FlatBufferBuilder fbb_a;
+  fbb_a.Finish(tree.Pack(fbb_a));
+  // The same shape, with optional fields absent and shorter strings.
+  tree.first.release();
+  tree.pos.release();
+  tree.children[1].name.clear();
+  tree.children[2].tags[9].assign("x");
+  tree.payload.AsLeaf()->value = 42;
+  flatbuffers::FlatBufferBuilder fbb_b;
+  fbb_b.Finish(tree.Pack(fbb_b));
+  flatbuffers::FlatBufferBuilder *bufs[] = { &fbb_a, &fbb_b };
+
+  flatbuffers::Arena arena;
+  flatbuffers::ArenaScope scope(&arena);
+  at::NodeT node;
+  size_t used = 0;
+  for (int i = 0; i < 8; i++) {
+    auto &fbb = *bufs[i % 2];
+    node.UnPack(at::GetNode(fbb.GetBufferPointer()));
+    // Nothing stale may remain: it packs to the same bytes.
+    flatbuffers::FlatBufferBuilder fbb2;
+    fbb2.Finish(node.Pack(fbb2));
+    TEST_EQ(fbb2.GetSize(), fbb.GetSize());
+    TEST_EQ(memcmp(fbb2.GetBufferPointer(), fbb.GetBufferPointer(),
+                   fbb.GetSize()), 0);
+    if (i == 1) used = arena.BytesUsed();
+    if (i > 1) TEST_EQ(arena.BytesUsed(), used);
+  }
+  TEST_EQ(node.first.get() == nullptr, true);
+  TEST_EQ(node.payload.AsLeaf()->value, 42);
+}
+
+#ifdef FLATBUFFERS_USE_QT
+// Strings unpacked with --object-api-raw-strings point into their buffer.
+// Unpacking again from a newer buffer must not leave any row of a list model
+// pointing into the old one, even rows that compare equal.
+void ListModelRawStringsTest() {
+  std::vector<QByteArray> rows;
+  flatbuffers::ListModel<QByteArray> model(rows);
+  // Two buffers holding the same strings, "alpha" and "beta".
+  auto first = new QByteArray("alpha\0beta", 10);
+  QByteArray second("alpha\0beta", 10);
+  const QByteArray *source = first;
+  auto unpack = [&](QByteArray &s, flatbuffers::uoffset_t i) {
+    s = QByteArray::fromRawData(source->constData() + 6 * i, 5 - int(i));
+  };
+  model.update(2, unpack);
+  source = &second;
+  model.update(2, unpack);
+  delete first;
+  TEST_EQ(rows[0].constData() == second.constData(), true);
+  TEST_EQ(rows[1].constData() == second.constData() + 6, true);
+}
+
+// The list models of the vectors in a row move along with it, when the
+// vector holding the rows grows.
+void ListModelCacheMoveTest() {
+  struct Row {
+    std::vector<int> values;
+    flatbuffers::ListModelCache<int> values_model;
+  };
+  std::vector<Row> rows(1);
+  rows[0].values.assign(3, 7);
+  auto model = rows[0].values_model.get(rows[0].values);
+  rows.resize(100);
+  TEST_EQ(rows[0].values_model.model() == model, true);
+  TEST_EQ(model->rowCount(QModelIndex()), 3);
+  rows[0].values.push_back(8);
+  TEST_EQ(model->rowCount(QModelIndex()), 4);
+}
+#endif
+
 // Test that parser errors are actually generated.
 void TestError(const char *src, const char *error_substr,
                bool strict_json = false) {
@@ -880,6 +2176,8 @@ void ErrorTest() {
   TestError("table X { Y:int; Y:int; }", "field already");
   TestError("struct X { Y:string; }", "only scalar");
   TestError("struct X { Y:int (deprecated); }", "deprecate");
+  TestError("table X { Y:int (key_index); }", "key_index");
+  TestError("table X { Y:string (key, key_index); }", "key_index");
   TestError("union Z { X } table X { Y:Z; } root_type X; { Y: {}, A:1 }",
             "missing type field");
   TestError("union Z { X } table X { Y:Z; } root_type X; { Y_type: 99, Y: {",
@@ -1207,15 +2505,38 @@ int main(int /*argc*/, const char * /*argv*/[]) {
   MutateFlatBuffersTest(flatbuf.get(), rawbuf.length());
 
   ObjectFlatBuffersTest(flatbuf.get());
+  LazyObjectFlatBuffersTest(flatbuf.get());
+  EstimatePackedSizeTest(flatbuf.get());
 
   #ifndef FLATBUFFERS_NO_FILE_TESTS
   ParseAndGenerateTextTest();
   ReflectionTest(flatbuf.get(), rawbuf.length());
   ParseProtoTest();
+  MappedBufferTest();
   #endif
 
   FuzzTest1();
   FuzzTest2();
+  VTableDedupTest();
+  PoolAllocatorTest();
+  ChunkedBuilderTest();
+  ContainerAllocatorTest();
+  PerfCountersTest();
+  BufferStreamTest();
+  SharedStringTest();
+  VerifierVectorsTest();
+  ParallelVerifierTest();
+  SpliceBufferTest();
+  KeyIndexLookupTest();
+  SortedTablesTest();
+  PrecomputedLayoutTest();
+  Vector64Test();
+  ArenaObjectApiTest();
+  UnPackReuseTest();
+  #ifdef FLATBUFFERS_USE_QT
+  ListModelRawStringsTest();
+  ListModelCacheMoveTest();
+  #endif
 
   ErrorTest();
   ValueTest();